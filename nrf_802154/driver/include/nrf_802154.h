@@ -366,6 +366,71 @@ void nrf_802154_extended_address_set(const uint8_t * p_extended_address);
  */
 void nrf_802154_short_address_set(const uint8_t * p_short_address);
 
+/**
+ * @brief Configures and enables an address context.
+ *
+ * Frames destined to any enabled address context pass the frame filter and are acknowledged
+ * using the source address matching method of the context they were accepted in. This allows
+ * a single radio to participate in several networks at once, for example Thread and Zigbee.
+ *
+ * Address context 0 holds the addresses set by @ref nrf_802154_pan_id_set,
+ * @ref nrf_802154_short_address_set and @ref nrf_802154_extended_address_set and is always
+ * enabled. The number of available contexts is set by @ref NRF_802154_PAN_CONTEXTS_NUM.
+ *
+ * This function makes a copy of the addresses.
+ *
+ * @param[in]  context    Index of the address context.
+ * @param[in]  p_context  Pointer to the address context configuration.
+ *
+ * @retval  true   The address context was configured.
+ * @retval  false  The index of the address context is invalid.
+ */
+bool nrf_802154_pan_context_set(uint8_t context, const nrf_802154_pan_context_t * p_context);
+
+/**
+ * @brief Disables an address context.
+ *
+ * Frames destined only to a disabled address context are discarded by the frame filter.
+ *
+ * @param[in]  context  Index of the address context. Context 0 cannot be disabled.
+ *
+ * @retval  true   The address context was disabled.
+ * @retval  false  The index of the address context is invalid.
+ */
+bool nrf_802154_pan_context_clear(uint8_t context);
+
+#if NRF_802154_USE_RAW_API
+
+/**
+ * @brief Gets the address contexts a received frame was accepted in.
+ *
+ * @note This function can be called only for a buffer passed by @ref nrf_802154_received_raw
+ *       that was not freed yet.
+ *
+ * @param[in]  p_data  Pointer to the buffer containing PHR and PSDU of the received frame.
+ *
+ * @returns Mask of address contexts matched by the destination of the frame. The mask is 0 for
+ *          frames that were received only due to the promiscuous mode.
+ */
+nrf_802154_pan_context_mask_t nrf_802154_pan_contexts_get_raw(const uint8_t * p_data);
+
+#else // NRF_802154_USE_RAW_API
+
+/**
+ * @brief Gets the address contexts a received frame was accepted in.
+ *
+ * @note This function can be called only for a buffer passed by @ref nrf_802154_received
+ *       that was not freed yet.
+ *
+ * @param[in]  p_data  Pointer to the buffer containing the PSDU of the received frame.
+ *
+ * @returns Mask of address contexts matched by the destination of the frame. The mask is 0 for
+ *          frames that were received only due to the promiscuous mode.
+ */
+nrf_802154_pan_context_mask_t nrf_802154_pan_contexts_get(const uint8_t * p_data);
+
+#endif // NRF_802154_USE_RAW_API
+
 /**
  * @}
  * @defgroup nrf_802154_data Functions to calculate data given by the driver
@@ -593,6 +658,38 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca);
 
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_USE_RAW_API && NRF_802154_TX_QUEUE_SIZE
+
+/**
+ * @brief Adds a frame to the TX queue of the driver.
+ *
+ * @note This function is implemented in zero-copy fashion. The given buffer must not be modified
+ *       until the transmission result of the frame is reported.
+ *
+ * Frames from the TX queue are transmitted in the order in which they were added. When
+ * the transmission procedure of a queued frame ends, the driver starts the next queued frame
+ * immediately, without entering the receive state and without waiting for the higher layer to
+ * process the result of the previous frame. If the queue is empty, this function starts
+ * the transmission in the same way as @ref nrf_802154_transmit_raw does.
+ *
+ * The result of each queued frame is reported to the higher layer by a call to
+ * @ref nrf_802154_transmitted or @ref nrf_802154_transmit_failed. A busy channel, a missing or
+ * invalid ACK fails only the given frame. If the sequence is aborted, for example by a call to
+ * @ref nrf_802154_receive or @ref nrf_802154_sleep, or the timeslot ends, all frames remaining
+ * in the queue are reported as failed with the same error.
+ *
+ * The maximum number of queued frames is configured by @ref NRF_802154_TX_QUEUE_SIZE.
+ *
+ * @param[in]  p_data  Pointer to the frame to transmit. See also @ref nrf_802154_transmit_raw.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before the transmission.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue is full or the driver could not start the transmission procedure.
+ */
+bool nrf_802154_transmit_raw_enqueue(const uint8_t * p_data, bool cca);
+
+#endif // NRF_802154_USE_RAW_API && NRF_802154_TX_QUEUE_SIZE
+
 /**
  * @brief Requests transmission at the specified time.
  *
@@ -671,6 +768,30 @@ bool nrf_802154_transmit_at_cancel(void);
  */
 bool nrf_802154_energy_detection(uint32_t time_us);
 
+/**
+ * @brief Changes the radio state to energy detection to scan multiple channels.
+ *
+ * The energy detection procedure is performed on each channel selected by @p channel_mask,
+ * one after another, without returning to the receive state between the channels.
+ * The results of all channels are reported to the higher layer at once by
+ * @ref nrf_802154_energy_scan_done. If the procedure is aborted,
+ * @ref nrf_802154_energy_detection_failed is called instead.
+ *
+ * @note @ref nrf_802154_energy_scan_done can be called before this function returns a result.
+ * @note The energy detection on each channel is subject to the same rules as the procedure
+ *       requested by @ref nrf_802154_energy_detection.
+ *
+ * @param[in]  channel_mask   Mask of channels to scan. Bit @c n selects channel @c n. Only
+ *                            channels from 11 to 26 can be selected.
+ * @param[in]  dwell_time_us  Duration of energy detection on each channel. The given value is
+ *                            rounded up to multiplication of 8 symbols (128 us).
+ *
+ * @retval  true   The energy scan procedure was scheduled.
+ * @retval  false  The driver could not schedule the energy scan procedure or @p channel_mask
+ *                 does not select any valid channel.
+ */
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us);
+
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_CCA.
  *
@@ -914,6 +1035,28 @@ extern void nrf_802154_transmitted_timestamp_raw(const uint8_t * p_frame,
                                                  uint8_t         lqi,
                                                  uint32_t        time);
 
+/**
+ * @brief Notifies that a frame was transmitted.
+ *
+ * This function works like @ref nrf_802154_transmitted_raw and adds metadata of the transmission
+ * procedure to the parameter list. The default implementation calls
+ * @ref nrf_802154_transmitted_raw.
+ *
+ * @param[in]  p_frame     Pointer to a buffer that contains PHR and PSDU of the transmitted frame.
+ * @param[in]  p_ack       Pointer to a buffer that contains PHR and PSDU of the received ACK
+ *                         or NULL if ACK was not requested.
+ * @param[in]  power       RSSI of the received frame or 0 if ACK was not requested.
+ * @param[in]  lqi         LQI of the received frame or 0 if ACK was not requested.
+ * @param[in]  p_metadata  Pointer to metadata of the transmission procedure. Valid only during
+ *                         the call.
+ */
+extern void nrf_802154_transmitted_metadata_raw(
+    const uint8_t                             * p_frame,
+    uint8_t                                   * p_ack,
+    int8_t                                      power,
+    uint8_t                                     lqi,
+    const nrf_802154_transmit_done_metadata_t * p_metadata);
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -973,6 +1116,30 @@ extern void nrf_802154_transmitted_timestamp(const uint8_t * p_frame,
                                              uint8_t         lqi,
                                              uint32_t        time);
 
+/**
+ * @brief Notifies that a frame was transmitted.
+ *
+ * This function works like @ref nrf_802154_transmitted and adds metadata of the transmission
+ * procedure to the parameter list. The default implementation calls
+ * @ref nrf_802154_transmitted.
+ *
+ * @param[in]  p_frame     Pointer to the buffer containing PHR and PSDU of the transmitted frame.
+ * @param[in]  p_ack       Pointer to the buffer containing only the received ACK payload (PSDU
+ *                         excluding FCS) or NULL if ACK was not requested.
+ * @param[in]  length      Length of the received ACK payload or 0 if ACK was not requested.
+ * @param[in]  power       RSSI of the received frame or 0 if ACK was not requested.
+ * @param[in]  lqi         LQI of the received frame or 0 if ACK was not requested.
+ * @param[in]  p_metadata  Pointer to metadata of the transmission procedure. Valid only during
+ *                         the call.
+ */
+extern void nrf_802154_transmitted_metadata(
+    const uint8_t                             * p_frame,
+    uint8_t                                   * p_ack,
+    uint8_t                                     length,
+    int8_t                                      power,
+    uint8_t                                     lqi,
+    const nrf_802154_transmit_done_metadata_t * p_metadata);
+
 #endif // !NRF_802154_USE_RAW_API
 
 /**
@@ -987,6 +1154,24 @@ extern void nrf_802154_transmitted_timestamp(const uint8_t * p_frame,
 extern void nrf_802154_transmit_failed(const uint8_t       * p_frame,
                                        nrf_802154_tx_error_t error);
 
+/**
+ * @brief Notifies that a frame was not transmitted.
+ *
+ * This function works like @ref nrf_802154_transmit_failed and adds metadata of the transmission
+ * procedure to the parameter list. The default implementation calls
+ * @ref nrf_802154_transmit_failed.
+ *
+ * @param[in]  p_frame     Pointer to a buffer that contains PHR and PSDU of the frame that was not
+ *                         transmitted.
+ * @param[in]  error       Reason of the failure.
+ * @param[in]  p_metadata  Pointer to metadata of the transmission procedure. Valid only during
+ *                         the call.
+ */
+extern void nrf_802154_transmit_failed_metadata(
+    const uint8_t                             * p_frame,
+    nrf_802154_tx_error_t                       error,
+    const nrf_802154_transmit_done_metadata_t * p_metadata);
+
 /**
  * @brief Notifies that the energy detection procedure finished.
  *
@@ -1005,6 +1190,20 @@ extern void nrf_802154_energy_detected(uint8_t result);
  */
 extern void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error);
 
+/**
+ * @brief Notifies that the energy scan procedure finished.
+ *
+ * @note The energy levels are reported in the same way as by @ref nrf_802154_energy_detected.
+ *
+ * @param[in]  channel_mask  Mask of scanned channels, as passed to @ref nrf_802154_energy_scan.
+ * @param[in]  p_results     Array of @ref NRF_802154_ENERGY_SCAN_CHANNELS_NUM maximum energy
+ *                           levels, indexed with
+ *                           (channel - @ref NRF_802154_ENERGY_SCAN_FIRST_CHANNEL). Only entries
+ *                           of channels selected by @p channel_mask are valid. The array is valid
+ *                           only until this function returns.
+ */
+extern void nrf_802154_energy_scan_done(uint32_t channel_mask, const uint8_t * p_results);
+
 /**
  * @brief Notifies that the CCA procedure has finished.
  *
@@ -1479,6 +1678,46 @@ void nrf_802154_ack_timeout_set(uint32_t time);
 
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_tx_retry Automatic retransmission procedure
+ * @{
+ */
+#if NRF_802154_TX_RETRY_ENABLED
+
+/**
+ * @brief Sets the maximum number of retransmissions of a frame (macMaxFrameRetries).
+ *
+ * Frames that request an ACK and fail because of a missing or an invalid ACK or a busy channel
+ * are retransmitted by the driver. Only the final result of the transmission is notified by
+ * @ref nrf_802154_transmitted or @ref nrf_802154_transmit_failed.
+ *
+ * @note Each retransmission is preceded by a single CCA if CCA was requested for the frame,
+ *       including frames requested with @ref nrf_802154_transmit_csma_ca_raw. The CSMA-CA
+ *       procedure is not repeated; the random retransmission backoff replaces its backoffs.
+ *
+ * @param[in]  max_frame_retries  Maximum number of retransmissions. 0 disables retransmissions.
+ *                                A default value is defined in nrf_802154_config.h.
+ */
+void nrf_802154_max_frame_retries_set(uint8_t max_frame_retries);
+
+/**
+ * @brief Gets the maximum number of retransmissions of a frame (macMaxFrameRetries).
+ *
+ * @returns  Maximum number of retransmissions.
+ */
+uint8_t nrf_802154_max_frame_retries_get(void);
+
+/**
+ * @brief Sets the backoff exponent used to delay retransmissions.
+ *
+ * @param[in]  backoff_exponent  Backoff exponent. A default value is defined in
+ *                               nrf_802154_config.h.
+ */
+void nrf_802154_retry_backoff_exponent_set(uint8_t backoff_exponent);
+
+#endif // NRF_802154_TX_RETRY_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_coex Wifi Coex feature
@@ -1613,6 +1852,29 @@ void nrf_802154_stat_counters_reset(void);
  */
 void nrf_802154_stat_totals_get(nrf_802154_stat_totals_t * p_stat_totals);
 
+/**
+ * @brief Gets link statistics of the neighbors the driver has heard from.
+ *
+ * Neighbors are tracked only when @ref NRF_802154_NEIGHBOR_STATS_TABLE_SIZE is non-zero.
+ * Otherwise, this function always returns 0. The table can be read in parts by passing
+ * the number of entries read so far as @p first_index. A neighbor keeps its position in the table
+ * until it is replaced by a new one or the table is reset.
+ *
+ * @param[in]  first_index  Index of the first table entry to retrieve.
+ * @param[out] p_stats      Array that will be filled with neighbor statistics.
+ * @param[in]  max_count    Number of elements in the @p p_stats array.
+ *
+ * @returns Number of entries written to @p p_stats.
+ */
+uint8_t nrf_802154_neighbor_stats_get(uint8_t                       first_index,
+                                      nrf_802154_neighbor_stats_t * p_stats,
+                                      uint8_t                       max_count);
+
+/**
+ * @brief Removes all neighbors from the link statistics table.
+ */
+void nrf_802154_neighbor_stats_reset(void);
+
 /**
  * @}
  * @defgroup nrf_802154_ifs Inter-frame spacing feature
@@ -192,6 +192,22 @@ extern "C" {
 #define NRF_802154_PENDING_EXTENDED_ADDRESSES 10
 #endif
 
+/**
+ * @def NRF_802154_PAN_CONTEXTS_NUM
+ *
+ * The number of address contexts used to filter incoming frames. Each context holds a PAN ID,
+ * a short address and an extended address. Context 0 is always enabled and is configured by
+ * @ref nrf_802154_pan_id_set, @ref nrf_802154_short_address_set and
+ * @ref nrf_802154_extended_address_set. Additional contexts let the device receive frames
+ * destined to several networks at once, without the promiscuous mode.
+ *
+ * The maximum supported value is 8.
+ *
+ */
+#ifndef NRF_802154_PAN_CONTEXTS_NUM
+#define NRF_802154_PAN_CONTEXTS_NUM 1
+#endif
+
 /**
  * @def NRF_802154_RX_BUFFERS
  *
@@ -397,6 +413,101 @@ extern "C" {
 #define NRF_802154_MAX_ACK_IE_SIZE 8
 #endif
 
+/**
+ * @}
+ * @defgroup nrf_802154_config_tx_retry Automatic retransmission feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_RETRY_ENABLED
+ *
+ * Indicates whether the automatic retransmission feature is to be enabled in the driver.
+ *
+ * @note This feature relies on @ref NRF_802154_ACK_TIMEOUT_ENABLED to detect missing ACK frames.
+ */
+#ifndef NRF_802154_TX_RETRY_ENABLED
+#define NRF_802154_TX_RETRY_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_RETRY_MAX_FRAME_RETRIES_DEFAULT
+ *
+ * The default maximum number of retransmissions of a frame (macMaxFrameRetries).
+ *
+ */
+#ifndef NRF_802154_TX_RETRY_MAX_FRAME_RETRIES_DEFAULT
+#define NRF_802154_TX_RETRY_MAX_FRAME_RETRIES_DEFAULT 3
+#endif
+
+/**
+ * @def NRF_802154_TX_RETRY_BACKOFF_EXPONENT_DEFAULT
+ *
+ * The default backoff exponent used to draw the random delay before a retransmission.
+ *
+ */
+#ifndef NRF_802154_TX_RETRY_BACKOFF_EXPONENT_DEFAULT
+#define NRF_802154_TX_RETRY_BACKOFF_EXPONENT_DEFAULT 3
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_tx_power_ctrl Adaptive transmit power feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_TABLE_SIZE
+ *
+ * Configures the number of destinations for which the driver adapts the transmit power.
+ * Frames are sent to each destination with the lowest power that keeps the link margin set by
+ * @ref NRF_802154_TX_POWER_CTRL_MARGIN, limited by the power set with
+ * @ref nrf_802154_tx_power_set. When the table is full, the destination that was not used for
+ * the longest time is replaced. Setting this option to 0 disables the feature.
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_TABLE_SIZE
+#define NRF_802154_TX_POWER_CTRL_TABLE_SIZE 0
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_SENSITIVITY
+ *
+ * Configures the receiver sensitivity, in dBm, assumed for the destinations.
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_SENSITIVITY
+#define NRF_802154_TX_POWER_CTRL_SENSITIVITY (-95)
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_MARGIN
+ *
+ * Configures the link margin, in dB, kept above @ref NRF_802154_TX_POWER_CTRL_SENSITIVITY at
+ * the destination.
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_MARGIN
+#define NRF_802154_TX_POWER_CTRL_MARGIN 15
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_MAX_ATTENUATION
+ *
+ * Configures the maximum reduction, in dB, of the transmit power set with
+ * @ref nrf_802154_tx_power_set.
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_MAX_ATTENUATION
+#define NRF_802154_TX_POWER_CTRL_MAX_ATTENUATION 20
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_LQI_MIN
+ *
+ * Configures the averaged LQI of frames received from a destination below which frames to that
+ * destination are always sent with the full transmit power.
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_LQI_MIN
+#define NRF_802154_TX_POWER_CTRL_LQI_MIN 80
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_ifs Interframe spacing feature configuration
@@ -413,6 +524,24 @@ extern "C" {
 #define NRF_802154_IFS_ENABLED 1
 #endif
 
+/**
+ * @}
+ * @defgroup nrf_802154_config_tx_queue TX queue feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_QUEUE_SIZE
+ *
+ * Configures the number of frames that can be waiting in the TX queue of the driver. Frames are
+ * added to the queue with @ref nrf_802154_transmit_raw_enqueue and are transmitted back-to-back
+ * without a notification round trip to the higher layer between them.
+ * Setting this option to 0 disables the feature.
+ */
+#ifndef NRF_802154_TX_QUEUE_SIZE
+#define NRF_802154_TX_QUEUE_SIZE 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_transmission Transmission start notification feature configuration
@@ -482,6 +611,28 @@ extern "C" {
 #define NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES 1
 #endif
 
+/**
+ * @def NRF_802154_NEIGHBOR_STATS_TABLE_SIZE
+ *
+ * Configures the number of neighbors for which the driver keeps link statistics. The statistics
+ * can be retrieved by a call to @ref nrf_802154_neighbor_stats_get. When the table is full,
+ * the neighbor which was not heard from for the longest time is replaced.
+ * Setting this option to 0 disables the feature.
+ */
+#ifndef NRF_802154_NEIGHBOR_STATS_TABLE_SIZE
+#define NRF_802154_NEIGHBOR_STATS_TABLE_SIZE 0
+#endif
+
+/**
+ * @def NRF_802154_NEIGHBOR_STATS_EWMA_SHIFT
+ *
+ * Configures the weight of a new sample in the averaged RSSI and LQI of a neighbor.
+ * Each new sample contributes 1/2^NRF_802154_NEIGHBOR_STATS_EWMA_SHIFT to the average.
+ */
+#ifndef NRF_802154_NEIGHBOR_STATS_EWMA_SHIFT
+#define NRF_802154_NEIGHBOR_STATS_EWMA_SHIFT 3
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_security Security configuration
@@ -515,6 +666,113 @@ extern "C" {
 #define NRF_802154_IE_WRITER_ENABLED 1
 #endif
 
+/**
+ * @}
+ * @defgroup nrf_802154_config_random Pseudo-random number generator configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_RANDOM_RESEED_INTERVAL
+ *
+ * Number of pseudo-random numbers after which the xoshiro128** random backend
+ * (nrf_802154_random_xoshiro.c) collects a new entropy sample from the RNG peripheral and mixes
+ * it into its state.
+ */
+#ifndef NRF_802154_RANDOM_RESEED_INTERVAL
+#define NRF_802154_RANDOM_RESEED_INTERVAL 1024
+#endif
+
+/**
+ * @def NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+ *
+ * If the driver is expected to internally handle the RNG IRQ.
+ * By default, the RNG IRQ is owned by the OS entropy driver or MPSL and the interrupt must be
+ * passed to the driver by @ref nrf_802154_random_irq_handler.
+ * Enable the internal handling only if nothing else uses the RNG peripheral.
+ *
+ */
+#ifndef NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+#define NRF_802154_INTERNAL_RNG_IRQ_HANDLING 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_temperature Temperature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TEMPERATURE_UPDATE_THRESHOLD
+ *
+ * Difference between a measured temperature and the temperature currently used by the driver,
+ * in centigrades (C), at which the cached thermometer backend (nrf_802154_temperature_cached.c)
+ * starts using the measured value. Each such update recalculates the RSSI, LQI and ED correction
+ * tables.
+ */
+#ifndef NRF_802154_TEMPERATURE_UPDATE_THRESHOLD
+#define NRF_802154_TEMPERATURE_UPDATE_THRESHOLD 2
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_crit_sect_prof Critical section profiler configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_CRIT_SECT_PROF_ENABLED
+ *
+ * Enables measurement of the time spent in critical sections of the driver, with interrupts
+ * masked, and holding locks reported through @ref nrf_802154_crit_sect_prof_enter. The results
+ * can be retrieved by a call to @ref nrf_802154_crit_sect_prof_report_get.
+ */
+#ifndef NRF_802154_CRIT_SECT_PROF_ENABLED
+#define NRF_802154_CRIT_SECT_PROF_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CRIT_SECT_PROF_SITES_NUM
+ *
+ * Configures the number of code locations for which the profiler keeps separate results.
+ * Sections entered from further locations are only counted as dropped.
+ */
+#ifndef NRF_802154_CRIT_SECT_PROF_SITES_NUM
+#define NRF_802154_CRIT_SECT_PROF_SITES_NUM 32
+#endif
+
+/**
+ * @def NRF_802154_CRIT_SECT_PROF_HELD_NUM
+ *
+ * Configures the number of sections that can be measured at the same time, for example
+ * a critical section of the driver entered while a lock is held.
+ */
+#ifndef NRF_802154_CRIT_SECT_PROF_HELD_NUM
+#define NRF_802154_CRIT_SECT_PROF_HELD_NUM 8
+#endif
+
+/**
+ * @def NRF_802154_CRIT_SECT_PROF_BUDGET
+ *
+ * Configures the time, in profiler ticks, for which a section may be held. Sections held longer
+ * are counted in @ref nrf_802154_crit_sect_prof_site_t::over_budget and reported with
+ * @ref nrf_802154_crit_sect_prof_budget_exceeded.
+ */
+#ifndef NRF_802154_CRIT_SECT_PROF_BUDGET
+#define NRF_802154_CRIT_SECT_PROF_BUDGET 6400
+#endif
+
+/**
+ * @def NRF_802154_CRIT_SECT_PROF_HOST_CLOCK
+ *
+ * Configures the profiler to measure time with the monotonic clock of the host, in nanoseconds,
+ * instead of the DWT cycle counter. Intended for builds running on a host in simulation.
+ * The profiler results are then protected with a POSIX mutex instead of masking interrupts.
+ */
+#ifndef NRF_802154_CRIT_SECT_PROF_HOST_CLOCK
+#define NRF_802154_CRIT_SECT_PROF_HOST_CLOCK 0
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -200,6 +200,9 @@ typedef enum
 #if NRF_802154_IFS_ENABLED
     REQ_ORIG_IFS,
 #endif // NRF_802154_IFS_ENABLED
+#if NRF_802154_TX_RETRY_ENABLED
+    REQ_ORIG_TX_RETRY,
+#endif // NRF_802154_TX_RETRY_ENABLED
 } req_originator_t;
 
 #endif // NRF_802154_CONST_H_
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that measures the time spent in critical sections, with interrupts masked and
+ *        holding locks.
+ *
+ */
+
+#ifndef NRF_802154_CRIT_SECT_PROF_H_
+#define NRF_802154_CRIT_SECT_PROF_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_crit_sect_prof Critical section profiler of the 802.15.4 driver
+ * @{
+ * @ingroup nrf_802154
+ * @brief Critical section profiler of the 802.15.4 driver.
+ *
+ * The profiler measures how long each section was held, and accumulates the results per code
+ * location that entered it. Critical sections of the driver and the regions in which the driver
+ * masks interrupts are measured automatically. Other code, such as the platform implementation
+ * of @c nrf_802154_serialization_crit_sect_enter or the mutexes of the CryptoCell platform, can
+ * report the sections it holds with @ref nrf_802154_crit_sect_prof_enter and
+ * @ref nrf_802154_crit_sect_prof_exit.
+ *
+ * Time is measured in profiler ticks: cycles of the DWT cycle counter, or nanoseconds of the host
+ * clock if @ref NRF_802154_CRIT_SECT_PROF_HOST_CLOCK is enabled.
+ */
+
+/**
+ * @brief Kinds of profiled sections.
+ */
+typedef uint8_t nrf_802154_crit_sect_prof_kind_t;
+
+#define NRF_802154_CRIT_SECT_PROF_KIND_DRIVER     0x00 // !< Critical section of the 802.15.4 driver.
+#define NRF_802154_CRIT_SECT_PROF_KIND_IRQ_MASKED 0x01 // !< Interrupts masked by the 802.15.4 driver.
+#define NRF_802154_CRIT_SECT_PROF_KIND_LOCK       0x02 // !< Lock reported by other code.
+
+/**
+ * @brief Results of the sections entered from one code location.
+ */
+typedef struct
+{
+    uintptr_t                        site;        ///< Address of the code that entered the sections.
+    nrf_802154_crit_sect_prof_kind_t kind;        ///< Kind of the sections.
+    uint32_t                         count;       ///< Number of sections held.
+    uint32_t                         over_budget; ///< Number of sections held longer than @ref NRF_802154_CRIT_SECT_PROF_BUDGET.
+    uint32_t                         max_time;    ///< Longest time a section was held [ticks].
+    uint64_t                         total_time;  ///< Total time the sections were held [ticks].
+} nrf_802154_crit_sect_prof_site_t;
+
+#if NRF_802154_CRIT_SECT_PROF_ENABLED
+
+/**
+ * @brief Gets the address of the code that called the current function.
+ *
+ * Used to pass the @p site parameter of @ref nrf_802154_crit_sect_prof_enter from a function that
+ * enters a section on behalf of its caller.
+ */
+#define NRF_802154_CRIT_SECT_PROF_CALLER() ((uintptr_t)__builtin_return_address(0))
+
+/**
+ * @brief Initializes the profiler and starts the time source.
+ */
+void nrf_802154_crit_sect_prof_init(void);
+
+/**
+ * @brief Starts measuring a section.
+ *
+ * @param[in]  p_section  Pointer identifying the section, for example the lock being held.
+ *                        It must be passed to @ref nrf_802154_crit_sect_prof_exit when the section
+ *                        is left.
+ * @param[in]  kind       Kind of the section.
+ * @param[in]  site       Address of the code that entered the section.
+ */
+void nrf_802154_crit_sect_prof_enter(const void                     * p_section,
+                                     nrf_802154_crit_sect_prof_kind_t kind,
+                                     uintptr_t                        site);
+
+/**
+ * @brief Finishes measuring a section and accumulates the result.
+ *
+ * @param[in]  p_section  Pointer identifying the section, passed to
+ *                        @ref nrf_802154_crit_sect_prof_enter.
+ */
+void nrf_802154_crit_sect_prof_exit(const void * p_section);
+
+/**
+ * @brief Starts measuring a region in which interrupts are masked.
+ *
+ * The code that called this function is recorded as the site of the region.
+ * Used by @c nrf_802154_mcu_critical_enter.
+ */
+void nrf_802154_crit_sect_prof_irq_masked(void);
+
+/**
+ * @brief Finishes measuring a region in which interrupts are masked.
+ *
+ * Used by @c nrf_802154_mcu_critical_exit.
+ */
+void nrf_802154_crit_sect_prof_irq_unmasked(void);
+
+/**
+ * @brief Gets the profiling results.
+ *
+ * The results are sorted by @ref nrf_802154_crit_sect_prof_site_t::max_time, starting from the
+ * longest one.
+ *
+ * @param[out]  p_sites    Array to be filled with the results.
+ * @param[in]   sites_num  Number of elements of @p p_sites.
+ * @param[out]  p_dropped  Number of sections that were not accounted because the table of
+ *                         locations was full, or NULL.
+ *
+ * @returns Number of elements written to @p p_sites.
+ */
+size_t nrf_802154_crit_sect_prof_report_get(nrf_802154_crit_sect_prof_site_t * p_sites,
+                                            size_t                             sites_num,
+                                            uint32_t                         * p_dropped);
+
+/**
+ * @brief Clears the profiling results.
+ */
+void nrf_802154_crit_sect_prof_reset(void);
+
+/**
+ * @brief Notifies that a section was held longer than @ref NRF_802154_CRIT_SECT_PROF_BUDGET.
+ *
+ * @note This function is called with the results already updated. It may be called from any
+ *       context, including interrupt handlers, and must return quickly.
+ *
+ * @param[in]  p_site  Results of the location that entered the section.
+ * @param[in]  time    Time the section was held [ticks].
+ */
+extern void nrf_802154_crit_sect_prof_budget_exceeded(const nrf_802154_crit_sect_prof_site_t * p_site,
+                                                      uint32_t                                 time);
+
+#else // NRF_802154_CRIT_SECT_PROF_ENABLED
+
+#define NRF_802154_CRIT_SECT_PROF_CALLER() ((uintptr_t)0)
+
+#define nrf_802154_crit_sect_prof_init()
+#define nrf_802154_crit_sect_prof_enter(p_section, kind, site)
+#define nrf_802154_crit_sect_prof_exit(p_section)
+#define nrf_802154_crit_sect_prof_irq_masked()
+#define nrf_802154_crit_sect_prof_irq_unmasked()
+
+#endif // NRF_802154_CRIT_SECT_PROF_ENABLED
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_CRIT_SECT_PROF_H_ */
@@ -106,6 +106,17 @@ typedef uint8_t nrf_802154_ed_error_t;
 
 #define NRF_802154_ED_ERROR_ABORTED 0x01 // !< Procedure was aborted by another operation.
 
+/**
+ * @brief Channels covered by the energy scan procedure.
+ *
+ * Bit @c n of the channel mask passed to the energy scan procedure selects channel @c n.
+ * Results of the procedure are stored in an array indexed with
+ * (channel - @ref NRF_802154_ENERGY_SCAN_FIRST_CHANNEL).
+ */
+#define NRF_802154_ENERGY_SCAN_FIRST_CHANNEL 11U          // !< First channel that can be scanned.
+#define NRF_802154_ENERGY_SCAN_CHANNELS_NUM  16U          // !< Number of channels that can be scanned.
+#define NRF_802154_ENERGY_SCAN_CHANNEL_MASK  0x07fff800UL // !< Mask of all channels that can be scanned.
+
 /**
  * @brief Possible errors during the CCA procedure.
  */
@@ -181,6 +192,24 @@ typedef uint8_t nrf_802154_src_addr_match_t;
 #define NRF_802154_SRC_ADDR_MATCH_ZIGBEE   0x01 // !< Implementation for the Zigbee protocol.
 #define NRF_802154_SRC_ADDR_MATCH_ALWAYS_1 0x02 // !< Standard compliant implementation.
 
+/**
+ * @brief Mask of address contexts.
+ *
+ * Bit @c n of the mask corresponds to the address context @c n.
+ */
+typedef uint8_t nrf_802154_pan_context_mask_t;
+
+/**
+ * @brief Structure for configuring an address context.
+ */
+typedef struct
+{
+    uint8_t                     pan_id[2];        // !< PAN ID (little-endian).
+    uint8_t                     short_addr[2];    // !< Short address (little-endian).
+    uint8_t                     extended_addr[8]; // !< Extended address (little-endian).
+    nrf_802154_src_addr_match_t src_addr_match;   // !< Source address matching method used in ACK frames sent in this context.
+} nrf_802154_pan_context_t;
+
 /**
  * @brief RSSI measurement results.
  */
@@ -333,6 +362,25 @@ typedef struct
     nrf_802154_stat_timestamps_t timestamps;
 } nrf_802154_stats_t;
 
+/**
+ * @brief Type of structure holding link statistics of a single neighbor.
+ *
+ * Averaged values are exponentially weighted moving averages updated with every frame
+ * received from the neighbor and with every ACK the neighbor sent in response to a frame
+ * transmitted by this node.
+ */
+typedef struct
+{
+    uint8_t  addr[8];          // !< Address of the neighbor, little endian. Only first 2 bytes are valid for a short address.
+    bool     extended;         // !< Whether @ref addr holds an extended address.
+    int8_t   rssi_avg;         // !< Averaged RSSI in dBm.
+    uint8_t  lqi_avg;          // !< Averaged LQI.
+    uint32_t rx_frames;        // !< Number of frames received from the neighbor.
+    uint32_t tx_ack_requested; // !< Number of frames with the ACK request bit set transmitted to the neighbor.
+    uint32_t tx_acked;         // !< Number of transmitted frames the neighbor acknowledged.
+    uint32_t last_seen;        // !< Time in microseconds at which the last frame or ACK from the neighbor was received.
+} nrf_802154_neighbor_stats_t;
+
 /**
  * @brief Type holding the value of Key Id Mode of the key stored in nRF 802.15.4 Radio Driver.
  */
@@ -362,6 +410,14 @@ typedef struct
     bool                  use_global_frame_counter; // !< Whether to use the global frame counter instead of the one defined in this structure.
 } nrf_802154_key_t;
 
+/**
+ * @brief Type of structure holding metadata of a frame whose transmission procedure finished.
+ */
+typedef struct
+{
+    uint8_t attempts; // !< Number of transmission attempts of the frame, including the first one.
+} nrf_802154_transmit_done_metadata_t;
+
 /**
  *@}
  **/
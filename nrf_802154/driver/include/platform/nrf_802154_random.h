@@ -43,6 +43,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -75,6 +77,48 @@ void nrf_802154_random_deinit(void);
  */
 uint32_t nrf_802154_random_get(void);
 
+/**
+ * @brief Gets a pseudo-random number from the range <0, @p bound).
+ *
+ * The number is taken from the upper bits of a 64-bit product, and products that would make some
+ * results more likely are rejected, so every value in the range is equally probable.
+ *
+ * @param[in]  bound  Upper limit of the range, excluded. Must be greater than 0.
+ *
+ * @returns Pseudo-random number lower than @p bound.
+ */
+static inline uint32_t nrf_802154_random_bounded_get(uint32_t bound)
+{
+    uint64_t product   = (uint64_t)nrf_802154_random_get() * bound;
+    uint32_t threshold;
+
+    if ((uint32_t)product < bound)
+    {
+        // Number of 32-bit values that have to be rejected: 2^32 mod bound.
+        threshold = (0U - bound) % bound;
+
+        while ((uint32_t)product < threshold)
+        {
+            product = (uint64_t)nrf_802154_random_get() * bound;
+        }
+    }
+
+    return (uint32_t)(product >> 32);
+}
+
+#if !NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+/**
+ * @brief Handles the interrupt request from the RNG peripheral.
+ *
+ * @note If NRF_802154_INTERNAL_RNG_IRQ_HANDLING is enabled, the driver internally handles the
+ *       RNG IRQ, and this function must not be called.
+ *
+ * Only the xoshiro128** backend collects entropy from the RNG peripheral in the background.
+ * The other backends implement this function as empty.
+ */
+void nrf_802154_random_irq_handler(void);
+#endif // !NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+
 /**
  *@}
  **/
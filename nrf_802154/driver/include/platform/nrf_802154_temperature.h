@@ -75,6 +75,17 @@ void nrf_802154_temperature_deinit(void);
  */
 int8_t nrf_802154_temperature_get(void);
 
+/**
+ * @brief Passes a new temperature measurement to the thermometer.
+ *
+ * Used only by thermometer implementations that cache the temperature measured by the platform.
+ * The platform calls this function whenever it measures the temperature, for example with the
+ * TEMP peripheral or @c mpsl_temperature_get.
+ *
+ * @param[in]  temperature  Measured temperature, in 0.25 centigrade (C) units.
+ */
+void nrf_802154_temperature_measurement_set(int32_t temperature);
+
 /**
  * @brief Callback function executed when the temperature changes.
  */
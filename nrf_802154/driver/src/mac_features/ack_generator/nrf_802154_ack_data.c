@@ -44,6 +44,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
@@ -96,7 +97,7 @@ typedef struct
 // TODO: Combine below arrays to perform binary search only once per Ack generation.
 static pending_bit_arrays_t        m_pending_bit;
 static ie_arrays_t                 m_ie;
-static nrf_802154_src_addr_match_t m_src_matching_method;
+static nrf_802154_src_addr_match_t m_src_matching_method[NRF_802154_PAN_CONTEXTS_NUM];
 
 /***************************************************************************************************
  * @section Array handling helper functions
@@ -598,7 +599,11 @@ void nrf_802154_ack_data_init(void)
     memset(&m_ie, 0, sizeof(m_ie));
 
     m_pending_bit.enabled = true;
-    m_src_matching_method = NRF_802154_SRC_ADDR_MATCH_THREAD;
+
+    for (uint32_t i = 0; i < NRF_802154_PAN_CONTEXTS_NUM; i++)
+    {
+        m_src_matching_method[i] = NRF_802154_SRC_ADDR_MATCH_THREAD;
+    }
 }
 
 void nrf_802154_ack_data_enable(bool enabled)
@@ -679,12 +684,21 @@ void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type)
 
 void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method)
 {
+    nrf_802154_ack_data_pan_context_src_addr_matching_method_set(0U, match_method);
+}
+
+void nrf_802154_ack_data_pan_context_src_addr_matching_method_set(
+    uint8_t                     context,
+    nrf_802154_src_addr_match_t match_method)
+{
+    assert(context < NRF_802154_PAN_CONTEXTS_NUM);
+
     switch (match_method)
     {
         case NRF_802154_SRC_ADDR_MATCH_THREAD:
         case NRF_802154_SRC_ADDR_MATCH_ZIGBEE:
         case NRF_802154_SRC_ADDR_MATCH_ALWAYS_1:
-            m_src_matching_method = match_method;
+            m_src_matching_method[context] = match_method;
             break;
 
         default:
@@ -697,7 +711,8 @@ bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame)
 {
     bool ret;
 
-    switch (m_src_matching_method)
+    // The frame is acknowledged in the address context it was accepted in by the filter.
+    switch (m_src_matching_method[nrf_802154_filter_pan_context_get()])
     {
         case NRF_802154_SRC_ADDR_MATCH_THREAD:
             ret = addr_match_thread(p_frame);
@@ -120,6 +120,21 @@ void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type);
  */
 void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method);
 
+/**
+ * @brief Select the source matching algorithm used in the given address context.
+ *
+ * The algorithm used for a received frame is the one of the address context the frame was
+ * accepted in by the incoming frame filter. Calling
+ * @ref nrf_802154_ack_data_src_addr_matching_method_set is equivalent to calling this function
+ * for context 0.
+ *
+ * @param[in]  context      Index of the address context.
+ * @param[in]  match_method Source matching method to be used.
+ */
+void nrf_802154_ack_data_pan_context_src_addr_matching_method_set(
+    uint8_t                     context,
+    nrf_802154_src_addr_match_t match_method);
+
 /**
  * @brief Checks if a pending bit is to be set in the ACK frame sent in response to a given frame.
  *
@@ -43,6 +43,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "mac_features/nrf_802154_ie_writer.h"
 #include "nrf_802154_ack_data.h"
@@ -184,7 +185,8 @@ static void destination_set(const nrf_802154_frame_parser_mhr_data_t * p_frame,
         }
         else
         {
-            p_dst_panid = nrf_802154_pib_pan_id_get();
+            p_dst_panid =
+                nrf_802154_pib_pan_context_pan_id_get(nrf_802154_filter_pan_context_get());
         }
 
         memcpy((uint8_t *)p_ack->p_dst_panid, p_dst_panid, PAN_ID_SIZE);
@@ -191,7 +191,7 @@ static void random_backoff_start(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    uint8_t backoff_periods = nrf_802154_random_get() % (1 << m_be);
+    uint8_t backoff_periods = nrf_802154_random_bounded_get(1U << m_be);
 
     rsch_dly_ts_param_t backoff_ts_param =
     {
@@ -52,10 +52,10 @@
 #include "nrf_802154_frame_parser.h"
 #include "nrf_802154_pib.h"
 
-#define FCF_CHECK_OFFSET           (PHR_SIZE + FCF_SIZE)
-#define PANID_CHECK_OFFSET         (DEST_ADDR_OFFSET)
-#define SHORT_ADDR_CHECK_OFFSET    (DEST_ADDR_OFFSET + SHORT_ADDRESS_SIZE)
-#define EXTENDED_ADDR_CHECK_OFFSET (DEST_ADDR_OFFSET + EXTENDED_ADDRESS_SIZE)
+#define FCF_CHECK_OFFSET   (PHR_SIZE + FCF_SIZE)
+#define PANID_CHECK_OFFSET (DEST_ADDR_OFFSET)
+
+static nrf_802154_pan_context_mask_t m_pan_contexts; ///< Address contexts matched by the most recently filtered frame.
 
 /**
  * @brief Check if given frame version is allowed for given frame type.
@@ -153,44 +153,35 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get_2006(const uint8_t *
                                                                 uint8_t       * p_num_bytes,
                                                                 uint8_t         frame_type)
 {
-    nrf_802154_rx_error_t result;
+    const nrf_802154_frame_parser_layout_t * p_layout = nrf_802154_frame_parser_layout_get(p_data);
+    nrf_802154_rx_error_t                    result;
 
-    switch (p_data[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK)
+    if (p_layout->dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
     {
-        case DEST_ADDR_TYPE_SHORT:
-            *p_num_bytes = SHORT_ADDR_CHECK_OFFSET;
-            result       = NRF_802154_RX_ERROR_NONE;
-            break;
-
-        case DEST_ADDR_TYPE_EXTENDED:
-            *p_num_bytes = EXTENDED_ADDR_CHECK_OFFSET;
+        result = NRF_802154_RX_ERROR_INVALID_FRAME;
+    }
+    else if (p_layout->dst_addr_size != 0)
+    {
+        // In 2006 frames destination PAN ID is always present together with destination address.
+        *p_num_bytes = p_layout->dst_addr_end_offset;
+        result       = NRF_802154_RX_ERROR_NONE;
+    }
+    else if (nrf_802154_pib_pan_coord_get() || (frame_type == FRAME_TYPE_BEACON))
+    {
+        if ((p_layout->src_addr_size == SHORT_ADDRESS_SIZE) ||
+            (p_layout->src_addr_size == EXTENDED_ADDRESS_SIZE))
+        {
+            *p_num_bytes = PANID_CHECK_OFFSET;
             result       = NRF_802154_RX_ERROR_NONE;
-            break;
-
-        case DEST_ADDR_TYPE_NONE:
-            if (nrf_802154_pib_pan_coord_get() || (frame_type == FRAME_TYPE_BEACON))
-            {
-                switch (p_data[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK)
-                {
-                    case SRC_ADDR_TYPE_SHORT:
-                    case SRC_ADDR_TYPE_EXTENDED:
-                        *p_num_bytes = PANID_CHECK_OFFSET;
-                        result       = NRF_802154_RX_ERROR_NONE;
-                        break;
-
-                    default:
-                        result = NRF_802154_RX_ERROR_INVALID_FRAME;
-                }
-            }
-            else
-            {
-                result = NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
-            }
-
-            break;
-
-        default:
+        }
+        else
+        {
             result = NRF_802154_RX_ERROR_INVALID_FRAME;
+        }
+    }
+    else
+    {
+        result = NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
     }
 
     return result;
@@ -303,25 +294,27 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get(const uint8_t * p_dat
 }
 
 /**
- * Verify if destination PAN Id of incoming frame allows processing by this node.
+ * Verify if destination PAN Id of incoming frame allows processing in given address context.
  *
  * @param[in] p_panid     Pointer of PAN ID of incoming frame.
  * @param[in] frame_type  Type of the frame being filtered.
+ * @param[in] context     Index of the address context.
  *
  * @retval true   PAN Id of incoming frame allows further processing of the frame.
  * @retval false  PAN Id of incoming frame does not allow further processing.
  */
-static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type)
+static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type, uint8_t context)
 {
-    bool result;
+    const uint8_t * p_own_panid = nrf_802154_pib_pan_context_pan_id_get(context);
+    bool            result;
 
-    if ((0 == memcmp(p_panid, nrf_802154_pib_pan_id_get(), PAN_ID_SIZE)) ||
+    if ((0 == memcmp(p_panid, p_own_panid, PAN_ID_SIZE)) ||
         (0 == memcmp(p_panid, BROADCAST_ADDRESS, PAN_ID_SIZE)))
     {
         result = true;
     }
     else if ((FRAME_TYPE_BEACON == frame_type) &&
-             (0 == memcmp(nrf_802154_pib_pan_id_get(), BROADCAST_ADDRESS, PAN_ID_SIZE)))
+             (0 == memcmp(p_own_panid, BROADCAST_ADDRESS, PAN_ID_SIZE)))
     {
         result = true;
     }
@@ -334,18 +327,22 @@ static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type)
 }
 
 /**
- * Verify if destination short address of incoming frame allows processing by this node.
+ * Verify if destination short address of incoming frame allows processing in given address
+ * context.
  *
  * @param[in] p_dst_addr  Pointer of destination address of incoming frame.
+ * @param[in] context     Index of the address context.
  *
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
-static bool dst_short_addr_check(const uint8_t * p_dst_addr)
+static bool dst_short_addr_check(const uint8_t * p_dst_addr, uint8_t context)
 {
     bool result;
 
-    if ((0 == memcmp(p_dst_addr, nrf_802154_pib_short_address_get(), SHORT_ADDRESS_SIZE)) ||
+    if ((0 == memcmp(p_dst_addr,
+                     nrf_802154_pib_pan_context_short_address_get(context),
+                     SHORT_ADDRESS_SIZE)) ||
         (0 == memcmp(p_dst_addr, BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE)))
     {
         result = true;
@@ -359,18 +356,22 @@ static bool dst_short_addr_check(const uint8_t * p_dst_addr)
 }
 
 /**
- * Verify if destination extended address of incoming frame allows processing by this node.
+ * Verify if destination extended address of incoming frame allows processing in given address
+ * context.
  *
  * @param[in] p_dst_addr  Pointer of destination address of incoming frame.
+ * @param[in] context     Index of the address context.
  *
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
-static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
+static bool dst_extended_addr_check(const uint8_t * p_dst_addr, uint8_t context)
 {
     bool result;
 
-    if (0 == memcmp(p_dst_addr, nrf_802154_pib_extended_address_get(), EXTENDED_ADDRESS_SIZE))
+    if (0 == memcmp(p_dst_addr,
+                    nrf_802154_pib_pan_context_extended_address_get(context),
+                    EXTENDED_ADDRESS_SIZE))
     {
         result = true;
     }
@@ -382,9 +383,56 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
     return result;
 }
 
+/**
+ * Verify if destination addressing of incoming frame allows processing in given address context.
+ *
+ * @param[in] p_mhr_data  Pointer to the parsed MHR of the incoming frame.
+ * @param[in] frame_type  Type of the frame being filtered.
+ * @param[in] context     Index of the address context.
+ *
+ * @retval true   Destination addressing of incoming frame matches the address context.
+ * @retval false  Destination addressing of incoming frame does not match the address context.
+ */
+static bool dst_context_check(const nrf_802154_frame_parser_mhr_data_t * p_mhr_data,
+                              uint8_t                                    frame_type,
+                              uint8_t                                    context)
+{
+    bool result;
+
+    if ((p_mhr_data->p_dst_panid != NULL) &&
+        !dst_pan_id_check(p_mhr_data->p_dst_panid, frame_type, context))
+    {
+        return false;
+    }
+
+    switch (p_mhr_data->dst_addr_size)
+    {
+        case SHORT_ADDRESS_SIZE:
+            result = dst_short_addr_check(p_mhr_data->p_dst_addr, context);
+            break;
+
+        case EXTENDED_ADDRESS_SIZE:
+            result = dst_extended_addr_check(p_mhr_data->p_dst_addr, context);
+            break;
+
+        case 0:
+            // Allow frames destined to the Pan Coordinator without destination address or
+            // beacon frames without destination address
+            result = nrf_802154_pib_pan_coord_get() || (frame_type == FRAME_TYPE_BEACON);
+            break;
+
+        default:
+            assert(false);
+            result = false;
+    }
+
+    return result;
+}
+
 /**
  * Verify if destination addressing of incoming frame allows processing by this node.
- * This function checks addressing according to IEEE 802.15.4-2015.
+ * This function checks addressing according to IEEE 802.15.4-2015 against every enabled address
+ * context and records the matching ones.
  *
  * @param[in] p_data  Pointer to a buffer containing PHR and PSDU of the incoming frame.
  *
@@ -394,47 +442,26 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
  */
 static nrf_802154_rx_error_t dst_addr_check(const uint8_t * p_data, uint8_t frame_type)
 {
-    bool                               result;
+    nrf_802154_pan_context_mask_t      enabled = nrf_802154_pib_pan_contexts_enabled_get();
+    nrf_802154_pan_context_mask_t      matched = 0U;
     nrf_802154_frame_parser_mhr_data_t mhr_data;
 
-    result = nrf_802154_frame_parser_mhr_parse(p_data, &mhr_data);
-
-    if (!result)
+    if (!nrf_802154_frame_parser_mhr_parse(p_data, &mhr_data))
     {
         return NRF_802154_RX_ERROR_INVALID_FRAME;
     }
 
-    if (mhr_data.p_dst_panid != NULL)
+    for (uint8_t context = 0U; context < NRF_802154_PAN_CONTEXTS_NUM; context++)
     {
-        if (!dst_pan_id_check(mhr_data.p_dst_panid, frame_type))
+        if ((enabled & (1U << context)) && dst_context_check(&mhr_data, frame_type, context))
         {
-            return NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+            matched |= (nrf_802154_pan_context_mask_t)(1U << context);
         }
     }
 
-    switch (mhr_data.dst_addr_size)
-    {
-        case SHORT_ADDRESS_SIZE:
-            return dst_short_addr_check(mhr_data.p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+    m_pan_contexts = matched;
 
-        case EXTENDED_ADDRESS_SIZE:
-            return dst_extended_addr_check(mhr_data.p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
-
-        case 0:
-            // Allow frames destined to the Pan Coordinator without destination address or
-            // beacon frames without destination address
-            return (nrf_802154_pib_pan_coord_get() ||
-                    (frame_type ==
-                     FRAME_TYPE_BEACON)) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
-
-        default:
-            assert(false);
-    }
-
-    return NRF_802154_RX_ERROR_INVALID_FRAME;
+    return (matched != 0U) ? NRF_802154_RX_ERROR_NONE : NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
 }
 
 nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8_t * p_num_bytes)
@@ -446,6 +473,9 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8
     switch (*p_num_bytes)
     {
         case FCF_CHECK_OFFSET:
+            // Frames without destination addressing are accepted in every enabled context.
+            m_pan_contexts = nrf_802154_pib_pan_contexts_enabled_get();
+
             if (p_data[0] < IMM_ACK_LENGTH || p_data[0] > MAX_PACKET_SIZE)
             {
                 result = NRF_802154_RX_ERROR_INVALID_LENGTH;
@@ -474,3 +504,24 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8
 
     return result;
 }
+
+nrf_802154_pan_context_mask_t nrf_802154_filter_pan_contexts_get(void)
+{
+    return m_pan_contexts;
+}
+
+uint8_t nrf_802154_filter_pan_context_get(void)
+{
+    uint8_t context = 0U;
+
+    for (uint8_t i = 0U; i < NRF_802154_PAN_CONTEXTS_NUM; i++)
+    {
+        if (m_pan_contexts & (1U << i))
+        {
+            context = i;
+            break;
+        }
+    }
+
+    return context;
+}
@@ -78,6 +78,23 @@
  */
 nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8_t * p_num_bytes);
 
+/**
+ * @brief Gets the address contexts matched by the most recently filtered frame.
+ *
+ * A frame destined to the broadcast address can match several address contexts at once.
+ *
+ * @returns Mask of address contexts in which the most recently filtered frame was accepted.
+ */
+nrf_802154_pan_context_mask_t nrf_802154_filter_pan_contexts_get(void);
+
+/**
+ * @brief Gets the address context the most recently filtered frame is processed in.
+ *
+ * @returns Index of the lowest address context matched by the most recently filtered frame,
+ *          or 0 if no context was matched.
+ */
+uint8_t nrf_802154_filter_pan_context_get(void);
+
 /**
  *@}
  **/
@@ -49,164 +49,130 @@
 #include "nrf_802154_const.h"
 
 /***************************************************************************************************
- * @section Helper functions
+ * @section Addressing fields layout table
  **************************************************************************************************/
 
-// Version
-static uint8_t frame_version_get(const uint8_t * p_frame)
-{
-    return p_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK;
-}
-
-// Addressing
-
-static uint8_t addressing_offset_get(const uint8_t * p_frame)
-{
-    if ((frame_version_get(p_frame) >= FRAME_VERSION_2) &&
-        nrf_802154_frame_parser_dsn_suppress_bit_is_set(p_frame))
-    {
-        return PHR_SIZE + FCF_SIZE;
-    }
-    else
-    {
-        return PHR_SIZE + FCF_SIZE + DSN_SIZE;
-    }
-}
-
-static bool src_addr_is_present(const uint8_t * p_frame)
-{
-    return (p_frame[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK) != SRC_ADDR_TYPE_NONE;
-}
-
-static bool dst_addr_is_present(const uint8_t * p_frame)
-{
-    return (p_frame[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK) != DEST_ADDR_TYPE_NONE;
-}
-
-static uint8_t src_addr_size_get(const uint8_t * p_frame)
-{
-    switch (p_frame[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK)
-    {
-        case SRC_ADDR_TYPE_NONE:
-            return 0;
+/** Bit of the layout table index that holds the PAN ID Compression bit of the FCF. */
+#define LAYOUT_PANID_COMPR_BIT  0x02
+
+/** Mask of bits of the second FCF octet that determine the layout of the addressing fields. */
+#define LAYOUT_FCF_MASK         (DSN_SUPPRESS_BIT | DEST_ADDR_TYPE_MASK | FRAME_VERSION_MASK | \
+                                 SRC_ADDR_TYPE_MASK)
+
+/** Number of entries in the layout table. */
+#define LAYOUT_TABLE_SIZE       256
+
+#define INVALID                 NRF_802154_FRAME_PARSER_INVALID_OFFSET
+
+// FCF fields extracted from the layout table index.
+#define L_DSN_SUPPRESS(i)       (((i) & DSN_SUPPRESS_BIT) != 0)
+#define L_PANID_COMPR(i)        (((i) & LAYOUT_PANID_COMPR_BIT) != 0)
+#define L_VERSION_2015(i)       (((i) & FRAME_VERSION_MASK) >= FRAME_VERSION_2)
+#define L_DST_PRESENT(i)        (((i) & DEST_ADDR_TYPE_MASK) != DEST_ADDR_TYPE_NONE)
+#define L_SRC_PRESENT(i)        (((i) & SRC_ADDR_TYPE_MASK) != SRC_ADDR_TYPE_NONE)
+#define L_DST_EXTENDED(i)       (((i) & DEST_ADDR_TYPE_MASK) == DEST_ADDR_TYPE_EXTENDED)
+#define L_SRC_EXTENDED(i)       (((i) & SRC_ADDR_TYPE_MASK) == SRC_ADDR_TYPE_EXTENDED)
+
+#define L_DST_ADDR_SIZE(i)                                                     \
+    (((i) & DEST_ADDR_TYPE_MASK) == DEST_ADDR_TYPE_NONE ? 0 :                  \
+     ((i) & DEST_ADDR_TYPE_MASK) == DEST_ADDR_TYPE_SHORT ? SHORT_ADDRESS_SIZE : \
+     ((i) & DEST_ADDR_TYPE_MASK) == DEST_ADDR_TYPE_EXTENDED ? EXTENDED_ADDRESS_SIZE : INVALID)
+
+#define L_SRC_ADDR_SIZE(i)                                                   \
+    (((i) & SRC_ADDR_TYPE_MASK) == SRC_ADDR_TYPE_NONE ? 0 :                  \
+     ((i) & SRC_ADDR_TYPE_MASK) == SRC_ADDR_TYPE_SHORT ? SHORT_ADDRESS_SIZE : \
+     ((i) & SRC_ADDR_TYPE_MASK) == SRC_ADDR_TYPE_EXTENDED ? EXTENDED_ADDRESS_SIZE : INVALID)
+
+// Offset of the first addressing field. DSN can be suppressed only in 2015 frames.
+#define L_ADDRESSING_OFFSET(i)                                          \
+    ((L_VERSION_2015(i) && L_DSN_SUPPRESS(i)) ? (PHR_SIZE + FCF_SIZE) : \
+     (PHR_SIZE + FCF_SIZE + DSN_SIZE))
+
+// PAN ID presence rules. See IEEE 802.15.4-2015: 7.2.1.5, Table 7-2.
+#define L_DST_PANID_PRESENT(i)                                             \
+    (!L_VERSION_2015(i) ? L_DST_PRESENT(i) :                               \
+     (L_DST_EXTENDED(i) && L_SRC_EXTENDED(i)) ? !L_PANID_COMPR(i) :        \
+     (L_SRC_PRESENT(i) && L_DST_PRESENT(i)) ? 1 :                          \
+     L_SRC_PRESENT(i) ? 0 :                                                \
+     L_DST_PRESENT(i) ? !L_PANID_COMPR(i) : L_PANID_COMPR(i))
+
+#define L_SRC_PANID_PRESENT(i)                                          \
+    (!L_VERSION_2015(i) ? (L_SRC_PRESENT(i) && !L_PANID_COMPR(i)) :     \
+     (L_DST_EXTENDED(i) && L_SRC_EXTENDED(i)) ? 0 :                     \
+     L_SRC_PRESENT(i) ? !L_PANID_COMPR(i) : 0)
+
+#define L_DST_PANID_OFFSET(i)   (L_DST_PANID_PRESENT(i) ? L_ADDRESSING_OFFSET(i) : 0)
+
+#define L_DST_PANID_END(i) \
+    (L_ADDRESSING_OFFSET(i) + (L_DST_PANID_PRESENT(i) ? PAN_ID_SIZE : 0))
+
+#define L_DST_ADDR_OFFSET(i)    (L_DST_PRESENT(i) ? L_DST_PANID_END(i) : 0)
+
+#define L_DST_ADDR_END(i) \
+    ((L_DST_ADDR_SIZE(i) == INVALID) ? INVALID : (L_DST_PANID_END(i) + L_DST_ADDR_SIZE(i)))
+
+#define L_SRC_PANID_OFFSET(i)                         \
+    (L_SRC_PANID_PRESENT(i) ? L_DST_ADDR_END(i) :     \
+     L_DST_PANID_PRESENT(i) ? L_DST_PANID_OFFSET(i) : 0)
+
+#define L_SRC_PANID_END(i)                              \
+    (!L_SRC_PANID_PRESENT(i) ? L_DST_ADDR_END(i) :      \
+     (L_DST_ADDR_END(i) == INVALID) ? INVALID :         \
+     (L_DST_ADDR_END(i) + PAN_ID_SIZE))
+
+#define L_SRC_ADDR_OFFSET(i)    (L_SRC_PRESENT(i) ? L_SRC_PANID_END(i) : 0)
+
+#define L_ADDRESSING_END(i)                                                         \
+    (((L_SRC_PANID_END(i) == INVALID) || (L_SRC_ADDR_SIZE(i) == INVALID)) ? INVALID : \
+     (L_SRC_PANID_END(i) + L_SRC_ADDR_SIZE(i)))
+
+#define LAYOUT(i)                                       \
+    {                                                   \
+        .dst_panid_offset      = L_DST_PANID_OFFSET(i), \
+        .dst_addr_offset       = L_DST_ADDR_OFFSET(i),  \
+        .dst_addr_size         = L_DST_ADDR_SIZE(i),    \
+        .dst_addr_end_offset   = L_DST_ADDR_END(i),     \
+        .src_panid_offset      = L_SRC_PANID_OFFSET(i), \
+        .src_addr_offset       = L_SRC_ADDR_OFFSET(i),  \
+        .src_addr_size         = L_SRC_ADDR_SIZE(i),    \
+        .addressing_end_offset = L_ADDRESSING_END(i),   \
+    }
+
+#define LAYOUT_4(i)   LAYOUT((i) + 0), LAYOUT((i) + 1), LAYOUT((i) + 2), LAYOUT((i) + 3)
+#define LAYOUT_16(i)  LAYOUT_4((i) + 0), LAYOUT_4((i) + 4), LAYOUT_4((i) + 8), LAYOUT_4((i) + 12)
+#define LAYOUT_64(i)  LAYOUT_16((i) + 0), LAYOUT_16((i) + 16), LAYOUT_16((i) + 32), \
+    LAYOUT_16((i) + 48)
+#define LAYOUT_256(i) LAYOUT_64((i) + 0), LAYOUT_64((i) + 64), LAYOUT_64((i) + 128), \
+    LAYOUT_64((i) + 192)
 
-        case SRC_ADDR_TYPE_SHORT:
-            return SHORT_ADDRESS_SIZE;
-
-        case SRC_ADDR_TYPE_EXTENDED:
-            return EXTENDED_ADDRESS_SIZE;
-
-        default:
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-    }
-}
-
-static uint8_t dst_addr_size_get(const uint8_t * p_frame)
-{
-    switch (p_frame[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK)
-    {
-        case DEST_ADDR_TYPE_NONE:
-            return 0;
-
-        case DEST_ADDR_TYPE_SHORT:
-            return SHORT_ADDRESS_SIZE;
-
-        case DEST_ADDR_TYPE_EXTENDED:
-            return EXTENDED_ADDRESS_SIZE;
-
-        default:
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-    }
-}
-
-// PAN ID
-static bool dst_panid_is_present(const uint8_t * p_frame)
+/**
+ * @brief Layout of the addressing fields for every combination of relevant FCF bits.
+ *
+ * The table is indexed by the second octet of the FCF (DSN suppression, destination addressing
+ * mode, frame version and source addressing mode), with the IE Present bit replaced by the
+ * PAN ID Compression bit. It is generated by the preprocessor, so decoding the MHR layout of
+ * a frame requires a single table load instead of evaluating addressing rules on every call.
+ */
+static const nrf_802154_frame_parser_layout_t m_layout_table[LAYOUT_TABLE_SIZE] =
 {
-    bool panid_compression = (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) ? true : false;
+    LAYOUT_256(0)
+};
 
-    switch (frame_version_get(p_frame))
-    {
-        case FRAME_VERSION_0:
-        case FRAME_VERSION_1:
-            if (!dst_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            return true;
-
-        case FRAME_VERSION_2:
-        default:
-            if (nrf_802154_frame_parser_dst_addr_is_extended(p_frame) &&
-                nrf_802154_frame_parser_src_addr_is_extended(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (src_addr_is_present(p_frame) && dst_addr_is_present(p_frame))
-            {
-                return true;
-            }
-
-            if (src_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            if (dst_addr_is_present(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            return panid_compression ? true : false;
-    }
-}
+/***************************************************************************************************
+ * @section Helper functions
+ **************************************************************************************************/
 
-static bool src_panid_is_present(const uint8_t * p_frame)
+static inline const nrf_802154_frame_parser_layout_t * layout_get(const uint8_t * p_frame)
 {
-    bool panid_compression = (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) ? true : false;
-
-    switch (frame_version_get(p_frame))
-    {
-        case FRAME_VERSION_0:
-        case FRAME_VERSION_1:
-            if (!src_addr_is_present(p_frame))
-            {
-                return false;
-            }
+    uint8_t index = (p_frame[DEST_ADDR_TYPE_OFFSET] & LAYOUT_FCF_MASK) |
+                    ((p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) >> 5);
 
-            return panid_compression ? false : true;
-
-        case FRAME_VERSION_2:
-        default:
-            if (nrf_802154_frame_parser_dst_addr_is_extended(p_frame) &&
-                nrf_802154_frame_parser_src_addr_is_extended(p_frame))
-            {
-                return false;
-            }
-
-            if (src_addr_is_present(p_frame) && dst_addr_is_present(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (src_addr_is_present(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (dst_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            return false;
-    }
+    return &m_layout_table[index];
 }
 
-static bool src_panid_is_compressed(const uint8_t * p_frame)
+static inline const uint8_t * field_get(const uint8_t * p_frame, uint8_t offset)
 {
-    return dst_panid_is_present(p_frame) && !src_panid_is_present(p_frame);
+    return (0 == offset) ? NULL : &p_frame[offset];
 }
 
 // Security
@@ -217,49 +183,7 @@ static bool security_is_enabled(const uint8_t * p_frame)
 
 static uint8_t security_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_frame);
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    uint8_t dst_addr_size    = dst_addr_size_get(p_frame);
-    uint8_t src_addr_offset  = nrf_802154_frame_parser_src_addr_offset_get(p_frame);
-    uint8_t src_panid_offset = nrf_802154_frame_parser_src_panid_offset_get(p_frame);
-    uint8_t src_addr_size    = src_addr_size_get(p_frame);
-
-    if (src_addr_is_present(p_frame))
-    {
-        if ((src_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
-            (src_addr_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET))
-        {
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-        }
-
-        return src_addr_offset + src_addr_size;
-    }
-    else if (src_panid_is_present(p_frame))
-    {
-        if (src_panid_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-        }
-
-        return src_panid_offset + PAN_ID_SIZE;
-    }
-    else if (dst_addr_offset)
-    {
-        if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-        }
-
-        return dst_addr_offset + dst_addr_size;
-    }
-    else if (dst_panid_offset)
-    {
-        return dst_panid_offset + PAN_ID_SIZE;
-    }
-    else
-    {
-        return addressing_offset_get(p_frame);
-    }
+    return layout_get(p_frame)->addressing_end_offset;
 }
 
 static uint8_t key_id_size_get(const uint8_t * p_frame)
@@ -352,129 +276,35 @@ bool nrf_802154_frame_parser_ar_bit_is_set(const uint8_t * p_frame)
  * @section Offset functions
  **************************************************************************************************/
 
+const nrf_802154_frame_parser_layout_t * nrf_802154_frame_parser_layout_get(
+    const uint8_t * p_frame)
+{
+    return layout_get(p_frame);
+}
+
 uint8_t nrf_802154_frame_parser_dst_panid_offset_get(const uint8_t * p_frame)
 {
-    if (dst_panid_is_present(p_frame))
-    {
-        return addressing_offset_get(p_frame);
-    }
-    else
-    {
-        return 0;
-    }
+    return layout_get(p_frame)->dst_panid_offset;
 }
 
 uint8_t nrf_802154_frame_parser_dst_addr_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-
-    if (dst_addr_is_present(p_frame))
-    {
-        return 0 ==
-               dst_panid_offset ? addressing_offset_get(p_frame) : dst_panid_offset + PAN_ID_SIZE;
-    }
-    else
-    {
-        return 0;
-    }
+    return layout_get(p_frame)->dst_addr_offset;
 }
 
 uint8_t nrf_802154_frame_parser_dst_addr_end_offset_get(const uint8_t * p_frame)
 {
-    uint8_t offset        = addressing_offset_get(p_frame);
-    uint8_t dst_addr_size = dst_addr_size_get(p_frame);
-
-    if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-    {
-        return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-    }
-
-    if (dst_panid_is_present(p_frame))
-    {
-        offset += PAN_ID_SIZE;
-    }
-
-    offset += dst_addr_size;
-
-    return offset;
+    return layout_get(p_frame)->dst_addr_end_offset;
 }
 
 uint8_t nrf_802154_frame_parser_src_panid_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_frame);
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    uint8_t dst_addr_size    = dst_addr_size_get(p_frame);
-
-    if (src_panid_is_present(p_frame))
-    {
-        if (dst_addr_offset)
-        {
-            if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-            {
-                return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-            }
-
-            return dst_addr_offset + dst_addr_size;
-        }
-        else if (dst_panid_offset)
-        {
-            return dst_panid_offset + PAN_ID_SIZE;
-        }
-        else
-        {
-            return addressing_offset_get(p_frame);
-        }
-    }
-    else if (src_panid_is_compressed(p_frame))
-    {
-        return nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    }
-    else
-    {
-        return 0;
-    }
+    return layout_get(p_frame)->src_panid_offset;
 }
 
 uint8_t nrf_802154_frame_parser_src_addr_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_frame);
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    uint8_t dst_addr_size    = dst_addr_size_get(p_frame);
-    uint8_t src_panid_offset = nrf_802154_frame_parser_src_panid_offset_get(p_frame);
-
-    if (src_addr_is_present(p_frame))
-    {
-        if (src_panid_is_present(p_frame))
-        {
-            if (src_panid_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-            {
-                return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-            }
-
-            return src_panid_offset + PAN_ID_SIZE;
-        }
-        else if (dst_addr_offset)
-        {
-            if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-            {
-                return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-            }
-
-            return dst_addr_offset + dst_addr_size;
-        }
-        else if (dst_panid_offset)
-        {
-            return dst_panid_offset + PAN_ID_SIZE;
-        }
-        else
-        {
-            return addressing_offset_get(p_frame);
-        }
-    }
-    else
-    {
-        return 0;
-    }
+    return layout_get(p_frame)->src_addr_offset;
 }
 
 uint8_t nrf_802154_frame_parser_addressing_end_offset_get(const uint8_t * p_frame)
@@ -587,73 +417,27 @@ const uint8_t * nrf_802154_frame_parser_src_addr_get(const uint8_t * p_frame,
 bool nrf_802154_frame_parser_mhr_parse(const uint8_t                      * p_frame,
                                        nrf_802154_frame_parser_mhr_data_t * p_fields)
 {
-    uint8_t offset               = addressing_offset_get(p_frame);
-    bool    is_dst_panid_present = dst_panid_is_present(p_frame);
-    bool    is_src_panid_present = src_panid_is_present(p_frame);
+    const nrf_802154_frame_parser_layout_t * p_layout = layout_get(p_frame);
 
-    if (is_dst_panid_present)
+    if ((p_layout->dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
+        (p_layout->src_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET))
     {
-        p_fields->p_dst_panid = &p_frame[offset];
-        offset               += PAN_ID_SIZE;
-    }
-    else
-    {
-        p_fields->p_dst_panid = NULL;
+        return false;
     }
 
-    if (dst_addr_is_present(p_frame))
-    {
-        p_fields->p_dst_addr    = &p_frame[offset];
-        p_fields->dst_addr_size = dst_addr_size_get(p_frame);
-        offset                 += (p_fields->dst_addr_size);
+    p_fields->p_dst_panid = field_get(p_frame, p_layout->dst_panid_offset);
+    p_fields->p_dst_addr  = field_get(p_frame, p_layout->dst_addr_offset);
+    p_fields->p_src_panid = field_get(p_frame, p_layout->src_panid_offset);
+    p_fields->p_src_addr  = field_get(p_frame, p_layout->src_addr_offset);
 
-        if (p_fields->dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return false;
-        }
-    }
-    else
-    {
-        p_fields->p_dst_addr    = NULL;
-        p_fields->dst_addr_size = 0;
-    }
-
-    if (is_src_panid_present)
-    {
-        p_fields->p_src_panid = &p_frame[offset];
-        offset               += PAN_ID_SIZE;
-    }
-    else if (is_dst_panid_present)
-    {
-        p_fields->p_src_panid = p_fields->p_dst_panid;
-    }
-    else
-    {
-        p_fields->p_src_panid = NULL;
-    }
-
-    if (src_addr_is_present(p_frame))
-    {
-        p_fields->p_src_addr    = &p_frame[offset];
-        p_fields->src_addr_size = src_addr_size_get(p_frame);
-        offset                 += (p_fields->src_addr_size);
-
-        if (p_fields->src_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return false;
-        }
-    }
-    else
-    {
-        p_fields->p_src_addr    = NULL;
-        p_fields->src_addr_size = 0;
-    }
+    p_fields->dst_addr_size = p_layout->dst_addr_size;
+    p_fields->src_addr_size = p_layout->src_addr_size;
 
-    p_fields->addressing_end_offset = offset;
+    p_fields->addressing_end_offset = p_layout->addressing_end_offset;
 
     if (security_is_enabled(p_frame))
     {
-        p_fields->p_sec_ctrl = &p_frame[offset];
+        p_fields->p_sec_ctrl = &p_frame[p_layout->addressing_end_offset];
         // TODO increment offset...
     }
     else
@@ -60,6 +60,40 @@ typedef struct
     uint8_t         addressing_end_offset; ///< Offset of the first byte following addressing fields.
 } nrf_802154_frame_parser_mhr_data_t;
 
+/**
+ * @brief Structure that describes the layout of MHR addressing fields.
+ *
+ * The layout of the addressing fields is fully determined by the Frame Control Field, so the
+ * driver keeps a constant table of these structures indexed by the relevant FCF bits.
+ * All offsets include one byte of the frame length. Offsets of fields that are not present
+ * are equal to zero. Values that cannot be determined because the FCF contains a reserved
+ * addressing mode are equal to @ref NRF_802154_FRAME_PARSER_INVALID_OFFSET.
+ */
+typedef struct
+{
+    uint8_t dst_panid_offset;      ///< Offset of the destination PAN ID field.
+    uint8_t dst_addr_offset;       ///< Offset of the destination address field.
+    uint8_t dst_addr_size;         ///< Size of the destination address field.
+    uint8_t dst_addr_end_offset;   ///< Offset of the first byte following destination addressing fields.
+    uint8_t src_panid_offset;      ///< Offset of the source PAN ID field, or destination PAN ID if compressed.
+    uint8_t src_addr_offset;       ///< Offset of the source address field.
+    uint8_t src_addr_size;         ///< Size of the source address field.
+    uint8_t addressing_end_offset; ///< Offset of the first byte following addressing fields.
+} nrf_802154_frame_parser_layout_t;
+
+/**
+ * @brief Gets the layout of the addressing fields of the provided frame.
+ *
+ * This function reads only the Frame Control Field of the frame, so it can be used as soon as
+ * the PHR and the FCF are received.
+ *
+ * @param[in]   p_frame  Pointer to a frame.
+ *
+ * @returns  Pointer to a constant structure describing the addressing fields of @p p_frame.
+ */
+const nrf_802154_frame_parser_layout_t * nrf_802154_frame_parser_layout_get(
+    const uint8_t * p_frame);
+
 /**
  * @brief Determines if the destination address is extended.
  *
@@ -47,9 +47,11 @@
 #include <stdint.h>
 
 #include "../nrf_802154_debug.h"
+#include "nrf_802154_core_hooks.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
+#include "mac_features/nrf_802154_tx_queue.h"
 #include "timer/nrf_802154_timer_sched.h"
 
 #if NRF_802154_ACK_TIMEOUT_ENABLED
@@ -68,10 +70,48 @@ static void notify_tx_error(bool result)
 {
     if (result)
     {
-        nrf_802154_notify_transmit_failed(mp_frame, NRF_802154_TX_ERROR_NO_ACK);
+        // Missing ACK is processed by the TX failed hooks like the failures detected by the Core,
+        // so that the features that react to it, like retransmission, see it.
+        if (nrf_802154_core_hooks_tx_failed(mp_frame, NRF_802154_TX_ERROR_NO_ACK))
+        {
+            nrf_802154_notify_transmit_failed(mp_frame, NRF_802154_TX_ERROR_NO_ACK);
+        }
+
+#if NRF_802154_TX_QUEUE_SIZE
+        nrf_802154_tx_queue_tx_failed_notified();
+#endif
     }
 }
 
+/**
+ * @brief Stops waiting for ACK.
+ *
+ * If frames from the TX queue are being transmitted, the driver continues with the next queued
+ * frame. Otherwise, it enters the receive state.
+ *
+ * @retval  true   The request was accepted.
+ * @retval  false  The request cannot be performed at the moment.
+ */
+static bool ack_wait_stop(void)
+{
+#if NRF_802154_TX_QUEUE_SIZE
+    if (nrf_802154_tx_queue_is_running())
+    {
+        return nrf_802154_request_tx_queue_transmit(NRF_802154_TERM_802154,
+                                                    REQ_ORIG_ACK_TIMEOUT,
+                                                    NULL,
+                                                    false,
+                                                    notify_tx_error);
+    }
+#endif
+
+    return nrf_802154_request_receive(NRF_802154_TERM_802154,
+                                      REQ_ORIG_ACK_TIMEOUT,
+                                      notify_tx_error,
+                                      false,
+                                      NRF_802154_RESERVED_IMM_RX_WINDOW_ID);
+}
+
 static void timeout_timer_fired(void * p_context)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -80,11 +120,7 @@ static void timeout_timer_fired(void * p_context)
 
     if (m_procedure_is_active)
     {
-        if (nrf_802154_request_receive(NRF_802154_TERM_802154,
-                                       REQ_ORIG_ACK_TIMEOUT,
-                                       notify_tx_error,
-                                       false,
-                                       NRF_802154_RESERVED_IMM_RX_WINDOW_ID))
+        if (ack_wait_stop())
         {
             m_procedure_is_active = false;
         }
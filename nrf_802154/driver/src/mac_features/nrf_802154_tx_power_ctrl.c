@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the adaptive transmit power feature of the 802.15.4 driver.
+ *
+ * Destinations are stored in a small table searched linearly. When the table is full,
+ * the destination that was not used for the longest time is replaced.
+ *
+ */
+
+#include "nrf_802154_tx_power_ctrl.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if NRF_802154_TX_POWER_CTRL_TABLE_SIZE
+
+#define EWMA_FRAC_BITS 4U  ///< Number of fractional bits of the averaged values.
+#define EWMA_SHIFT     3U  ///< Each new sample contributes 1/2^EWMA_SHIFT to the average.
+#define BOOST_STEP     3U  ///< Transmit power increase after a missing ACK [dB].
+#define BOOST_MAX      30U ///< Maximum accumulated transmit power increase [dB].
+
+/** Internal representation of a destination. */
+typedef struct
+{
+    uint8_t  addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the destination, zero-padded for a short address.
+    bool     extended;                    ///< Whether @ref addr holds an extended address.
+    bool     averages_valid;              ///< Whether at least one RSSI and LQI sample was collected.
+    uint8_t  boost;                       ///< Transmit power increase caused by missing ACKs [dB].
+    int16_t  rssi_avg;                    ///< Averaged RSSI with EWMA_FRAC_BITS fractional bits.
+    uint16_t lqi_avg;                     ///< Averaged LQI with EWMA_FRAC_BITS fractional bits.
+    uint32_t last_used;                   ///< Value of @ref m_use_counter when the entry was last used.
+} destination_t;
+
+static destination_t m_destinations[NRF_802154_TX_POWER_CTRL_TABLE_SIZE]; ///< Table of destinations.
+static uint8_t       m_destinations_count;                                ///< Number of used entries.
+static uint32_t      m_use_counter;                                       ///< Counter of entry accesses.
+
+/**
+ * @brief Finds the entry of the given destination.
+ *
+ * @param[in]  p_addr    Pointer to the address of the destination.
+ * @param[in]  extended  Whether @p p_addr points to an extended address.
+ * @param[in]  create    Whether to create the entry if it does not exist.
+ *
+ * @returns  Pointer to the entry, or NULL if it does not exist and @p create is false.
+ */
+static destination_t * destination_get(const uint8_t * p_addr, bool extended, bool create)
+{
+    uint8_t         size     = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    destination_t * p_oldest = &m_destinations[0];
+    destination_t * p_dst;
+
+    for (uint8_t i = 0; i < m_destinations_count; i++)
+    {
+        p_dst = &m_destinations[i];
+
+        if ((p_dst->extended == extended) && (0 == memcmp(p_dst->addr, p_addr, size)))
+        {
+            p_dst->last_used = m_use_counter++;
+            return p_dst;
+        }
+
+        if ((m_use_counter - p_dst->last_used) > (m_use_counter - p_oldest->last_used))
+        {
+            p_oldest = p_dst;
+        }
+    }
+
+    if (!create)
+    {
+        return NULL;
+    }
+
+    if (m_destinations_count < NRF_802154_TX_POWER_CTRL_TABLE_SIZE)
+    {
+        p_dst = &m_destinations[m_destinations_count++];
+    }
+    else
+    {
+        p_dst = p_oldest;
+    }
+
+    memset(p_dst, 0, sizeof(*p_dst));
+    memcpy(p_dst->addr, p_addr, size);
+    p_dst->extended  = extended;
+    p_dst->last_used = m_use_counter++;
+
+    return p_dst;
+}
+
+/** Update averaged RSSI and LQI of the destination with a new sample. */
+static void averages_update(destination_t * p_dst, int8_t rssi, uint8_t lqi)
+{
+    int32_t rssi_sample = (int32_t)rssi * (1L << EWMA_FRAC_BITS);
+    int32_t lqi_sample  = (int32_t)lqi * (1L << EWMA_FRAC_BITS);
+
+    if (p_dst->averages_valid)
+    {
+        p_dst->rssi_avg += (int16_t)((rssi_sample - p_dst->rssi_avg) / (1L << EWMA_SHIFT));
+        p_dst->lqi_avg   = (uint16_t)((int32_t)p_dst->lqi_avg +
+                                      (lqi_sample - (int32_t)p_dst->lqi_avg) / (1L << EWMA_SHIFT));
+    }
+    else
+    {
+        p_dst->rssi_avg       = (int16_t)rssi_sample;
+        p_dst->lqi_avg        = (uint16_t)lqi_sample;
+        p_dst->averages_valid = true;
+    }
+}
+
+/** Update averages of the device with the given address, creating its entry if necessary. */
+static void link_update(const uint8_t * p_addr, bool extended, int8_t rssi, uint8_t lqi, bool acked)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    destination_t * p_dst = destination_get(p_addr, extended, true);
+
+    averages_update(p_dst, rssi, lqi);
+
+    if (acked && (p_dst->boost > 0))
+    {
+        p_dst->boost--;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+uint8_t nrf_802154_tx_power_ctrl_attenuation_get(const uint8_t * p_frame)
+{
+    bool                            extended;
+    const uint8_t                 * p_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &extended);
+    int32_t                         attenuation = 0;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if ((p_addr == NULL) ||
+        (!extended && (0 == memcmp(p_addr, BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE))))
+    {
+        return 0;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    destination_t * p_dst = destination_get(p_addr, extended, false);
+
+    if ((p_dst != NULL) && p_dst->averages_valid &&
+        (p_dst->lqi_avg >= (NRF_802154_TX_POWER_CTRL_LQI_MIN << EWMA_FRAC_BITS)))
+    {
+        // The destination receives this device with the RSSI it is received with, so the power
+        // can be reduced by everything above the sensitivity and the required margin.
+        attenuation = (p_dst->rssi_avg >> EWMA_FRAC_BITS) - NRF_802154_TX_POWER_CTRL_SENSITIVITY -
+                      NRF_802154_TX_POWER_CTRL_MARGIN - (int32_t)p_dst->boost;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (attenuation < 0)
+    {
+        attenuation = 0;
+    }
+    else if (attenuation > NRF_802154_TX_POWER_CTRL_MAX_ATTENUATION)
+    {
+        attenuation = NRF_802154_TX_POWER_CTRL_MAX_ATTENUATION;
+    }
+
+    return (uint8_t)attenuation;
+}
+
+void nrf_802154_tx_power_ctrl_rx_frame_update(const uint8_t * p_frame, int8_t rssi, uint8_t lqi)
+{
+    bool            extended;
+    const uint8_t * p_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &extended);
+
+    if (p_addr != NULL)
+    {
+        link_update(p_addr, extended, rssi, lqi, false);
+    }
+}
+
+void nrf_802154_tx_power_ctrl_ack_update(const uint8_t * p_frame, int8_t rssi, uint8_t lqi)
+{
+    bool            extended;
+    const uint8_t * p_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &extended);
+
+    if (p_addr != NULL)
+    {
+        link_update(p_addr, extended, rssi, lqi, true);
+    }
+}
+
+bool nrf_802154_tx_power_ctrl_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    bool            extended;
+    const uint8_t * p_addr;
+
+    if ((error != NRF_802154_TX_ERROR_NO_ACK) && (error != NRF_802154_TX_ERROR_INVALID_ACK))
+    {
+        return true;
+    }
+
+    p_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &extended);
+
+    if (p_addr != NULL)
+    {
+        nrf_802154_mcu_critical_state_t mcu_cs;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        destination_t * p_dst = destination_get(p_addr, extended, false);
+
+        if (p_dst != NULL)
+        {
+            p_dst->boost = (p_dst->boost + BOOST_STEP > BOOST_MAX) ? BOOST_MAX :
+                           (p_dst->boost + BOOST_STEP);
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_TX_POWER_CTRL_TABLE_SIZE
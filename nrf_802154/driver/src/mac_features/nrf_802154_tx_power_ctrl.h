@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_TX_POWER_CTRL_H__
+#define NRF_802154_TX_POWER_CTRL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_tx_power_ctrl 802.15.4 driver adaptive transmit power support
+ * @{
+ * @ingroup nrf_802154
+ * @brief Per-destination adaptation of the transmit power.
+ *
+ * The averaged RSSI and LQI of frames and ACKs received from a destination estimate the path
+ * loss to it, assuming that the destination transmits with the same power as this device.
+ * Frames are sent with the transmit power reduced by the part of the link margin that exceeds
+ * @ref NRF_802154_TX_POWER_CTRL_MARGIN. Each missing or invalid ACK raises the power for the
+ * destination by a fixed step. The step is taken back one dB per received ACK.
+ */
+
+#if NRF_802154_TX_POWER_CTRL_TABLE_SIZE
+
+/**
+ * @brief Gets the reduction of the transmit power for the destination of a frame.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame that is to be
+ *                      transmitted.
+ *
+ * @returns  Number of dB by which the transmit power is to be reduced.
+ */
+uint8_t nrf_802154_tx_power_ctrl_attenuation_get(const uint8_t * p_frame);
+
+/**
+ * @brief Updates the link estimate of the device which sent the received frame.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the received frame.
+ * @param[in]  rssi     RSSI of the received frame in dBm.
+ * @param[in]  lqi      LQI of the received frame.
+ */
+void nrf_802154_tx_power_ctrl_rx_frame_update(const uint8_t * p_frame, int8_t rssi, uint8_t lqi);
+
+/**
+ * @brief Updates the link estimate of the destination which acknowledged the transmitted frame.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the transmitted frame.
+ * @param[in]  rssi     RSSI of the received ACK in dBm.
+ * @param[in]  lqi      LQI of the received ACK.
+ */
+void nrf_802154_tx_power_ctrl_ack_update(const uint8_t * p_frame, int8_t rssi, uint8_t lqi);
+
+/**
+ * @brief Handles a TX failed event.
+ *
+ * Raises the transmit power for the destination of a frame that was not acknowledged.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
+ *                      that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true  TX failed event is to be propagated to the MAC layer.
+ */
+bool nrf_802154_tx_power_ctrl_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+#else // NRF_802154_TX_POWER_CTRL_TABLE_SIZE
+
+#define nrf_802154_tx_power_ctrl_rx_frame_update(p_frame, rssi, lqi)
+#define nrf_802154_tx_power_ctrl_ack_update(p_frame, rssi, lqi)
+
+#endif // NRF_802154_TX_POWER_CTRL_TABLE_SIZE
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_TX_POWER_CTRL_H__
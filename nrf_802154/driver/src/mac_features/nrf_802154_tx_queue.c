@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the TX queue of the 802.15.4 radio driver.
+ *
+ */
+
+#include "nrf_802154_tx_queue.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_queue.h"
+
+#if NRF_802154_TX_QUEUE_SIZE
+
+/// Frame waiting in the TX queue.
+typedef struct
+{
+    const uint8_t * p_data; ///< Pointer to a buffer that contains PHR and PSDU of the frame.
+    bool            cca;    ///< If CCA is to be performed before the transmission.
+} tx_queue_item_t;
+
+static nrf_802154_queue_t    m_queue;                                      ///< Queue of frames to transmit.
+static tx_queue_item_t       m_queue_memory[NRF_802154_TX_QUEUE_SIZE + 1]; ///< Memory of the queue. One item is always unused.
+static volatile bool         m_is_running;                                 ///< Indicates if queued frames are being transmitted.
+static bool                  m_flush_pending;                              ///< Queued frames are to be reported as failed once the current frame is notified.
+static nrf_802154_tx_error_t m_flush_error;                                ///< Error reported for the queued frames when @ref m_flush_pending is set.
+
+/**
+ * @brief Stops the queue and reports all remaining frames as failed.
+ *
+ * @param[in]  error  Error to report.
+ */
+static void queue_flush(nrf_802154_tx_error_t error)
+{
+    m_is_running = false;
+
+    while (!nrf_802154_queue_is_empty(&m_queue))
+    {
+        tx_queue_item_t * p_item = (tx_queue_item_t *)nrf_802154_queue_pop_begin(&m_queue);
+
+        nrf_802154_notify_transmit_failed(p_item->p_data, error);
+        nrf_802154_queue_pop_commit(&m_queue);
+    }
+}
+
+void nrf_802154_tx_queue_init(void)
+{
+    nrf_802154_queue_init(&m_queue,
+                          m_queue_memory,
+                          sizeof(m_queue_memory),
+                          sizeof(m_queue_memory[0]));
+
+    m_is_running    = false;
+    m_flush_pending = false;
+}
+
+void nrf_802154_tx_queue_start(void)
+{
+    m_is_running = true;
+}
+
+bool nrf_802154_tx_queue_is_running(void)
+{
+    return m_is_running;
+}
+
+bool nrf_802154_tx_queue_is_pending(void)
+{
+    if (m_is_running && nrf_802154_queue_is_empty(&m_queue))
+    {
+        m_is_running = false;
+    }
+
+    return m_is_running;
+}
+
+bool nrf_802154_tx_queue_push(const uint8_t * p_data, bool cca)
+{
+    if (nrf_802154_queue_is_full(&m_queue))
+    {
+        return false;
+    }
+
+    tx_queue_item_t * p_item = (tx_queue_item_t *)nrf_802154_queue_push_begin(&m_queue);
+
+    p_item->p_data = p_data;
+    p_item->cca    = cca;
+
+    nrf_802154_queue_push_commit(&m_queue);
+
+    return true;
+}
+
+bool nrf_802154_tx_queue_pop(const uint8_t ** pp_data, bool * p_cca)
+{
+    if (nrf_802154_queue_is_empty(&m_queue))
+    {
+        m_is_running = false;
+        return false;
+    }
+
+    tx_queue_item_t * p_item = (tx_queue_item_t *)nrf_802154_queue_pop_begin(&m_queue);
+
+    *pp_data = p_item->p_data;
+    *p_cca   = p_item->cca;
+
+    nrf_802154_queue_pop_commit(&m_queue);
+
+    return true;
+}
+
+void nrf_802154_tx_queue_terminated(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    // Abort the queue only if requested by the core or the higher layer.
+    if (m_is_running &&
+        (term_lvl >= NRF_802154_TERM_802154) &&
+        ((req_orig == REQ_ORIG_CORE) || (req_orig == REQ_ORIG_HIGHER_LAYER)))
+    {
+        queue_flush(NRF_802154_TX_ERROR_ABORTED);
+    }
+}
+
+bool nrf_802154_tx_queue_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_BUSY_CHANNEL:
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+        case NRF_802154_TX_ERROR_NO_ACK:
+            // The Core module has already continued with the next queued frame.
+            break;
+
+        default:
+            if (m_is_running)
+            {
+                // The frames in the queue are reported after the failed frame is notified.
+                m_is_running    = false;
+                m_flush_pending = true;
+                m_flush_error   = error;
+            }
+            break;
+    }
+
+    return true;
+}
+
+void nrf_802154_tx_queue_tx_failed_notified(void)
+{
+    if (m_flush_pending)
+    {
+        m_flush_pending = false;
+        queue_flush(m_flush_error);
+    }
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE
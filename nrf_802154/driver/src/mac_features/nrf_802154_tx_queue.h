@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that contains the TX queue of the 802.15.4 radio driver.
+ *
+ * Frames added to the TX queue are transmitted back-to-back. When the transmission procedure of
+ * a queued frame ends, the Core module starts the next queued frame directly, without entering
+ * the receive state and without waiting for the higher layer to handle the notification of the
+ * previous frame.
+ *
+ * All functions of this module except hooks are to be called from the Core module, which
+ * serializes the access to the queue with its critical section.
+ *
+ */
+
+#ifndef NRF_802154_TX_QUEUE_H__
+#define NRF_802154_TX_QUEUE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_tx_queue 802.15.4 driver TX queue
+ * @{
+ * @ingroup nrf_802154
+ * @brief TX queue feature.
+ */
+
+/**
+ * @brief Initializes the TX queue.
+ */
+void nrf_802154_tx_queue_init(void);
+
+/**
+ * @brief Starts the TX queue.
+ *
+ * While the queue is running, the Core module transmits the queued frames one after another.
+ * The queue stops when the last frame is popped or when the sequence is aborted.
+ */
+void nrf_802154_tx_queue_start(void);
+
+/**
+ * @brief Checks if the TX queue is running.
+ *
+ * @retval  true   The TX queue is running.
+ * @retval  false  The TX queue is stopped.
+ */
+bool nrf_802154_tx_queue_is_running(void);
+
+/**
+ * @brief Checks if the running TX queue holds a frame to transmit next.
+ *
+ * If the queue is running but empty, it is stopped.
+ *
+ * @retval  true   The queue is running and the next frame is waiting in it.
+ * @retval  false  The queue is stopped.
+ */
+bool nrf_802154_tx_queue_is_pending(void);
+
+/**
+ * @brief Adds a frame at the end of the TX queue.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame to transmit.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before the transmission.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue is full.
+ */
+bool nrf_802154_tx_queue_push(const uint8_t * p_data, bool cca);
+
+/**
+ * @brief Takes the next frame from the TX queue.
+ *
+ * If the queue is empty, it is stopped.
+ *
+ * @param[out]  pp_data  Pointer to the buffer of the next frame to transmit.
+ * @param[out]  p_cca    If the driver is to perform a CCA procedure before the transmission.
+ *
+ * @retval  true   The next frame was taken from the queue.
+ * @retval  false  The queue is empty.
+ */
+bool nrf_802154_tx_queue_pop(const uint8_t ** pp_data, bool * p_cca);
+
+/**
+ * @brief Aborts transmission of the queued frames after the current operation was terminated.
+ *
+ * The Core module calls this function once all abort hooks agreed to terminate the current
+ * operation and the frame in progress was reported, so that the results are notified in the
+ * order of transmission. If the running queue is aborted by the Core module or the higher layer
+ * with a sufficient termination level, all queued frames are reported as failed with
+ * @ref NRF_802154_TX_ERROR_ABORTED.
+ *
+ * @param[in]  term_lvl  Termination level of the request that terminated the operation.
+ * @param[in]  req_orig  Module that originated the request.
+ */
+void nrf_802154_tx_queue_terminated(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Handles a TX failed event.
+ *
+ * Failures that end a single transmission, like a busy channel or an invalid ACK, do not affect
+ * the rest of the queue. Other failures stop the queue. All queued frames are reported as failed
+ * with the same error by @ref nrf_802154_tx_queue_tx_failed_notified.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
+ *                      that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true   TX failed event is to be propagated to the MAC layer.
+ */
+bool nrf_802154_tx_queue_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ * @brief Reports the queued frames as failed after a TX failed event stopped the queue.
+ *
+ * Called once the failure of the frame that stopped the queue was handled by the TX failed hooks
+ * and notified, so that the results are notified in the order of transmission. Does nothing if
+ * the queue was not stopped by @ref nrf_802154_tx_queue_tx_failed_hook.
+ */
+void nrf_802154_tx_queue_tx_failed_notified(void);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_TX_QUEUE_H__
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements automatic retransmission procedure for the 802.15.4 driver.
+ *
+ */
+
+#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_TX_RETRY
+
+#include "nrf_802154_tx_retry.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_debug.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_request.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "platform/nrf_802154_random.h"
+#include "timer/nrf_802154_timer_sched.h"
+
+#if NRF_802154_TX_RETRY_ENABLED
+
+static uint8_t            m_max_frame_retries = NRF_802154_TX_RETRY_MAX_FRAME_RETRIES_DEFAULT; ///< Maximum number of retransmissions of a frame.
+static uint8_t            m_backoff_exponent  = NRF_802154_TX_RETRY_BACKOFF_EXPONENT_DEFAULT;  ///< Backoff exponent used before a retransmission.
+static uint8_t            m_attempts;                                                          ///< Number of transmission attempts of the current frame.
+static uint8_t            m_last_attempts;                                                     ///< Number of transmission attempts of the frame that finished most recently.
+static const uint8_t    * mp_last_done_frame;                                                  ///< Pointer to a buffer containing PHR and PSDU of the frame that finished most recently.
+static const uint8_t    * mp_frame;                                                            ///< Pointer to a buffer containing PHR and PSDU of the frame being retransmitted.
+static bool               m_cca;                                                               ///< If CCA is to be performed before the retransmission.
+static const uint8_t    * mp_last_frame;                                                       ///< Pointer to a buffer containing PHR and PSDU of the frame most recently requested for transmission.
+static bool               m_last_cca;                                                          ///< If CCA was requested for the frame most recently requested for transmission.
+static volatile bool      m_is_running;                                                        ///< Indicates if the retransmission procedure is running.
+static nrf_802154_timer_t m_timer;                                                             ///< Timer used to delay the retransmission.
+
+static void backoff_start(void);
+
+/**
+ * @brief Stores the number of transmission attempts of a frame that finished.
+ */
+static void attempts_store(const uint8_t * p_frame, uint8_t attempts)
+{
+    mp_last_done_frame = p_frame;
+    m_last_attempts    = attempts;
+}
+
+/**
+ * @brief Increments the number of attempts of the current frame, saturating at UINT8_MAX.
+ */
+static void attempts_increment(void)
+{
+    if (m_attempts < UINT8_MAX)
+    {
+        m_attempts++;
+    }
+}
+
+/**
+ * @brief Checks if the current frame can be retransmitted once more.
+ */
+static bool retry_is_allowed(void)
+{
+    return (m_attempts <= m_max_frame_retries) && (m_attempts < UINT8_MAX);
+}
+
+/**
+ * @brief Stops the retransmission procedure and stores the number of attempts of the frame.
+ */
+static void procedure_stop(void)
+{
+    m_is_running = false;
+    attempts_store(mp_frame, m_attempts);
+
+    nrf_802154_timer_sched_remove(&m_timer, NULL);
+}
+
+/**
+ * @brief Checks if the retransmission procedure handles the given frame.
+ */
+static bool frame_is_handled(const uint8_t * p_frame)
+{
+    return m_is_running && (p_frame == mp_frame);
+}
+
+static void retransmit_result_notify(bool result)
+{
+    if (!result && m_is_running)
+    {
+        // The driver is busy with another operation. The rejected request counts as an attempt,
+        // so that the procedure ends even if the driver stays busy.
+        attempts_increment();
+
+        if (retry_is_allowed())
+        {
+            backoff_start();
+        }
+        else
+        {
+            procedure_stop();
+            nrf_802154_notify_transmit_failed(mp_frame, NRF_802154_TX_ERROR_ABORTED);
+        }
+    }
+}
+
+static void timer_fired(void * p_context)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    (void)p_context;
+
+    if (m_is_running)
+    {
+        (void)nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                          REQ_ORIG_TX_RETRY,
+                                          mp_frame,
+                                          m_cca,
+                                          false,
+                                          retransmit_result_notify);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+/**
+ * @brief Delays the retransmission for random (2^BE - 1) unit backoff periods.
+ */
+static void backoff_start(void)
+{
+    uint8_t backoff_periods = nrf_802154_random_bounded_get(1U << m_backoff_exponent);
+
+    m_timer.callback  = timer_fired;
+    m_timer.p_context = NULL;
+    m_timer.t0        = nrf_802154_timer_sched_time_get();
+    m_timer.dt        = backoff_periods * UNIT_BACKOFF_PERIOD;
+
+    nrf_802154_timer_sched_add(&m_timer, true);
+}
+
+void nrf_802154_tx_retry_max_frame_retries_set(uint8_t max_frame_retries)
+{
+    m_max_frame_retries = max_frame_retries;
+}
+
+uint8_t nrf_802154_tx_retry_max_frame_retries_get(void)
+{
+    return m_max_frame_retries;
+}
+
+void nrf_802154_tx_retry_backoff_exponent_set(uint8_t backoff_exponent)
+{
+    m_backoff_exponent = backoff_exponent;
+}
+
+uint8_t nrf_802154_tx_retry_frame_attempts_get(const uint8_t * p_frame)
+{
+    return (p_frame == mp_last_done_frame) ? m_last_attempts : 1;
+}
+
+bool nrf_802154_tx_retry_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    bool result = true;
+
+    if (!m_is_running || (req_orig == REQ_ORIG_TX_RETRY))
+    {
+        // Ignore if procedure is not running or self-request.
+    }
+    else if (term_lvl >= NRF_802154_TERM_802154)
+    {
+        bool was_running;
+
+        nrf_802154_timer_sched_remove(&m_timer, &was_running);
+
+        if (was_running)
+        {
+            // The frame is not being transmitted now, so the core will not notify its failure.
+            procedure_stop();
+            nrf_802154_notify_transmit_failed(mp_frame, NRF_802154_TX_ERROR_ABORTED);
+        }
+    }
+    else
+    {
+        result = !nrf_802154_timer_sched_is_running(&m_timer);
+    }
+
+    return result;
+}
+
+bool nrf_802154_tx_retry_pretransmission(const uint8_t * p_frame, bool cca, bool immediate)
+{
+    (void)immediate;
+
+    // The transmission may still be rejected by the core, so the procedure is started only when
+    // the first attempt fails.
+    mp_last_frame = p_frame;
+    m_last_cca    = cca;
+
+    return true;
+}
+
+void nrf_802154_tx_retry_transmitted_hook(const uint8_t * p_frame)
+{
+    if (frame_is_handled(p_frame))
+    {
+        attempts_increment();
+        procedure_stop();
+    }
+    else
+    {
+        attempts_store(p_frame, 1);
+    }
+}
+
+bool nrf_802154_tx_retry_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = true;
+    bool retry_allowed;
+
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_NO_ACK:
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+        case NRF_802154_TX_ERROR_BUSY_CHANNEL:
+            retry_allowed = true;
+            break;
+
+        default:
+            retry_allowed = false;
+            break;
+    }
+
+    if (frame_is_handled(p_frame))
+    {
+        attempts_increment();
+    }
+    else if (retry_allowed &&
+             (m_max_frame_retries > 0) &&
+             nrf_802154_frame_parser_ar_bit_is_set(p_frame))
+    {
+        // The first attempt failed. Start the procedure.
+        mp_frame     = p_frame;
+        m_cca        = (p_frame == mp_last_frame) ? m_last_cca : true;
+        m_attempts   = 1;
+        m_is_running = true;
+    }
+    else
+    {
+        // The frame is not retransmitted.
+        attempts_store(p_frame, 1);
+        retry_allowed = false;
+    }
+
+    if (!m_is_running || (p_frame != mp_frame))
+    {
+        // Nothing to do.
+    }
+    else if (retry_allowed && retry_is_allowed())
+    {
+        backoff_start();
+        result = false;
+    }
+    else
+    {
+        procedure_stop();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+#else // NRF_802154_TX_RETRY_ENABLED
+
+uint8_t nrf_802154_tx_retry_frame_attempts_get(const uint8_t * p_frame)
+{
+    (void)p_frame;
+
+    return 1;
+}
+
+#endif // NRF_802154_TX_RETRY_ENABLED
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_TX_RETRY_H__
+#define NRF_802154_TX_RETRY_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_tx_retry 802.15.4 driver automatic retransmission support
+ * @{
+ * @ingroup nrf_802154
+ * @brief Automatic retransmission of frames that were not acknowledged.
+ *
+ * When the transmission of a frame that requests an ACK fails because of a missing or an invalid
+ * ACK or a busy channel, the frame is retransmitted after a random backoff, without notifying
+ * the higher layer. Only the final result is notified.
+ *
+ * A retransmission is performed with a single CCA if CCA was requested for the frame, also when
+ * the frame was transmitted by the CSMA-CA procedure. CSMA-CA is not repeated.
+ */
+
+/**
+ * @brief Sets the maximum number of retransmissions of a frame.
+ *
+ * @param[in]  max_frame_retries  Maximum number of retransmissions. 0 disables the feature.
+ */
+void nrf_802154_tx_retry_max_frame_retries_set(uint8_t max_frame_retries);
+
+/**
+ * @brief Gets the maximum number of retransmissions of a frame.
+ *
+ * @returns  Maximum number of retransmissions.
+ */
+uint8_t nrf_802154_tx_retry_max_frame_retries_get(void);
+
+/**
+ * @brief Sets the backoff exponent used before a retransmission.
+ *
+ * The retransmission is delayed by a random number of unit backoff periods in the range from 0
+ * to (2^@p backoff_exponent - 1).
+ *
+ * @param[in]  backoff_exponent  Backoff exponent.
+ */
+void nrf_802154_tx_retry_backoff_exponent_set(uint8_t backoff_exponent);
+
+/**
+ * @brief Gets the number of transmission attempts of a frame whose transmission just finished.
+ *
+ * This function is intended to be called by the notification module when the end of
+ * the transmission is notified, so that the value is passed in the notification metadata.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the finished frame.
+ *
+ * @returns  Number of transmission attempts, including the first one. 1 if the frame was not
+ *           retransmitted or the feature is disabled.
+ */
+uint8_t nrf_802154_tx_retry_frame_attempts_get(const uint8_t * p_frame);
+
+/**
+ * @brief Aborts the ongoing retransmission procedure.
+ *
+ * If a retransmission is waiting for its backoff to end, it is cancelled and the frame is notified
+ * as failed with @ref NRF_802154_TX_ERROR_ABORTED.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval  true   Retransmission procedure is not running anymore.
+ * @retval  false  Retransmission procedure cannot be stopped because of a too low termination
+ *                 level.
+ */
+bool nrf_802154_tx_retry_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Handles a pre-transmission event.
+ *
+ * Stores whether CCA was requested for the frame, so that its retransmissions are performed
+ * in the same way.
+ *
+ * @param[in]  p_frame    Pointer to a buffer that contains PHR and PSDU of the frame
+ *                        that is to be transmitted.
+ * @param[in]  cca        Whether to start with CCA or not.
+ * @param[in]  immediate  Whether to start sending immediately or not.
+ *
+ * @retval  true   Frame can be sent immediately.
+ */
+bool nrf_802154_tx_retry_pretransmission(const uint8_t * p_frame, bool cca, bool immediate);
+
+/**
+ * @brief Handles a transmitted event.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the transmitted frame.
+ */
+void nrf_802154_tx_retry_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Handles a TX failed event.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
+ *                      that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true   TX failed event is to be propagated to the MAC layer.
+ * @retval  false  TX failed event is not to be propagated to the MAC layer. The frame is
+ *                 retransmitted.
+ */
+bool nrf_802154_tx_retry_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_TX_RETRY_H__
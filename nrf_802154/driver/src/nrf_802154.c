@@ -52,6 +52,7 @@
 #include "nrf_802154_const.h"
 #include "nrf_802154_core.h"
 #include "nrf_802154_critical_section.h"
+#include "nrf_802154_crit_sect_prof.h"
 #include "nrf_802154_debug.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_nrfx_addons.h"
@@ -75,6 +76,8 @@
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "mac_features/nrf_802154_security_pib.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_tx_retry.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 
 #include "nrf_802154_sl_ant_div.h"
@@ -158,6 +161,7 @@ nrf_802154_coex_tx_request_mode_t nrf_802154_coex_tx_request_mode_get(void)
 
 void nrf_802154_temperature_changed(void)
 {
+    nrf_802154_rssi_temperature_update();
     nrf_802154_request_cca_cfg_update();
 }
 
@@ -176,6 +180,51 @@ void nrf_802154_short_address_set(const uint8_t * p_short_address)
     nrf_802154_pib_short_address_set(p_short_address);
 }
 
+bool nrf_802154_pan_context_set(uint8_t context, const nrf_802154_pan_context_t * p_context)
+{
+    bool result = nrf_802154_pib_pan_context_set(context,
+                                                 p_context->pan_id,
+                                                 p_context->short_addr,
+                                                 p_context->extended_addr);
+
+    if (result)
+    {
+        nrf_802154_ack_data_pan_context_src_addr_matching_method_set(context,
+                                                                     p_context->src_addr_match);
+    }
+
+    return result;
+}
+
+bool nrf_802154_pan_context_clear(uint8_t context)
+{
+    return nrf_802154_pib_pan_context_clear(context);
+}
+
+#if NRF_802154_USE_RAW_API
+
+nrf_802154_pan_context_mask_t nrf_802154_pan_contexts_get_raw(const uint8_t * p_data)
+{
+    const rx_buffer_t * p_buffer = (const rx_buffer_t *)p_data;
+
+    assert(p_buffer->free == false);
+
+    return p_buffer->pan_contexts;
+}
+
+#else // NRF_802154_USE_RAW_API
+
+nrf_802154_pan_context_mask_t nrf_802154_pan_contexts_get(const uint8_t * p_data)
+{
+    const rx_buffer_t * p_buffer = (const rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
+
+    assert(p_buffer->free == false);
+
+    return p_buffer->pan_contexts;
+}
+
+#endif // NRF_802154_USE_RAW_API
+
 int8_t nrf_802154_dbm_from_energy_level_calculate(uint8_t energy_level)
 {
     return ED_MIN_DBM + (energy_level / ED_RESULT_FACTOR);
@@ -207,6 +256,7 @@ void nrf_802154_init(void)
     nrf_802154_core_init();
     nrf_802154_clock_init();
     nrf_802154_critical_section_init();
+    nrf_802154_crit_sect_prof_init();
     nrf_802154_debug_init();
     nrf_802154_notification_init();
     nrf_802154_lp_timer_init();
@@ -218,11 +268,15 @@ void nrf_802154_init(void)
     nrf_802154_rsch_init();
     nrf_802154_rx_buffer_init();
     nrf_802154_temperature_init();
+    nrf_802154_rssi_temperature_update();
     nrf_802154_timer_coord_init();
     nrf_802154_timer_sched_init();
 #if NRF_802154_DELAYED_TRX_ENABLED
     nrf_802154_delayed_trx_init();
 #endif
+#if NRF_802154_TX_QUEUE_SIZE
+    nrf_802154_tx_queue_init();
+#endif
 }
 
 void nrf_802154_deinit(void)
@@ -465,6 +519,25 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
 
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_USE_RAW_API && NRF_802154_TX_QUEUE_SIZE
+bool nrf_802154_transmit_raw_enqueue(const uint8_t * p_data, bool cca)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_tx_queue_transmit(NRF_802154_TERM_NONE,
+                                                  REQ_ORIG_HIGHER_LAYER,
+                                                  p_data,
+                                                  cca,
+                                                  NULL);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_USE_RAW_API && NRF_802154_TX_QUEUE_SIZE
+
 #if NRF_802154_DELAYED_TRX_ENABLED
 bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
                                 bool            cca,
@@ -536,6 +609,25 @@ bool nrf_802154_energy_detection(uint32_t time_us)
     return result;
 }
 
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us)
+{
+    bool result = false;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    channel_mask &= NRF_802154_ENERGY_SCAN_CHANNEL_MASK;
+
+    if (channel_mask != 0U)
+    {
+        result = nrf_802154_request_energy_scan(NRF_802154_TERM_NONE,
+                                                channel_mask,
+                                                dwell_time_us);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
 bool nrf_802154_cca(void)
 {
     bool result;
@@ -816,6 +908,25 @@ void nrf_802154_ack_timeout_set(uint32_t time)
 
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+#if NRF_802154_TX_RETRY_ENABLED
+
+void nrf_802154_max_frame_retries_set(uint8_t max_frame_retries)
+{
+    nrf_802154_tx_retry_max_frame_retries_set(max_frame_retries);
+}
+
+uint8_t nrf_802154_max_frame_retries_get(void)
+{
+    return nrf_802154_tx_retry_max_frame_retries_get();
+}
+
+void nrf_802154_retry_backoff_exponent_set(uint8_t backoff_exponent)
+{
+    nrf_802154_tx_retry_backoff_exponent_set(backoff_exponent);
+}
+
+#endif // NRF_802154_TX_RETRY_ENABLED
+
 #if NRF_802154_IFS_ENABLED
 
 nrf_802154_ifs_mode_t nrf_802154_ifs_mode_get(void)
@@ -1004,6 +1115,18 @@ __WEAK void nrf_802154_transmitted_timestamp_raw(const uint8_t * p_frame,
     }
 }
 
+__WEAK void nrf_802154_transmitted_metadata_raw(
+    const uint8_t                             * p_frame,
+    uint8_t                                   * p_ack,
+    int8_t                                      power,
+    uint8_t                                     lqi,
+    const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_metadata;
+
+    nrf_802154_transmitted_raw(p_frame, p_ack, power, lqi);
+}
+
 #else // NRF_802154_USE_RAW_API
 
 __WEAK void nrf_802154_transmitted(const uint8_t * p_frame,
@@ -1036,6 +1159,19 @@ __WEAK void nrf_802154_transmitted_timestamp(const uint8_t * p_frame,
     }
 }
 
+__WEAK void nrf_802154_transmitted_metadata(
+    const uint8_t                             * p_frame,
+    uint8_t                                   * p_ack,
+    uint8_t                                     length,
+    int8_t                                      power,
+    uint8_t                                     lqi,
+    const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_metadata;
+
+    nrf_802154_transmitted(p_frame, p_ack, length, power, lqi);
+}
+
 #endif // NRF_802154_USE_RAW_API
 
 __WEAK void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
@@ -1044,6 +1180,16 @@ __WEAK void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_er
     (void)error;
 }
 
+__WEAK void nrf_802154_transmit_failed_metadata(
+    const uint8_t                             * p_frame,
+    nrf_802154_tx_error_t                       error,
+    const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_metadata;
+
+    nrf_802154_transmit_failed(p_frame, error);
+}
+
 __WEAK void nrf_802154_energy_detected(uint8_t result)
 {
     (void)result;
@@ -1054,6 +1200,12 @@ __WEAK void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
     (void)error;
 }
 
+__WEAK void nrf_802154_energy_scan_done(uint32_t channel_mask, const uint8_t * p_results)
+{
+    (void)channel_mask;
+    (void)p_results;
+}
+
 __WEAK void nrf_802154_cca_done(bool channel_free)
 {
     (void)channel_free;
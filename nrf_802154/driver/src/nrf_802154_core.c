@@ -52,6 +52,7 @@
 #include "nrf_802154_const.h"
 #include "nrf_802154_critical_section.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_neighbor_stats.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_nrfx_addons.h"
 #include "nrf_802154_peripherals.h"
@@ -70,6 +71,8 @@
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_tx_power_ctrl.h"
+#include "mac_features/nrf_802154_tx_queue.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 #include "mac_features/ack_generator/nrf_802154_ack_generator.h"
 #include "rsch/nrf_802154_rsch.h"
@@ -122,6 +125,12 @@ static const uint8_t * mp_tx_data;     ///< Pointer to the data to transmit.
 static uint32_t        m_ed_time_left; ///< Remaining time of the current energy detection procedure [us].
 static uint8_t         m_ed_result;    ///< Result of the current energy detection procedure.
 
+static uint32_t m_ed_scan_mask;                                         ///< Channels requested in the current energy scan procedure, 0 if a single channel energy detection is performed.
+static uint32_t m_ed_scan_channels_left;                                ///< Channels remaining to be scanned in the current energy scan procedure.
+static uint32_t m_ed_scan_dwell_time;                                   ///< Time of energy detection on each scanned channel [us].
+static uint8_t  m_ed_scan_channel;                                      ///< Channel scanned now by the energy scan procedure.
+static uint8_t  m_ed_scan_results[NRF_802154_ENERGY_SCAN_CHANNELS_NUM]; ///< Results of the current energy scan procedure.
+
 static volatile radio_state_t m_state; ///< State of the radio driver.
 
 typedef struct
@@ -344,23 +353,34 @@ static void transmitted_frame_notify(uint8_t * p_ack, int8_t power, uint8_t lqi)
     nrf_802154_critical_section_nesting_deny();
 }
 
-/** Notify MAC layer that transmission procedure failed. */
-static void transmit_failed_notify(nrf_802154_tx_error_t error)
+/** Notify MAC layer that transmission procedure of given frame failed. */
+static void frame_transmit_failed_notify(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
-    const uint8_t * p_frame = mp_tx_data;
-
     if (nrf_802154_core_hooks_tx_failed(p_frame, error))
     {
         nrf_802154_notify_transmit_failed(p_frame, error);
     }
+
+#if NRF_802154_TX_QUEUE_SIZE
+    nrf_802154_tx_queue_tx_failed_notified();
+#endif
+}
+
+/** Notify MAC layer that transmission procedure failed. */
+static void transmit_failed_notify(nrf_802154_tx_error_t error)
+{
+    frame_transmit_failed_notify(mp_tx_data, error);
 }
 
-/** Allow nesting critical sections and notify MAC layer that transmission procedure failed. */
-static void transmit_failed_notify_and_nesting_allow(nrf_802154_tx_error_t error)
+/** Allow nesting critical sections and notify MAC layer that transmission procedure of given
+ *  frame failed.
+ */
+static void transmit_failed_notify_and_nesting_allow(const uint8_t       * p_frame,
+                                                     nrf_802154_tx_error_t error)
 {
     nrf_802154_critical_section_nesting_allow();
 
-    transmit_failed_notify(error);
+    frame_transmit_failed_notify(p_frame, error);
 
     nrf_802154_critical_section_nesting_deny();
 }
@@ -375,6 +395,16 @@ static void energy_detected_notify(uint8_t result)
     nrf_802154_critical_section_nesting_deny();
 }
 
+/** Notify MAC layer that energy scan procedure ended. */
+static void energy_scan_done_notify(uint32_t channel_mask, const uint8_t * p_results)
+{
+    nrf_802154_critical_section_nesting_allow();
+
+    nrf_802154_notify_energy_scan_done(channel_mask, p_results);
+
+    nrf_802154_critical_section_nesting_deny();
+}
+
 /** Notify MAC layer that CCA procedure ended. */
 static void cca_notify(bool result)
 {
@@ -521,6 +551,33 @@ static bool ed_iter_setup(uint32_t * p_requested_ed_time_us, uint32_t * p_next_t
     return false;
 }
 
+/** Select the next channel of the energy scan procedure.
+ *
+ *  @retval  true   Next channel was selected and its energy detection procedure was prepared.
+ *  @retval  false  All requested channels were already scanned.
+ */
+static bool ed_scan_channel_next(void)
+{
+    uint8_t channel = NRF_802154_ENERGY_SCAN_FIRST_CHANNEL;
+
+    if (m_ed_scan_channels_left == 0U)
+    {
+        return false;
+    }
+
+    while ((m_ed_scan_channels_left & (1UL << channel)) == 0U)
+    {
+        channel++;
+    }
+
+    m_ed_scan_channels_left &= ~(1UL << channel);
+    m_ed_scan_channel        = channel;
+    m_ed_time_left           = m_ed_scan_dwell_time;
+    m_ed_result              = 0;
+
+    return true;
+}
+
 /***************************************************************************************************
  * @section FSM transition request sub-procedures
  **************************************************************************************************/
@@ -844,12 +901,22 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
             if (m_state == RADIO_STATE_ED)
             {
                 nrf_802154_sl_ant_div_energy_detection_aborted_notify();
+
+                if ((m_ed_scan_mask != 0U) && timeslot_is_granted())
+                {
+                    // Energy scan might have left the radio on another channel.
+                    nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+                }
             }
 
             if (notify)
             {
                 operation_terminated_notify(m_state, receiving_psdu_now);
             }
+
+#if NRF_802154_TX_QUEUE_SIZE
+            nrf_802154_tx_queue_terminated(term_lvl, req_orig);
+#endif
         }
 
     }
@@ -1035,14 +1102,130 @@ static bool tx_init(const uint8_t * p_data, bool cca)
     }
 #endif
 
+#if NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+    bool            dst_addr_extended;
+    const uint8_t * p_dst_addr = nrf_802154_frame_parser_dst_addr_get(p_data, &dst_addr_extended);
+
+    nrf_802154_sl_ant_div_tx_frame_destination_notify(p_dst_addr, dst_addr_extended);
+#endif
+
+#if NRF_802154_TX_POWER_CTRL_TABLE_SIZE
+    nrf_radio_txpower_t tx_power =
+        nrf_802154_pib_tx_power_attenuated_get(nrf_802154_tx_power_ctrl_attenuation_get(p_data));
+#else
+    nrf_radio_txpower_t tx_power = nrf_802154_pib_tx_power_get();
+#endif
+
     m_flags.tx_with_cca = cca;
     nrf_802154_trx_transmit_frame(p_data,
                                   cca,
+                                  tx_power,
                                   m_trx_transmit_frame_notifications_mask);
 
     return true;
 }
 
+/** Enter TX state and initialize transmission of given frame. */
+static bool tx_procedure_start(const uint8_t * p_data, bool cca)
+{
+    m_coex_tx_request_mode                  = nrf_802154_pib_coex_tx_request_mode_get();
+    m_trx_transmit_frame_notifications_mask = make_trx_frame_transmit_notification_mask(cca);
+    m_flags.tx_diminished_prio              =
+        m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE;
+
+    state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
+    mp_tx_data = p_data;
+
+    // coverity[check_return]
+    return tx_init(p_data, cca);
+}
+
+#if NRF_802154_TX_QUEUE_SIZE
+
+/** Start transmission of the next frame from the TX queue.
+ *
+ * This function is called when the transmission procedure of the previous frame ends. It chains
+ * the next queued frame without entering the receive state between the frames. If the frame
+ * cannot be transmitted at the moment because no timeslot is granted, the transmission is
+ * continued when the timeslot is approved, as for a non-immediate transmission request.
+ *
+ * @retval true   Transmission of the next frame is started.
+ * @retval false  The TX queue is not running, it is empty or the next frame was taken over by
+ *                a pre-transmission hook. The caller is responsible for entering the RX state.
+ */
+static bool tx_queue_next_transmit(void)
+{
+    const uint8_t * p_data;
+    bool            cca;
+
+    if (!nrf_802154_tx_queue_pop(&p_data, &cca))
+    {
+        return false;
+    }
+
+    if (!nrf_802154_core_hooks_pre_transmission(p_data, cca, false))
+    {
+        return false;
+    }
+
+    (void)tx_procedure_start(p_data, cca);
+
+    return true;
+}
+
+/** Chain the next frame from the TX queue after a successful transmission.
+ *
+ * The transmitted hooks of the previous frame are processed before the next frame is started,
+ * because the next transmission overwrites the state they refer to. The MAC layer is notified
+ * about the previous frame afterwards.
+ *
+ * @retval true   A frame was waiting in the TX queue and the transmitted frame was notified.
+ * @retval false  No frame is waiting in the TX queue. Nothing was done.
+ */
+static bool tx_queue_transmitted_next_transmit(uint8_t * p_ack, int8_t power, uint8_t lqi)
+{
+    const uint8_t * p_frame = mp_tx_data;
+
+    if (!nrf_802154_tx_queue_is_pending())
+    {
+        return false;
+    }
+
+    nrf_802154_core_hooks_transmitted(p_frame);
+
+    if (!tx_queue_next_transmit())
+    {
+        state_set(RADIO_STATE_RX);
+        rx_init();
+    }
+
+    nrf_802154_critical_section_nesting_allow();
+
+    nrf_802154_notify_transmitted(p_frame, p_ack, power, lqi);
+
+    nrf_802154_critical_section_nesting_deny();
+
+    return true;
+}
+
+#else // NRF_802154_TX_QUEUE_SIZE
+
+static bool tx_queue_next_transmit(void)
+{
+    return false;
+}
+
+static bool tx_queue_transmitted_next_transmit(uint8_t * p_ack, int8_t power, uint8_t lqi)
+{
+    (void)p_ack;
+    (void)power;
+    (void)lqi;
+
+    return false;
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE
+
 /** Initialize ED operation */
 static void ed_init(void)
 {
@@ -1068,6 +1251,12 @@ static void ed_init(void)
         return;
     }
 
+    if (m_ed_scan_mask != 0U)
+    {
+        // The radio is configured to the PIB channel at the beginning of each timeslot.
+        nrf_802154_trx_channel_set(m_ed_scan_channel);
+    }
+
     nrf_802154_trx_energy_detection(trx_ed_count);
 }
 
@@ -1173,7 +1362,8 @@ static void on_timeslot_ended(void)
             case RADIO_STATE_TX:
             case RADIO_STATE_RX_ACK:
                 state_set(RADIO_STATE_RX);
-                transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_TIMESLOT_ENDED);
+                transmit_failed_notify_and_nesting_allow(mp_tx_data,
+                                                         NRF_802154_TX_ERROR_TIMESLOT_ENDED);
                 break;
 
             case RADIO_STATE_ED:
@@ -1252,6 +1442,10 @@ static void on_preconditions_denied(radio_state_t state)
 
     operation_terminated_notify(state, receiving_psdu_now);
 
+#if NRF_802154_TX_QUEUE_SIZE
+    nrf_802154_tx_queue_terminated(NRF_802154_TERM_802154, REQ_ORIG_CORE);
+#endif
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
@@ -1825,6 +2019,13 @@ void nrf_802154_trx_receive_frame_received(void)
         }
     }
 
+#endif // NRF_802154_DISABLE_BCC_MATCHING
+
+    // Tag the frame with the address contexts it was accepted in.
+    mp_current_rx_buffer->pan_contexts =
+        m_flags.frame_filtered ? nrf_802154_filter_pan_contexts_get() : 0U;
+
+#if NRF_802154_DISABLE_BCC_MATCHING
     // Timeslot request
     if (m_flags.frame_filtered &&
         ack_is_requested(p_received_data) &&
@@ -1861,6 +2062,21 @@ void nrf_802154_trx_receive_frame_received(void)
 
         nrf_802154_sl_ant_div_rx_frame_received_notify();
 
+#if NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+        bool            src_addr_extended;
+        const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_received_data,
+                                                                          &src_addr_extended);
+
+        nrf_802154_sl_ant_div_rx_frame_source_notify(p_src_addr, src_addr_extended);
+#endif
+
+        nrf_802154_neighbor_stats_rx_frame_update(p_received_data,
+                                                  rssi_last_measurement_get(),
+                                                  lqi_get(p_received_data));
+        nrf_802154_tx_power_ctrl_rx_frame_update(p_received_data,
+                                                 rssi_last_measurement_get(),
+                                                 lqi_get(p_received_data));
+
         bool send_ack = false;
 
         if (m_flags.frame_filtered &&
@@ -2051,6 +2267,8 @@ void nrf_802154_trx_transmit_frame_transmitted(void)
 
     if (ack_is_requested(mp_tx_data))
     {
+        nrf_802154_neighbor_stats_tx_frame_update(mp_tx_data);
+
         state_set(RADIO_STATE_RX_ACK);
 
         bool rx_buffer_free = rx_buffer_is_available();
@@ -2085,11 +2303,14 @@ void nrf_802154_trx_transmit_frame_transmitted(void)
     }
     else
     {
-        state_set(RADIO_STATE_RX);
+        if (!tx_queue_transmitted_next_transmit(NULL, 0, 0))
+        {
+            state_set(RADIO_STATE_RX);
 
-        rx_init();
+            rx_init();
 
-        transmitted_frame_notify(NULL, 0, 0);
+            transmitted_frame_notify(NULL, 0, 0);
+        }
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2185,12 +2406,17 @@ static void on_bad_ack(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    const uint8_t * p_frame = mp_tx_data;
+
     // We received either a frame with incorrect CRC or not an ACK frame or not matching ACK
-    state_set(RADIO_STATE_RX);
+    if (!tx_queue_next_transmit())
+    {
+        state_set(RADIO_STATE_RX);
 
-    rx_init();
+        rx_init();
+    }
 
-    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_INVALID_ACK);
+    transmit_failed_notify_and_nesting_allow(p_frame, NRF_802154_TX_ERROR_INVALID_ACK);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
@@ -2220,15 +2446,25 @@ void nrf_802154_trx_receive_ack_received(void)
 #endif
 
         rx_buffer_t * p_ack_buffer = mp_current_rx_buffer;
+        int8_t        rssi         = rssi_last_measurement_get();
+        uint8_t       lqi          = lqi_get(p_ack_buffer->data);
 
-        mp_current_rx_buffer->free = false;
+        nrf_802154_neighbor_stats_ack_update(mp_tx_data, rssi, lqi);
+        nrf_802154_tx_power_ctrl_ack_update(mp_tx_data, rssi, lqi);
 
-        state_set(RADIO_STATE_RX);
-        rx_init();
+        mp_current_rx_buffer->free         = false;
+        mp_current_rx_buffer->pan_contexts = 0U;
 
-        transmitted_frame_notify(p_ack_buffer->data,           // phr + psdu
-                                 rssi_last_measurement_get(),  // rssi
-                                 lqi_get(p_ack_buffer->data)); // lqi;
+        // RSSI and LQI of the ACK are read before the next frame from the TX queue is started.
+        if (!tx_queue_transmitted_next_transmit(p_ack_buffer->data, rssi, lqi))
+        {
+            state_set(RADIO_STATE_RX);
+            rx_init();
+
+            transmitted_frame_notify(p_ack_buffer->data, // phr + psdu
+                                     rssi,               // rssi
+                                     lqi);               // lqi;
+        }
     }
     else
     {
@@ -2296,10 +2532,15 @@ void nrf_802154_trx_transmit_frame_ccabusy(void)
     nrf_802154_stat_totals_increment(total_listening_time, t_listening);
 #endif
 
-    state_set(RADIO_STATE_RX);
-    rx_init();
+    const uint8_t * p_frame = mp_tx_data;
 
-    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_BUSY_CHANNEL);
+    if (!tx_queue_next_transmit())
+    {
+        state_set(RADIO_STATE_RX);
+        rx_init();
+    }
+
+    transmit_failed_notify_and_nesting_allow(p_frame, NRF_802154_TX_ERROR_BUSY_CHANNEL);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
@@ -2332,6 +2573,25 @@ void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
     {
         ed_init();
     }
+    else if (m_ed_scan_mask != 0U)
+    {
+        m_ed_scan_results[m_ed_scan_channel - NRF_802154_ENERGY_SCAN_FIRST_CHANNEL] =
+            ed_result_get(m_ed_result);
+
+        if (ed_scan_channel_next())
+        {
+            ed_init();
+        }
+        else
+        {
+            nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+
+            state_set(RADIO_STATE_RX);
+            rx_init();
+
+            energy_scan_done_notify(m_ed_scan_mask, m_ed_scan_results);
+        }
+    }
     else
     {
         nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
@@ -2490,17 +2750,7 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
             if (result)
             {
-                m_coex_tx_request_mode                  = nrf_802154_pib_coex_tx_request_mode_get();
-                m_trx_transmit_frame_notifications_mask =
-                    make_trx_frame_transmit_notification_mask(cca);
-                m_flags.tx_diminished_prio =
-                    m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE;
-
-                state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
-                mp_tx_data = p_data;
-
-                // coverity[check_return]
-                result = tx_init(p_data, cca);
+                result = tx_procedure_start(p_data, cca);
                 if (immediate)
                 {
                     if (!result)
@@ -2536,6 +2786,73 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
     return result;
 }
 
+#if NRF_802154_TX_QUEUE_SIZE
+bool nrf_802154_core_tx_queue_transmit(nrf_802154_term_t              term_lvl,
+                                       req_originator_t               req_orig,
+                                       const uint8_t                * p_data,
+                                       bool                           cca,
+                                       nrf_802154_notification_func_t notify_function)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        if (p_data == NULL)
+        {
+            result = current_operation_terminate(term_lvl, req_orig, false);
+
+            if (result && !tx_queue_next_transmit())
+            {
+                state_set(RADIO_STATE_RX);
+                rx_init();
+            }
+        }
+        else if (nrf_802154_tx_queue_is_running())
+        {
+            // The frame is transmitted when the transmission of the previous frames ends.
+            result = nrf_802154_tx_queue_push(p_data, cca);
+        }
+        else if (nrf_802154_core_hooks_pre_transmission(p_data, cca, false))
+        {
+            result = current_operation_terminate(term_lvl, req_orig, true);
+
+            if (result)
+            {
+                nrf_802154_tx_queue_start();
+                (void)tx_procedure_start(p_data, cca);
+            }
+        }
+        else
+        {
+            // The frame was taken over by a pre-transmission hook. The next queued frames are
+            // transmitted when its transmission ends.
+            nrf_802154_tx_queue_start();
+        }
+
+        if (notify_function != NULL)
+        {
+            notify_function(result);
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+    else
+    {
+        if (notify_function != NULL)
+        {
+            notify_function(false);
+        }
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE
+
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2555,6 +2872,48 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
 
             m_ed_time_left = time_us;
             m_ed_result    = 0;
+            m_ed_scan_mask = 0U;
+
+            state_set(RADIO_STATE_ED);
+            ed_init();
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+bool nrf_802154_core_energy_scan(nrf_802154_term_t term_lvl,
+                                 uint32_t          channel_mask,
+                                 uint32_t          dwell_time_us)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert(channel_mask != 0U);
+    assert((channel_mask & ~NRF_802154_ENERGY_SCAN_CHANNEL_MASK) == 0U);
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
+
+        if (result)
+        {
+            if (dwell_time_us < ED_ITER_DURATION)
+            {
+                dwell_time_us = ED_ITER_DURATION;
+            }
+
+            m_ed_scan_mask          = channel_mask;
+            m_ed_scan_channels_left = channel_mask;
+            m_ed_scan_dwell_time    = dwell_time_us;
+            memset(m_ed_scan_results, 0, sizeof(m_ed_scan_results));
+
+            (void)ed_scan_channel_next();
 
             state_set(RADIO_STATE_ED);
             ed_init();
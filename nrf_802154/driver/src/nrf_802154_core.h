@@ -154,6 +154,34 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               bool                           immediate,
                               nrf_802154_notification_func_t notify_function);
 
+/**
+ * @brief Requests the transmission of a frame from the TX queue.
+ *
+ * If the TX queue is running, the given frame is added at the end of the queue and is
+ * transmitted when all previously queued frames are transmitted. Otherwise, the queue is
+ * started and the transition to the @ref RADIO_STATE_TX state is requested as for
+ * @ref nrf_802154_core_transmit.
+ *
+ * If @p p_data is NULL, the current operation is terminated without a notification and
+ * the driver continues with the next frame from the TX queue. If there is no such frame,
+ * the driver transitions to the @ref RADIO_STATE_RX state. The originator of this request is
+ * responsible for reporting the result of the terminated operation.
+ *
+ * @param[in]  term_lvl         Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig         Module that originates this request.
+ * @param[in]  p_data           Pointer to a frame to transmit or NULL.
+ * @param[in]  cca              If the driver is to perform CCA procedure before transmission.
+ * @param[in]  notify_function  Function called to notify the status of this procedure. May be NULL.
+ *
+ * @retval  true   The frame was accepted or the transmission of queued frames continues.
+ * @retval  false  The TX queue is full or the driver is performing other procedure.
+ */
+bool nrf_802154_core_tx_queue_transmit(nrf_802154_term_t              term_lvl,
+                                       req_originator_t               req_orig,
+                                       const uint8_t                * p_data,
+                                       bool                           cca,
+                                       nrf_802154_notification_func_t notify_function);
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_ED state.
  *
@@ -169,6 +197,25 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
  */
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+/**
+ * @brief Requests the transition to the @ref RADIO_STATE_ED state to scan multiple channels.
+ *
+ * The energy detection procedure is performed on each channel selected by @p channel_mask,
+ * starting from the lowest one. When the last channel is scanned, the driver transitions
+ * to the @ref RADIO_STATE_RX state on the channel configured in PIB.
+ *
+ * @param[in]  term_lvl       Termination level of this request. Selects procedures to abort.
+ * @param[in]  channel_mask   Mask of channels to scan.
+ * @param[in]  dwell_time_us  Minimal time of energy detection procedure on each channel.
+ *
+ * @retval  true   Entering the energy detection state succeeded.
+ * @retval  false  Entering the energy detection state failed
+ *                 (the driver is performing other procedure).
+ */
+bool nrf_802154_core_energy_scan(nrf_802154_term_t term_lvl,
+                                 uint32_t          channel_mask,
+                                 uint32_t          dwell_time_us);
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_CCA state.
  *
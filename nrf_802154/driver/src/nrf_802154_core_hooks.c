@@ -50,6 +50,9 @@
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "mac_features/nrf_802154_ie_writer.h"
 #include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_tx_power_ctrl.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_tx_retry.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 
@@ -85,6 +88,10 @@ static const abort_hook m_abort_hooks[] =
     nrf_802154_ifs_abort,
 #endif
 
+#if NRF_802154_TX_RETRY_ENABLED
+    nrf_802154_tx_retry_abort,
+#endif
+
     NULL,
 };
 
@@ -95,6 +102,9 @@ static const pre_transmission_hook m_pre_transmission_hooks[] =
 #endif
 #if NRF_802154_IE_WRITER_ENABLED
     nrf_802154_ie_writer_pretransmission,
+#endif
+#if NRF_802154_TX_RETRY_ENABLED
+    nrf_802154_tx_retry_pretransmission,
 #endif
     NULL,
 };
@@ -106,12 +116,19 @@ static const transmitted_hook m_transmitted_hooks[] =
 #endif
 #if NRF_802154_IFS_ENABLED
     nrf_802154_ifs_transmitted_hook,
+#endif
+#if NRF_802154_TX_RETRY_ENABLED
+    nrf_802154_tx_retry_transmitted_hook,
 #endif
     NULL,
 };
 
 static const tx_failed_hook m_tx_failed_hooks[] =
 {
+#if NRF_802154_TX_POWER_CTRL_TABLE_SIZE
+    nrf_802154_tx_power_ctrl_tx_failed_hook,
+#endif
+
 #if NRF_802154_CSMA_CA_ENABLED
     nrf_802154_csma_ca_tx_failed_hook,
 #endif
@@ -120,6 +137,14 @@ static const tx_failed_hook m_tx_failed_hooks[] =
     nrf_802154_ack_timeout_tx_failed_hook,
 #endif
 
+#if NRF_802154_TX_QUEUE_SIZE
+    nrf_802154_tx_queue_tx_failed_hook,
+#endif
+
+#if NRF_802154_TX_RETRY_ENABLED
+    nrf_802154_tx_retry_tx_failed_hook,
+#endif
+
     NULL,
 };
 
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the critical section profiler of the 802.15.4 driver.
+ *
+ * Sections that are being held are kept in a small table of active measurements. When a section
+ * is left, its duration is accumulated in the entry of the code location that entered it. The
+ * entries are stored in a fixed-size table indexed by an open-addressing hash of the location.
+ * Both tables are modified only with interrupts masked, or with a mutex held when the profiler
+ * runs on a host with @ref NRF_802154_CRIT_SECT_PROF_HOST_CLOCK.
+ *
+ */
+
+#include "nrf_802154_crit_sect_prof.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf.h"
+#include "nrf_802154_config.h"
+
+#if NRF_802154_CRIT_SECT_PROF_ENABLED
+
+#if NRF_802154_CRIT_SECT_PROF_HOST_CLOCK
+#include <pthread.h>
+#include <time.h>
+#endif
+
+/** Active measurement of a section. */
+typedef struct
+{
+    const void                     * p_section; ///< Section being held, NULL if the entry is free.
+    uintptr_t                        site;      ///< Code location that entered the section.
+    nrf_802154_crit_sect_prof_kind_t kind;      ///< Kind of the section.
+    uint32_t                         start;     ///< Time the section was entered [ticks].
+} held_section_t;
+
+static held_section_t                   m_held[NRF_802154_CRIT_SECT_PROF_HELD_NUM];   ///< Sections being held.
+static nrf_802154_crit_sect_prof_site_t m_sites[NRF_802154_CRIT_SECT_PROF_SITES_NUM]; ///< Results per code location.
+static uint32_t                         m_dropped;        ///< Number of sections that were not accounted.
+static const uint8_t                    m_irq_masked_tag; ///< Identifies regions with interrupts masked.
+
+#if NRF_802154_CRIT_SECT_PROF_HOST_CLOCK
+static pthread_mutex_t m_tables_mutex = PTHREAD_MUTEX_INITIALIZER; ///< Protects the tables on a host.
+#endif
+
+/** @brief Gets the current time of the profiler time source. */
+static inline uint32_t time_get(void)
+{
+#if NRF_802154_CRIT_SECT_PROF_HOST_CLOCK
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/** @brief Masks interrupts, or locks the host mutex, to protect the profiler tables. */
+static inline uint32_t tables_lock(void)
+{
+#if NRF_802154_CRIT_SECT_PROF_HOST_CLOCK
+    (void)pthread_mutex_lock(&m_tables_mutex);
+
+    return 0;
+#else
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    return primask;
+#endif
+}
+
+/** @brief Restores the interrupt mask saved by @ref tables_lock, or unlocks the host mutex. */
+static inline void tables_unlock(uint32_t primask)
+{
+#if NRF_802154_CRIT_SECT_PROF_HOST_CLOCK
+    (void)primask;
+    (void)pthread_mutex_unlock(&m_tables_mutex);
+#else
+    __set_PRIMASK(primask);
+#endif
+}
+
+/**
+ * @brief Finds the results of a code location, allocating them if they do not exist yet.
+ *
+ * @param[in]  site  Code location.
+ * @param[in]  kind  Kind of the sections entered from @p site.
+ *
+ * @returns Pointer to the results, or NULL if the table is full.
+ */
+static nrf_802154_crit_sect_prof_site_t * site_get(uintptr_t site, nrf_802154_crit_sect_prof_kind_t kind)
+{
+    uint32_t index = (uint32_t)(((site >> 1) ^ kind) * 2654435761UL) %
+                     NRF_802154_CRIT_SECT_PROF_SITES_NUM;
+
+    for (uint32_t i = 0; i < NRF_802154_CRIT_SECT_PROF_SITES_NUM; i++)
+    {
+        nrf_802154_crit_sect_prof_site_t * p_site = &m_sites[index];
+
+        if (p_site->site == 0)
+        {
+            p_site->site = site;
+            p_site->kind = kind;
+
+            return p_site;
+        }
+
+        if ((p_site->site == site) && (p_site->kind == kind))
+        {
+            return p_site;
+        }
+
+        index = (index + 1) % NRF_802154_CRIT_SECT_PROF_SITES_NUM;
+    }
+
+    return NULL;
+}
+
+void nrf_802154_crit_sect_prof_init(void)
+{
+#if !NRF_802154_CRIT_SECT_PROF_HOST_CLOCK
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    nrf_802154_crit_sect_prof_reset();
+}
+
+void nrf_802154_crit_sect_prof_enter(const void                     * p_section,
+                                     nrf_802154_crit_sect_prof_kind_t kind,
+                                     uintptr_t                        site)
+{
+    uint32_t primask = tables_lock();
+    bool     stored  = false;
+
+    for (uint32_t i = 0; i < NRF_802154_CRIT_SECT_PROF_HELD_NUM; i++)
+    {
+        if (m_held[i].p_section == NULL)
+        {
+            m_held[i].p_section = p_section;
+            m_held[i].site      = site;
+            m_held[i].kind      = kind;
+            m_held[i].start     = time_get();
+
+            stored = true;
+            break;
+        }
+    }
+
+    if (!stored)
+    {
+        m_dropped++;
+    }
+
+    tables_unlock(primask);
+}
+
+void nrf_802154_crit_sect_prof_exit(const void * p_section)
+{
+    uint32_t                         end     = time_get();
+    uint32_t                         primask = tables_lock();
+    nrf_802154_crit_sect_prof_site_t exceeded;
+    uint32_t                         time        = 0;
+    bool                             over_budget = false;
+
+    for (uint32_t i = 0; i < NRF_802154_CRIT_SECT_PROF_HELD_NUM; i++)
+    {
+        if (m_held[i].p_section == p_section)
+        {
+            nrf_802154_crit_sect_prof_site_t * p_site = site_get(m_held[i].site, m_held[i].kind);
+
+            time                = end - m_held[i].start;
+            m_held[i].p_section = NULL;
+
+            if (p_site == NULL)
+            {
+                m_dropped++;
+                break;
+            }
+
+            p_site->count++;
+            p_site->total_time += time;
+
+            if (time > p_site->max_time)
+            {
+                p_site->max_time = time;
+            }
+
+            if (time > NRF_802154_CRIT_SECT_PROF_BUDGET)
+            {
+                p_site->over_budget++;
+                exceeded    = *p_site;
+                over_budget = true;
+            }
+
+            break;
+        }
+    }
+
+    tables_unlock(primask);
+
+    if (over_budget)
+    {
+        nrf_802154_crit_sect_prof_budget_exceeded(&exceeded, time);
+    }
+}
+
+void nrf_802154_crit_sect_prof_irq_masked(void)
+{
+    nrf_802154_crit_sect_prof_enter(&m_irq_masked_tag,
+                                    NRF_802154_CRIT_SECT_PROF_KIND_IRQ_MASKED,
+                                    NRF_802154_CRIT_SECT_PROF_CALLER());
+}
+
+void nrf_802154_crit_sect_prof_irq_unmasked(void)
+{
+    nrf_802154_crit_sect_prof_exit(&m_irq_masked_tag);
+}
+
+size_t nrf_802154_crit_sect_prof_report_get(nrf_802154_crit_sect_prof_site_t * p_sites,
+                                            size_t                             sites_num,
+                                            uint32_t                         * p_dropped)
+{
+    size_t result = 0;
+
+    for (uint32_t i = 0; i < NRF_802154_CRIT_SECT_PROF_SITES_NUM; i++)
+    {
+        nrf_802154_crit_sect_prof_site_t site;
+        uint32_t                         primask = tables_lock();
+        size_t                           pos;
+
+        site = m_sites[i];
+        tables_unlock(primask);
+
+        if (site.site == 0)
+        {
+            continue;
+        }
+
+        // Insert the entry keeping the array sorted, dropping the shortest one if it is full.
+        pos = (result < sites_num) ? result++ : sites_num;
+
+        while ((pos > 0) && (p_sites[pos - 1].max_time < site.max_time))
+        {
+            if (pos < sites_num)
+            {
+                p_sites[pos] = p_sites[pos - 1];
+            }
+
+            pos--;
+        }
+
+        if (pos < sites_num)
+        {
+            p_sites[pos] = site;
+        }
+    }
+
+    if (p_dropped != NULL)
+    {
+        *p_dropped = m_dropped;
+    }
+
+    return result;
+}
+
+void nrf_802154_crit_sect_prof_reset(void)
+{
+    uint32_t primask = tables_lock();
+
+    memset(m_sites, 0, sizeof(m_sites));
+    m_dropped = 0;
+
+    tables_unlock(primask);
+}
+
+__WEAK void nrf_802154_crit_sect_prof_budget_exceeded(const nrf_802154_crit_sect_prof_site_t * p_site,
+                                                      uint32_t                                 time)
+{
+    (void)p_site;
+    (void)time;
+}
+
+#endif // NRF_802154_CRIT_SECT_PROF_ENABLED
@@ -46,6 +46,7 @@
 #include <stdint.h>
 
 #include "nrf_802154_config.h"
+#include "nrf_802154_crit_sect_prof.h"
 #include "nrf_802154_debug.h"
 #include "nrf_802154_utils.h"
 #include "hal/nrf_radio.h"
@@ -62,6 +63,7 @@
 static volatile uint8_t m_critical_section_monitor;                 ///< Monitors each critical section enter operation
 static volatile uint8_t m_nested_critical_section_counter;          ///< Counter of nested critical sections
 static volatile int8_t  m_nested_critical_section_allowed_priority; ///< Indicator if nested critical sections are currently allowed
+static uintptr_t        m_critical_section_site;                    ///< Code location that entered the outermost critical section
 
 /***************************************************************************************************
  * @section Critical sections management
@@ -115,7 +117,7 @@ static bool nested_critical_section_is_allowed_in_this_context(void)
            active_priority_convert(nrf_802154_critical_section_active_vector_priority_get());
 }
 
-static bool critical_section_enter(bool forced)
+static bool critical_section_enter(bool forced, uintptr_t site)
 {
     bool    result = false;
     uint8_t cnt;
@@ -136,6 +138,14 @@ static bool critical_section_enter(bool forced)
         }
         while (__STREXB(cnt + 1, &m_nested_critical_section_counter));
 
+        if (cnt == 0)
+        {
+            m_critical_section_site = site;
+            nrf_802154_crit_sect_prof_enter(&m_nested_critical_section_counter,
+                                            NRF_802154_CRIT_SECT_PROF_KIND_DRIVER,
+                                            site);
+        }
+
         nrf_802154_critical_section_rsch_enter();
         nrf_802154_lp_timer_critical_section_enter();
         radio_critical_section_enter();
@@ -176,6 +186,8 @@ static void critical_section_exit(void)
             nrf_802154_lp_timer_critical_section_exit();
 
             exiting_crit_sect = false;
+
+            nrf_802154_crit_sect_prof_exit(&m_nested_critical_section_counter);
         }
 
         do
@@ -193,7 +205,7 @@ static void critical_section_exit(void)
             if (nrf_802154_critical_section_rsch_event_is_pending() ||
                 (monitor != m_critical_section_monitor))
             {
-                result = critical_section_enter(false);
+                result = critical_section_enter(false, m_critical_section_site);
                 assert(result);
                 (void)result;
             }
@@ -222,7 +234,7 @@ bool nrf_802154_critical_section_enter(void)
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    result = critical_section_enter(false);
+    result = critical_section_enter(false, NRF_802154_CRIT_SECT_PROF_CALLER());
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -235,7 +247,7 @@ void nrf_802154_critical_section_forcefully_enter(void)
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    critical_section_entered = critical_section_enter(true);
+    critical_section_entered = critical_section_enter(true, NRF_802154_CRIT_SECT_PROF_CALLER());
     assert(critical_section_entered);
     (void)critical_section_entered;
 
@@ -62,6 +62,7 @@ typedef enum
     NRF_802154_DRV_MODULE_ID_DELAYED_TRX = 6U,
     NRF_802154_DRV_MODULE_ID_ACK_TIMEOUT = 7U,
     NRF_802154_DRV_MODULE_ID_TRX_PPI     = 8U,
+    NRF_802154_DRV_MODULE_ID_TX_RETRY    = 9U,
 } nrf_802154_drv_modules_list_t;
 
 /**
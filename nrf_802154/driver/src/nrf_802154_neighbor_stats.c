@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the per-neighbor link statistics module of the 802.15.4 driver.
+ *
+ * Neighbors are stored in a fixed-size table. An open-addressing hash index with linear probing
+ * maps a neighbor address to its entry in the table, so that updates performed for every
+ * received frame take constant time. When the table is full, the neighbor which was not heard
+ * from for the longest time is replaced and the hash index is rebuilt.
+ *
+ */
+
+#include "nrf_802154_neighbor_stats.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "timer/nrf_802154_timer_sched.h"
+
+#if NRF_802154_NEIGHBOR_STATS_TABLE_SIZE
+
+#if NRF_802154_NEIGHBOR_STATS_TABLE_SIZE > 127
+#error "NRF_802154_NEIGHBOR_STATS_TABLE_SIZE must not exceed 127"
+#endif
+
+/** Number of slots in the hash index. Power of two at least twice the table size. */
+#define HASH_SIZE                                          \
+    ((NRF_802154_NEIGHBOR_STATS_TABLE_SIZE <= 2) ? 4U :    \
+     (NRF_802154_NEIGHBOR_STATS_TABLE_SIZE <= 4) ? 8U :    \
+     (NRF_802154_NEIGHBOR_STATS_TABLE_SIZE <= 8) ? 16U :   \
+     (NRF_802154_NEIGHBOR_STATS_TABLE_SIZE <= 16) ? 32U :  \
+     (NRF_802154_NEIGHBOR_STATS_TABLE_SIZE <= 32) ? 64U :  \
+     (NRF_802154_NEIGHBOR_STATS_TABLE_SIZE <= 64) ? 128U : \
+     256U)
+#define HASH_MASK       (HASH_SIZE - 1U)
+#define HASH_SLOT_EMPTY 0U        ///< Value of a hash index slot not pointing to any entry.
+
+#define EWMA_FRAC_BITS  4U        ///< Number of fractional bits of the averaged values.
+#define EWMA_DIVISOR    (1L << NRF_802154_NEIGHBOR_STATS_EWMA_SHIFT)
+
+/** Internal representation of a neighbor. */
+typedef struct
+{
+    uint8_t  addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the neighbor, zero-padded for a short address.
+    bool     extended;                    ///< Whether @ref addr holds an extended address.
+    bool     averages_valid;              ///< Whether at least one RSSI and LQI sample was collected.
+    int16_t  rssi_avg;                    ///< Averaged RSSI with EWMA_FRAC_BITS fractional bits.
+    uint16_t lqi_avg;                     ///< Averaged LQI with EWMA_FRAC_BITS fractional bits.
+    uint32_t rx_frames;                   ///< Number of frames received from the neighbor.
+    uint32_t tx_ack_requested;            ///< Number of frames requesting ACK sent to the neighbor.
+    uint32_t tx_acked;                    ///< Number of frames acknowledged by the neighbor.
+    uint32_t last_seen;                   ///< Time of the last frame received from the neighbor.
+} neighbor_t;
+
+static neighbor_t m_neighbors[NRF_802154_NEIGHBOR_STATS_TABLE_SIZE]; ///< Table of neighbors.
+static uint8_t    m_neighbors_count;                                 ///< Number of used entries.
+static uint8_t    m_hash_index[HASH_SIZE];                           ///< Hash index holding entry indices incremented by 1.
+
+/** Calculate hash of the address of the given size. */
+static uint32_t addr_hash(const uint8_t * p_addr, bool extended)
+{
+    uint32_t hash = extended ? 0x9e3779b9UL : 0UL;
+    uint8_t  size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    for (uint8_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ p_addr[i]) * 0x01000193UL;
+    }
+
+    return hash ^ (hash >> 16);
+}
+
+/** Check if the entry holds the given address. */
+static bool neighbor_matches(const neighbor_t * p_neighbor, const uint8_t * p_addr, bool extended)
+{
+    uint8_t size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    return (p_neighbor->extended == extended) && (0 == memcmp(p_neighbor->addr, p_addr, size));
+}
+
+/** Find hash index slot holding the given address or the first empty slot on its probe path. */
+static uint32_t hash_slot_find(const uint8_t * p_addr, bool extended)
+{
+    uint32_t slot = addr_hash(p_addr, extended) & HASH_MASK;
+
+    // The index is never full because it has at least twice as many slots as the table entries.
+    while (m_hash_index[slot] != HASH_SLOT_EMPTY)
+    {
+        if (neighbor_matches(&m_neighbors[m_hash_index[slot] - 1U], p_addr, extended))
+        {
+            break;
+        }
+
+        slot = (slot + 1U) & HASH_MASK;
+    }
+
+    return slot;
+}
+
+/** Rebuild the hash index from the table entries. */
+static void hash_index_rebuild(void)
+{
+    memset(m_hash_index, HASH_SLOT_EMPTY, sizeof(m_hash_index));
+
+    for (uint8_t i = 0; i < m_neighbors_count; i++)
+    {
+        uint32_t slot = hash_slot_find(m_neighbors[i].addr, m_neighbors[i].extended);
+
+        m_hash_index[slot] = i + 1U;
+    }
+}
+
+/** Find the entry which was not updated for the longest time. */
+static uint8_t least_recently_seen_find(uint32_t now)
+{
+    uint8_t  oldest     = 0;
+    uint32_t oldest_age = 0;
+
+    for (uint8_t i = 0; i < m_neighbors_count; i++)
+    {
+        uint32_t age = now - m_neighbors[i].last_seen;
+
+        if (age >= oldest_age)
+        {
+            oldest     = i;
+            oldest_age = age;
+        }
+    }
+
+    return oldest;
+}
+
+/**
+ * @brief Get the entry of the given neighbor, creating it if necessary.
+ *
+ * @param[in]  p_addr    Pointer to the address of the neighbor.
+ * @param[in]  extended  Whether @p p_addr points to an extended address.
+ * @param[in]  now       Current time.
+ *
+ * @returns  Pointer to the entry of the neighbor.
+ */
+static neighbor_t * neighbor_get(const uint8_t * p_addr, bool extended, uint32_t now)
+{
+    uint32_t     slot = hash_slot_find(p_addr, extended);
+    neighbor_t * p_neighbor;
+
+    if (m_hash_index[slot] != HASH_SLOT_EMPTY)
+    {
+        return &m_neighbors[m_hash_index[slot] - 1U];
+    }
+
+    if (m_neighbors_count < NRF_802154_NEIGHBOR_STATS_TABLE_SIZE)
+    {
+        p_neighbor         = &m_neighbors[m_neighbors_count++];
+        m_hash_index[slot] = m_neighbors_count;
+    }
+    else
+    {
+        p_neighbor = &m_neighbors[least_recently_seen_find(now)];
+    }
+
+    memset(p_neighbor, 0, sizeof(*p_neighbor));
+    memcpy(p_neighbor->addr, p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+    p_neighbor->extended  = extended;
+    p_neighbor->last_seen = now;
+
+    if (m_hash_index[slot] == HASH_SLOT_EMPTY)
+    {
+        // An existing entry was replaced. Slots on its probe path may have to be moved.
+        hash_index_rebuild();
+    }
+
+    return p_neighbor;
+}
+
+/** Update averaged RSSI and LQI of the neighbor with a new sample. */
+static void averages_update(neighbor_t * p_neighbor, int8_t rssi, uint8_t lqi)
+{
+    int32_t rssi_sample = (int32_t)rssi * (1L << EWMA_FRAC_BITS);
+    int32_t lqi_sample  = (int32_t)lqi * (1L << EWMA_FRAC_BITS);
+
+    if (p_neighbor->averages_valid)
+    {
+        p_neighbor->rssi_avg += (int16_t)((rssi_sample - p_neighbor->rssi_avg) / EWMA_DIVISOR);
+        p_neighbor->lqi_avg   =
+            (uint16_t)((int32_t)p_neighbor->lqi_avg +
+                       (lqi_sample - (int32_t)p_neighbor->lqi_avg) / EWMA_DIVISOR);
+    }
+    else
+    {
+        p_neighbor->rssi_avg       = (int16_t)rssi_sample;
+        p_neighbor->lqi_avg        = (uint16_t)lqi_sample;
+        p_neighbor->averages_valid = true;
+    }
+}
+
+/** Convert an averaged value to an integer, rounding half away from zero. */
+static int32_t average_round(int32_t avg)
+{
+    int32_t half = (avg < 0) ? -(1L << (EWMA_FRAC_BITS - 1U)) : (1L << (EWMA_FRAC_BITS - 1U));
+
+    return (avg + half) / (1L << EWMA_FRAC_BITS);
+}
+
+void nrf_802154_neighbor_stats_rx_frame_update(const uint8_t * p_frame, int8_t rssi, uint8_t lqi)
+{
+    bool            extended;
+    const uint8_t * p_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &extended);
+
+    if (p_addr == NULL)
+    {
+        return;
+    }
+
+    uint32_t                        now = nrf_802154_timer_sched_time_get();
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    neighbor_t * p_neighbor = neighbor_get(p_addr, extended, now);
+
+    averages_update(p_neighbor, rssi, lqi);
+    p_neighbor->rx_frames++;
+    p_neighbor->last_seen = now;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_neighbor_stats_tx_frame_update(const uint8_t * p_frame)
+{
+    bool            extended;
+    const uint8_t * p_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &extended);
+
+    if (p_addr == NULL)
+    {
+        return;
+    }
+
+    uint32_t                        now = nrf_802154_timer_sched_time_get();
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    neighbor_t * p_neighbor = neighbor_get(p_addr, extended, now);
+
+    p_neighbor->tx_ack_requested++;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_neighbor_stats_ack_update(const uint8_t * p_frame, int8_t rssi, uint8_t lqi)
+{
+    bool            extended;
+    const uint8_t * p_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &extended);
+
+    if (p_addr == NULL)
+    {
+        return;
+    }
+
+    uint32_t                        now = nrf_802154_timer_sched_time_get();
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    neighbor_t * p_neighbor = neighbor_get(p_addr, extended, now);
+
+    averages_update(p_neighbor, rssi, lqi);
+    p_neighbor->tx_acked++;
+    p_neighbor->last_seen = now;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+uint8_t nrf_802154_neighbor_stats_get(uint8_t                       first_index,
+                                      nrf_802154_neighbor_stats_t * p_stats,
+                                      uint8_t                       max_count)
+{
+    uint8_t count = 0;
+
+    assert((p_stats != NULL) || (max_count == 0));
+
+    for (uint32_t i = first_index;
+         (i < NRF_802154_NEIGHBOR_STATS_TABLE_SIZE) && (count < max_count);
+         i++)
+    {
+        nrf_802154_mcu_critical_state_t mcu_cs;
+        nrf_802154_neighbor_stats_t   * p_dst = &p_stats[count];
+        const neighbor_t              * p_src = &m_neighbors[i];
+
+        // Copy one entry at a time to keep the interrupt latency independent of the table size.
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        if (i < m_neighbors_count)
+        {
+            memcpy(p_dst->addr, p_src->addr, sizeof(p_dst->addr));
+            p_dst->extended         = p_src->extended;
+            p_dst->rssi_avg         = (int8_t)average_round(p_src->rssi_avg);
+            p_dst->lqi_avg          = (uint8_t)average_round(p_src->lqi_avg);
+            p_dst->rx_frames        = p_src->rx_frames;
+            p_dst->tx_ack_requested = p_src->tx_ack_requested;
+            p_dst->tx_acked         = p_src->tx_acked;
+            p_dst->last_seen        = p_src->last_seen;
+            count++;
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+    }
+
+    return count;
+}
+
+void nrf_802154_neighbor_stats_reset(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_neighbors_count = 0;
+    memset(m_hash_index, HASH_SLOT_EMPTY, sizeof(m_hash_index));
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#else // NRF_802154_NEIGHBOR_STATS_TABLE_SIZE
+
+uint8_t nrf_802154_neighbor_stats_get(uint8_t                       first_index,
+                                      nrf_802154_neighbor_stats_t * p_stats,
+                                      uint8_t                       max_count)
+{
+    (void)first_index;
+    (void)p_stats;
+    (void)max_count;
+
+    return 0;
+}
+
+void nrf_802154_neighbor_stats_reset(void)
+{
+    // Intentionally empty: neighbor statistics are disabled.
+}
+
+#endif // NRF_802154_NEIGHBOR_STATS_TABLE_SIZE
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file contains the per-neighbor link statistics module of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_NEIGHBOR_STATS_H_
+#define NRF_802154_NEIGHBOR_STATS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_NEIGHBOR_STATS_TABLE_SIZE
+
+/**
+ * @brief Updates statistics of the neighbor which sent the received frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the received frame.
+ * @param[in]  rssi     RSSI of the received frame in dBm.
+ * @param[in]  lqi      LQI of the received frame.
+ */
+void nrf_802154_neighbor_stats_rx_frame_update(const uint8_t * p_frame, int8_t rssi, uint8_t lqi);
+
+/**
+ * @brief Updates statistics of the neighbor to which a frame requesting an ACK was transmitted.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the transmitted frame.
+ */
+void nrf_802154_neighbor_stats_tx_frame_update(const uint8_t * p_frame);
+
+/**
+ * @brief Updates statistics of the neighbor which acknowledged the transmitted frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the transmitted frame.
+ * @param[in]  rssi     RSSI of the received ACK in dBm.
+ * @param[in]  lqi      LQI of the received ACK.
+ */
+void nrf_802154_neighbor_stats_ack_update(const uint8_t * p_frame, int8_t rssi, uint8_t lqi);
+
+#else // NRF_802154_NEIGHBOR_STATS_TABLE_SIZE
+
+#define nrf_802154_neighbor_stats_rx_frame_update(p_frame, rssi, lqi)
+#define nrf_802154_neighbor_stats_tx_frame_update(p_frame)
+#define nrf_802154_neighbor_stats_ack_update(p_frame, rssi, lqi)
+
+#endif // NRF_802154_NEIGHBOR_STATS_TABLE_SIZE
+
+#endif /* NRF_802154_NEIGHBOR_STATS_H_ */
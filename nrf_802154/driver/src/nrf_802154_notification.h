@@ -124,6 +124,15 @@ void nrf_802154_notify_energy_detected(uint8_t result);
  */
 void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error);
 
+/**
+ * @brief Notifies the next higher layer that the energy scan procedure ended.
+ *
+ * @param[in]  channel_mask  Mask of scanned channels.
+ * @param[in]  p_results     Array of @ref NRF_802154_ENERGY_SCAN_CHANNELS_NUM detected energy
+ *                           levels, indexed with (channel - @ref NRF_802154_ENERGY_SCAN_FIRST_CHANNEL).
+ */
+void nrf_802154_notify_energy_scan_done(uint32_t channel_mask, const uint8_t * p_results);
+
 /**
  * @brief Notifies the next higher layer that the CCA procedure ended.
  *
@@ -45,6 +45,7 @@
 
 #include "nrf_802154.h"
 #include "nrf_802154_critical_section.h"
+#include "mac_features/nrf_802154_tx_retry.h"
 
 #define RAW_LENGTH_OFFSET  0
 #define RAW_PAYLOAD_OFFSET 1
@@ -73,23 +74,34 @@ void nrf_802154_notify_transmitted(const uint8_t * p_frame,
                                    int8_t          power,
                                    uint8_t         lqi)
 {
+    nrf_802154_transmit_done_metadata_t metadata =
+    {
+        .attempts = nrf_802154_tx_retry_frame_attempts_get(p_frame),
+    };
+
 #if NRF_802154_USE_RAW_API
-    nrf_802154_transmitted_raw(p_frame, p_ack, power, lqi);
+    nrf_802154_transmitted_metadata_raw(p_frame, p_ack, power, lqi, &metadata);
 #else // NRF_802154_USE_RAW_API
-    nrf_802154_transmitted(p_frame + RAW_PAYLOAD_OFFSET,
-                           p_ack == NULL ? NULL : p_ack + RAW_PAYLOAD_OFFSET,
-                           p_ack[RAW_LENGTH_OFFSET],
-                           power,
-                           lqi);
+    nrf_802154_transmitted_metadata(p_frame + RAW_PAYLOAD_OFFSET,
+                                    p_ack == NULL ? NULL : p_ack + RAW_PAYLOAD_OFFSET,
+                                    p_ack == NULL ? 0 : p_ack[RAW_LENGTH_OFFSET],
+                                    power,
+                                    lqi,
+                                    &metadata);
 #endif // NRF_802154_USE_RAW_API
 }
 
 void nrf_802154_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
+    nrf_802154_transmit_done_metadata_t metadata =
+    {
+        .attempts = nrf_802154_tx_retry_frame_attempts_get(p_frame),
+    };
+
 #if NRF_802154_USE_RAW_API
-    nrf_802154_transmit_failed(p_frame, error);
+    nrf_802154_transmit_failed_metadata(p_frame, error, &metadata);
 #else // NRF_802154_USE_RAW_API
-    nrf_802154_transmit_failed(p_frame + RAW_PAYLOAD_OFFSET, error);
+    nrf_802154_transmit_failed_metadata(p_frame + RAW_PAYLOAD_OFFSET, error, &metadata);
 #endif  // NRF_802154_USE_RAW_API
 }
 
@@ -103,6 +115,11 @@ void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
     nrf_802154_energy_detection_failed(error);
 }
 
+void nrf_802154_notify_energy_scan_done(uint32_t channel_mask, const uint8_t * p_results)
+{
+    nrf_802154_energy_scan_done(channel_mask, p_results);
+}
+
 void nrf_802154_notify_cca(bool is_free)
 {
     nrf_802154_cca_done(is_free);
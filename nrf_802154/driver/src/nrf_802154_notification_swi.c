@@ -43,6 +43,7 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
@@ -51,15 +52,17 @@
 #include "nrf_802154_swi.h"
 #include "nrf_802154_utils.h"
 #include "hal/nrf_egu.h"
+#include "mac_features/nrf_802154_tx_retry.h"
 
 /** Size of notification queue.
  *
  * One slot for each receive buffer, one for transmission, one for busy channel and one for energy
- * detection.
+ * detection. Frames from the TX queue are transmitted without waiting for the notifications of
+ * the previous frames, so one slot is added for each of them.
  *
  * One slot is lost due to simplified queue implementation.
  */
-#define NTF_QUEUE_SIZE ((NRF_802154_RX_BUFFERS + 3) + 1)
+#define NTF_QUEUE_SIZE ((NRF_802154_RX_BUFFERS + 3 + NRF_802154_TX_QUEUE_SIZE) + 1)
 
 #define NTF_INT        NRF_EGU_INT_TRIGGERED0   ///< Label of notification interrupt.
 #define NTF_TASK       NRF_EGU_TASK_TRIGGER0    ///< Label of notification task.
@@ -74,6 +77,7 @@ typedef enum
     NTF_TYPE_TRANSMIT_FAILED,         ///< Frame transmission failure
     NTF_TYPE_ENERGY_DETECTED,         ///< Energy detection procedure ended
     NTF_TYPE_ENERGY_DETECTION_FAILED, ///< Energy detection procedure failed
+    NTF_TYPE_ENERGY_SCAN_DONE,        ///< Energy scan procedure ended
     NTF_TYPE_CCA,                     ///< CCA procedure ended
     NTF_TYPE_CCA_FAILED,              ///< CCA procedure failed
 } nrf_802154_ntf_type_t;
@@ -100,16 +104,18 @@ typedef struct
 
         struct
         {
-            const uint8_t * p_frame; ///< Pointer to frame that was transmitted.
-            uint8_t       * p_ack;   ///< Pointer to a buffer containing PHR and PSDU of the received ACK or NULL.
-            int8_t          power;   ///< RSSI of received ACK or 0.
-            uint8_t         lqi;     ///< LQI of received ACK or 0.
-        } transmitted;               ///< Transmitted frame details.
+            const uint8_t                     * p_frame;  ///< Pointer to frame that was transmitted.
+            uint8_t                           * p_ack;    ///< Pointer to a buffer containing PHR and PSDU of the received ACK or NULL.
+            int8_t                              power;    ///< RSSI of received ACK or 0.
+            uint8_t                             lqi;      ///< LQI of received ACK or 0.
+            nrf_802154_transmit_done_metadata_t metadata; ///< Metadata of the transmission procedure.
+        } transmitted;                                    ///< Transmitted frame details.
 
         struct
         {
-            const uint8_t       * p_frame; ///< Pointer to frame that was requested to be transmitted, but failed.
-            nrf_802154_tx_error_t error;   ///< An error code that indicates reason of the failure.
+            const uint8_t                     * p_frame;  ///< Pointer to frame that was requested to be transmitted, but failed.
+            nrf_802154_tx_error_t               error;    ///< An error code that indicates reason of the failure.
+            nrf_802154_transmit_done_metadata_t metadata; ///< Metadata of the transmission procedure.
         } transmit_failed;
 
         struct
@@ -122,6 +128,12 @@ typedef struct
             nrf_802154_ed_error_t error; ///< An error code that indicates reason of the failure.
         } energy_detection_failed;       ///< Energy detection failure details.
 
+        struct
+        {
+            uint32_t channel_mask;                                 ///< Mask of scanned channels.
+            uint8_t  results[NRF_802154_ENERGY_SCAN_CHANNELS_NUM]; ///< Energy detection results.
+        } energy_scan_done;                                        ///< Energy scan details.
+
         struct
         {
             bool result; ///< CCA result.
@@ -232,6 +244,10 @@ void swi_notify_transmitted(const uint8_t * p_frame,
     p_slot->data.transmitted.power   = power;
     p_slot->data.transmitted.lqi     = lqi;
 
+    // The metadata is taken now, as the next frame may finish before the slot is processed.
+    p_slot->data.transmitted.metadata.attempts =
+        nrf_802154_tx_retry_frame_attempts_get(p_frame);
+
     ntf_exit();
 }
 
@@ -251,6 +267,10 @@ void swi_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t e
     p_slot->data.transmit_failed.p_frame = p_frame;
     p_slot->data.transmit_failed.error   = error;
 
+    // The metadata is taken now, as the next frame may finish before the slot is processed.
+    p_slot->data.transmit_failed.metadata.attempts =
+        nrf_802154_tx_retry_frame_attempts_get(p_frame);
+
     ntf_exit();
 }
 
@@ -286,6 +306,26 @@ void swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
     ntf_exit();
 }
 
+/**
+ * @brief Notifies the next higher layer that the energy scan procedure ended from
+ * the SWI priority level.
+ *
+ * @param[in]  channel_mask  Mask of scanned channels.
+ * @param[in]  p_results     Array of detected energy levels.
+ */
+void swi_notify_energy_scan_done(uint32_t channel_mask, const uint8_t * p_results)
+{
+    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+
+    p_slot->type                               = NTF_TYPE_ENERGY_SCAN_DONE;
+    p_slot->data.energy_scan_done.channel_mask = channel_mask;
+    memcpy(p_slot->data.energy_scan_done.results,
+           p_results,
+           sizeof(p_slot->data.energy_scan_done.results));
+
+    ntf_exit();
+}
+
 /**
  * @brief Notifies the next higher layer that the Clear Channel Assessment (CCA) procedure ended.
  *
@@ -365,6 +405,11 @@ void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
     swi_notify_energy_detection_failed(error);
 }
 
+void nrf_802154_notify_energy_scan_done(uint32_t channel_mask, const uint8_t * p_results)
+{
+    swi_notify_energy_scan_done(channel_mask, p_results);
+}
+
 void nrf_802154_notify_cca(bool is_free)
 {
     swi_notify_cca(is_free);
@@ -406,10 +451,11 @@ static void irq_handler_ntf_event(void)
             case NTF_TYPE_TRANSMITTED:
             {
 #if NRF_802154_USE_RAW_API
-                nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
-                                           p_slot->data.transmitted.p_ack,
-                                           p_slot->data.transmitted.power,
-                                           p_slot->data.transmitted.lqi);
+                nrf_802154_transmitted_metadata_raw(p_slot->data.transmitted.p_frame,
+                                                    p_slot->data.transmitted.p_ack,
+                                                    p_slot->data.transmitted.power,
+                                                    p_slot->data.transmitted.lqi,
+                                                    &p_slot->data.transmitted.metadata);
 #else // NRF_802154_USE_RAW_API
                 uint8_t * p_ack  = NULL;
                 uint8_t   length = 0;
@@ -419,23 +465,27 @@ static void irq_handler_ntf_event(void)
                     p_ack  = p_slot->data.transmitted.p_ack + RAW_PAYLOAD_OFFSET;
                     length = p_slot->data.transmitted.p_ack[RAW_LENGTH_OFFSET];
                 }
-                nrf_802154_transmitted(p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
-                                       p_ack,
-                                       length,
-                                       p_slot->data.transmitted.power,
-                                       p_slot->data.transmitted.lqi);
+                nrf_802154_transmitted_metadata(
+                    p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
+                    p_ack,
+                    length,
+                    p_slot->data.transmitted.power,
+                    p_slot->data.transmitted.lqi,
+                    &p_slot->data.transmitted.metadata);
 #endif
             }
             break;
 
             case NTF_TYPE_TRANSMIT_FAILED:
 #if NRF_802154_USE_RAW_API
-                nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame,
-                                           p_slot->data.transmit_failed.error);
+                nrf_802154_transmit_failed_metadata(p_slot->data.transmit_failed.p_frame,
+                                                    p_slot->data.transmit_failed.error,
+                                                    &p_slot->data.transmit_failed.metadata);
 #else // NRF_802154_USE_RAW_API
-                nrf_802154_transmit_failed(
+                nrf_802154_transmit_failed_metadata(
                     p_slot->data.transmit_failed.p_frame + RAW_PAYLOAD_OFFSET,
-                    p_slot->data.transmit_failed.error);
+                    p_slot->data.transmit_failed.error,
+                    &p_slot->data.transmit_failed.metadata);
 #endif
                 break;
 
@@ -448,6 +498,11 @@ static void irq_handler_ntf_event(void)
                     p_slot->data.energy_detection_failed.error);
                 break;
 
+            case NTF_TYPE_ENERGY_SCAN_DONE:
+                nrf_802154_energy_scan_done(p_slot->data.energy_scan_done.channel_mask,
+                                            p_slot->data.energy_scan_done.results);
+                break;
+
             case NTF_TYPE_CCA:
                 nrf_802154_cca_done(p_slot->data.cca.result);
                 break;
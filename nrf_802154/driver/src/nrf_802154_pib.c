@@ -53,6 +53,17 @@
 
 #define CSMACA_BE_MAXIMUM 8 ///< The maximum allowed CSMA-CA backoff exponent (BE) that results from the implementation
 
+#if NRF_802154_PAN_CONTEXTS_NUM > 8
+#error "NRF_802154_PAN_CONTEXTS_NUM must not exceed 8"
+#endif
+
+typedef struct
+{
+    uint8_t pan_id[PAN_ID_SIZE];                  ///< Pan Id.
+    uint8_t short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address.
+    uint8_t extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended Address.
+} nrf_802154_pib_pan_context_t;
+
 typedef struct
 {
     nrf_802154_coex_rx_request_mode_t rx_request_mode; ///< Coex request mode in receive operation.
@@ -81,19 +92,18 @@ typedef struct
 
 typedef struct
 {
-    int8_t                  tx_power;                             ///< Transmit power.
-    uint8_t                 pan_id[PAN_ID_SIZE];                  ///< Pan Id of this node.
-    uint8_t                 short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address of this node.
-    uint8_t                 extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended Address of this node.
-    nrf_802154_cca_cfg_t    cca;                                  ///< CCA mode and thresholds.
-    bool                    promiscuous : 1;                      ///< Indicating if radio is in promiscuous mode.
-    bool                    auto_ack    : 1;                      ///< Indicating if auto ACK procedure is enabled.
-    bool                    pan_coord   : 1;                      ///< Indicating if radio is configured as the PAN coordinator.
-    uint8_t                 channel     : 5;                      ///< Channel on which the node receives messages.
-    nrf_802154_pib_coex_t   coex;                                 ///< Coex-related fields.
+    int8_t                        tx_power;                                  ///< Transmit power.
+    nrf_802154_pib_pan_context_t  pan_contexts[NRF_802154_PAN_CONTEXTS_NUM]; ///< Address contexts of this node. Context 0 holds the primary addresses.
+    nrf_802154_pan_context_mask_t pan_contexts_enabled;                      ///< Mask of enabled address contexts.
+    nrf_802154_cca_cfg_t          cca;                                       ///< CCA mode and thresholds.
+    bool                          promiscuous : 1;                           ///< Indicating if radio is in promiscuous mode.
+    bool                          auto_ack    : 1;                           ///< Indicating if auto ACK procedure is enabled.
+    bool                          pan_coord   : 1;                           ///< Indicating if radio is configured as the PAN coordinator.
+    uint8_t                       channel     : 5;                           ///< Channel on which the node receives messages.
+    nrf_802154_pib_coex_t         coex;                                      ///< Coex-related fields.
 
 #if NRF_802154_CSMA_CA_ENABLED
-    nrf_802154_pib_csmaca_t csmaca;                               ///< CSMA-CA related fields.
+    nrf_802154_pib_csmaca_t csmaca;                                            ///< CSMA-CA related fields.
 
 #endif
 
@@ -232,10 +242,17 @@ void nrf_802154_pib_init(void)
     m_data.pan_coord   = false;
     m_data.channel     = 11;
 
-    memset(m_data.pan_id, 0xff, sizeof(m_data.pan_id));
-    m_data.short_addr[0] = 0xfe;
-    m_data.short_addr[1] = 0xff;
-    memset(m_data.extended_addr, 0, sizeof(m_data.extended_addr));
+    for (uint32_t i = 0; i < NRF_802154_PAN_CONTEXTS_NUM; i++)
+    {
+        nrf_802154_pib_pan_context_t * p_context = &m_data.pan_contexts[i];
+
+        memset(p_context->pan_id, 0xff, sizeof(p_context->pan_id));
+        p_context->short_addr[0] = 0xfe;
+        p_context->short_addr[1] = 0xff;
+        memset(p_context->extended_addr, 0, sizeof(p_context->extended_addr));
+    }
+
+    m_data.pan_contexts_enabled = 1U;
 
     m_data.cca.mode           = NRF_802154_CCA_MODE_DEFAULT;
     m_data.cca.ed_threshold   = NRF_802154_CCA_ED_THRESHOLD_DEFAULT;
@@ -309,6 +326,21 @@ nrf_radio_txpower_t nrf_802154_pib_tx_power_get(void)
     return to_radio_tx_power_convert(tx_power);
 }
 
+nrf_radio_txpower_t nrf_802154_pib_tx_power_attenuated_get(uint8_t attenuation)
+{
+    int32_t power = (int32_t)m_data.tx_power - (int32_t)attenuation;
+    int8_t  tx_power;
+
+    if (power < INT8_MIN)
+    {
+        power = INT8_MIN;
+    }
+
+    tx_power = nrf_802154_fal_tx_power_get(m_data.channel, (int8_t)power);
+
+    return to_radio_tx_power_convert(tx_power);
+}
+
 void nrf_802154_pib_tx_power_set(int8_t dbm)
 {
     m_data.tx_power = dbm;
@@ -316,32 +348,91 @@ void nrf_802154_pib_tx_power_set(int8_t dbm)
 
 const uint8_t * nrf_802154_pib_pan_id_get(void)
 {
-    return m_data.pan_id;
+    return m_data.pan_contexts[0].pan_id;
 }
 
 void nrf_802154_pib_pan_id_set(const uint8_t * p_pan_id)
 {
-    memcpy(m_data.pan_id, p_pan_id, PAN_ID_SIZE);
+    memcpy(m_data.pan_contexts[0].pan_id, p_pan_id, PAN_ID_SIZE);
 }
 
 const uint8_t * nrf_802154_pib_extended_address_get(void)
 {
-    return m_data.extended_addr;
+    return m_data.pan_contexts[0].extended_addr;
 }
 
 void nrf_802154_pib_extended_address_set(const uint8_t * p_extended_address)
 {
-    memcpy(m_data.extended_addr, p_extended_address, EXTENDED_ADDRESS_SIZE);
+    memcpy(m_data.pan_contexts[0].extended_addr, p_extended_address, EXTENDED_ADDRESS_SIZE);
 }
 
 const uint8_t * nrf_802154_pib_short_address_get(void)
 {
-    return m_data.short_addr;
+    return m_data.pan_contexts[0].short_addr;
 }
 
 void nrf_802154_pib_short_address_set(const uint8_t * p_short_address)
 {
-    memcpy(m_data.short_addr, p_short_address, SHORT_ADDRESS_SIZE);
+    memcpy(m_data.pan_contexts[0].short_addr, p_short_address, SHORT_ADDRESS_SIZE);
+}
+
+bool nrf_802154_pib_pan_context_set(uint8_t         context,
+                                    const uint8_t * p_pan_id,
+                                    const uint8_t * p_short_address,
+                                    const uint8_t * p_extended_address)
+{
+    if (context >= NRF_802154_PAN_CONTEXTS_NUM)
+    {
+        return false;
+    }
+
+    nrf_802154_pib_pan_context_t * p_context = &m_data.pan_contexts[context];
+
+    memcpy(p_context->pan_id, p_pan_id, PAN_ID_SIZE);
+    memcpy(p_context->short_addr, p_short_address, SHORT_ADDRESS_SIZE);
+    memcpy(p_context->extended_addr, p_extended_address, EXTENDED_ADDRESS_SIZE);
+
+    m_data.pan_contexts_enabled |= (nrf_802154_pan_context_mask_t)(1U << context);
+
+    return true;
+}
+
+bool nrf_802154_pib_pan_context_clear(uint8_t context)
+{
+    if ((context == 0U) || (context >= NRF_802154_PAN_CONTEXTS_NUM))
+    {
+        return false;
+    }
+
+    m_data.pan_contexts_enabled &= (nrf_802154_pan_context_mask_t)~(1U << context);
+
+    return true;
+}
+
+nrf_802154_pan_context_mask_t nrf_802154_pib_pan_contexts_enabled_get(void)
+{
+    return m_data.pan_contexts_enabled;
+}
+
+const uint8_t * nrf_802154_pib_pan_context_pan_id_get(uint8_t context)
+{
+    assert(context < NRF_802154_PAN_CONTEXTS_NUM);
+
+    return m_data.pan_contexts[context].pan_id;
+}
+
+const uint8_t * nrf_802154_pib_pan_context_short_address_get(uint8_t context)
+{
+    assert(context < NRF_802154_PAN_CONTEXTS_NUM);
+
+    return m_data.pan_contexts[context].short_addr;
+}
+
+const uint8_t * nrf_802154_pib_pan_context_extended_address_get(uint8_t context)
+{
+    assert(context < NRF_802154_PAN_CONTEXTS_NUM);
+
+    return m_data.pan_contexts[context].extended_addr;
 }
 
 void nrf_802154_pib_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
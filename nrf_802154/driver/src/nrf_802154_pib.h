@@ -120,6 +120,15 @@ void nrf_802154_pib_channel_set(uint8_t channel);
  */
 nrf_radio_txpower_t nrf_802154_pib_tx_power_get(void);
 
+/**
+ * @brief Gets the transmit power reduced by the given attenuation.
+ *
+ * @param[in]  attenuation  Number of dB by which the transmit power is to be reduced.
+ *
+ * @returns  Reduced transmit power.
+ */
+nrf_radio_txpower_t nrf_802154_pib_tx_power_attenuated_get(uint8_t attenuation);
+
 /**
  * @brief Sets the transmit power used for ACK frames.
  *
@@ -175,6 +184,69 @@ const uint8_t * nrf_802154_pib_short_address_get(void);
  */
 void nrf_802154_pib_short_address_set(const uint8_t * p_short_address);
 
+/**
+ * @brief Sets the addresses of an address context.
+ *
+ * Setting context 0 is equivalent to setting the PAN ID, the short address and the extended
+ * address of this device.
+ *
+ * @param[in]  context            Index of the address context.
+ * @param[in]  p_pan_id           Pointer to the PAN ID (2 bytes, little-endian).
+ * @param[in]  p_short_address    Pointer to the short address (2 bytes, little-endian).
+ * @param[in]  p_extended_address Pointer to the extended address (8 bytes, little-endian).
+ *
+ * @retval  true   The address context was set and enabled.
+ * @retval  false  The index of the address context is invalid.
+ */
+bool nrf_802154_pib_pan_context_set(uint8_t         context,
+                                    const uint8_t * p_pan_id,
+                                    const uint8_t * p_short_address,
+                                    const uint8_t * p_extended_address);
+
+/**
+ * @brief Disables an address context.
+ *
+ * @param[in]  context  Index of the address context. Context 0 cannot be disabled.
+ *
+ * @retval  true   The address context was disabled.
+ * @retval  false  The index of the address context is invalid.
+ */
+bool nrf_802154_pib_pan_context_clear(uint8_t context);
+
+/**
+ * @brief Gets the mask of enabled address contexts.
+ *
+ * @returns Mask of enabled address contexts. Bit 0 is always set.
+ */
+nrf_802154_pan_context_mask_t nrf_802154_pib_pan_contexts_enabled_get(void);
+
+/**
+ * @brief Gets the PAN ID of an address context.
+ *
+ * @param[in]  context  Index of the address context.
+ *
+ * @returns Pointer to the buffer containing the PAN ID value (2 bytes, little-endian).
+ */
+const uint8_t * nrf_802154_pib_pan_context_pan_id_get(uint8_t context);
+
+/**
+ * @brief Gets the short address of an address context.
+ *
+ * @param[in]  context  Index of the address context.
+ *
+ * @returns Pointer to the buffer containing the short address (2 bytes, little-endian).
+ */
+const uint8_t * nrf_802154_pib_pan_context_short_address_get(uint8_t context);
+
+/**
+ * @brief Gets the extended address of an address context.
+ *
+ * @param[in]  context  Index of the address context.
+ *
+ * @returns Pointer to the buffer containing the extended address (8 bytes, little-endian).
+ */
+const uint8_t * nrf_802154_pib_pan_context_extended_address_get(uint8_t context);
+
 /**
  * @brief Sets the radio CCA mode and threshold.
  *
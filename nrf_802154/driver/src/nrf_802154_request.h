@@ -108,6 +108,25 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  bool                           immediate,
                                  nrf_802154_notification_func_t notify_function);
 
+/**
+ * @brief Requests the transmission of a frame from the TX queue.
+ *
+ * @param[in]  term_lvl         Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig         Module that originates this request.
+ * @param[in]  p_data           Pointer to the frame to add to the TX queue. If NULL, the driver
+ *                              only continues with the next queued frame.
+ * @param[in]  cca              If the driver is to perform the CCA procedure before transmission.
+ * @param[in]  notify_function  Function called to notify the status of this procedure. May be NULL.
+ *
+ * @retval  true   The frame was accepted or the transmission of queued frames continues.
+ * @retval  false  The TX queue is full or the driver cannot transmit due to an ongoing operation.
+ */
+bool nrf_802154_request_tx_queue_transmit(nrf_802154_term_t              term_lvl,
+                                          req_originator_t               req_orig,
+                                          const uint8_t                * p_data,
+                                          bool                           cca,
+                                          nrf_802154_notification_func_t notify_function);
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state.
  *
@@ -119,6 +138,20 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
  */
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+/**
+ * @brief Requests entering the @ref RADIO_STATE_ED state to scan multiple channels.
+ *
+ * @param[in]  term_lvl       Termination level of this request. Selects procedures to abort.
+ * @param[in]  channel_mask   Mask of channels to scan.
+ * @param[in]  dwell_time_us  Requested duration of the energy detection on each channel.
+ *
+ * @retval  true   The driver will enter energy detection state.
+ * @retval  false  The driver cannot enter the energy detection state due to an ongoing operation.
+ */
+bool nrf_802154_request_energy_scan(nrf_802154_term_t term_lvl,
+                                    uint32_t          channel_mask,
+                                    uint32_t          dwell_time_us);
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state.
  *
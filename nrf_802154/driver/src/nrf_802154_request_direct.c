@@ -100,11 +100,35 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                            notify_function)
 }
 
+#if NRF_802154_TX_QUEUE_SIZE
+bool nrf_802154_request_tx_queue_transmit(nrf_802154_term_t              term_lvl,
+                                          req_originator_t               req_orig,
+                                          const uint8_t                * p_data,
+                                          bool                           cca,
+                                          nrf_802154_notification_func_t notify_function)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_tx_queue_transmit,
+                           term_lvl,
+                           req_orig,
+                           p_data,
+                           cca,
+                           notify_function)
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_detection, term_lvl, time_us)
 }
 
+bool nrf_802154_request_energy_scan(nrf_802154_term_t term_lvl,
+                                    uint32_t          channel_mask,
+                                    uint32_t          dwell_time_us)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_scan, term_lvl, channel_mask, dwell_time_us)
+}
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_cca, term_lvl)
@@ -75,7 +75,9 @@ typedef enum
     REQ_TYPE_SLEEP,
     REQ_TYPE_RECEIVE,
     REQ_TYPE_TRANSMIT,
+    REQ_TYPE_TX_QUEUE_TRANSMIT,
     REQ_TYPE_ENERGY_DETECTION,
+    REQ_TYPE_ENERGY_SCAN,
     REQ_TYPE_CCA,
     REQ_TYPE_CONTINUOUS_CARRIER,
     REQ_TYPE_MODULATED_CARRIER,
@@ -121,6 +123,16 @@ typedef struct
             bool                         * p_result;   ///< Transmit request result.
         } transmit;                                    ///< Transmit request details.
 
+        struct
+        {
+            nrf_802154_notification_func_t notif_func; ///< Error notified in case of success.
+            nrf_802154_term_t              term_lvl;   ///< Request priority.
+            req_originator_t               req_orig;   ///< Request originator.
+            const uint8_t                * p_data;     ///< Pointer to a buffer containing PHR and PSDU of the frame to queue.
+            bool                           cca;        ///< If CCA was requested prior to transmission.
+            bool                         * p_result;   ///< TX queue transmit request result.
+        } tx_queue_transmit;                           ///< TX queue transmit request details.
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -128,6 +140,14 @@ typedef struct
             uint32_t          time_us;  ///< Requested time of energy detection procedure.
         } energy_detection;             ///< Energy detection request details.
 
+        struct
+        {
+            nrf_802154_term_t term_lvl;      ///< Request priority.
+            bool            * p_result;      ///< Energy scan request result.
+            uint32_t          channel_mask;  ///< Mask of channels to scan.
+            uint32_t          dwell_time_us; ///< Requested time of energy detection on each channel.
+        } energy_scan;                       ///< Energy scan request details.
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -356,6 +376,40 @@ static void swi_transmit(nrf_802154_term_t              term_lvl,
     req_exit();
 }
 
+#if NRF_802154_TX_QUEUE_SIZE
+/**
+ * @brief Requests the transmission of a frame from the TX queue from the SWI priority.
+ *
+ * @param[in]   term_lvl         Termination level of this request. Selects procedures to abort.
+ * @param[in]   req_orig         Module that originates this request.
+ * @param[in]   p_data           Pointer to a buffer that contains PHR and PSDU of the frame to be
+ *                               queued, or NULL.
+ * @param[in]   cca              If the driver should perform the CCA procedure before transmission.
+ * @param[in]   notify_function  Function called to notify the status of the procedure. May be NULL.
+ * @param[out]  p_result         Result of the request.
+ */
+static void swi_tx_queue_transmit(nrf_802154_term_t              term_lvl,
+                                  req_originator_t               req_orig,
+                                  const uint8_t                * p_data,
+                                  bool                           cca,
+                                  nrf_802154_notification_func_t notify_function,
+                                  bool                         * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                              = REQ_TYPE_TX_QUEUE_TRANSMIT;
+    p_slot->data.tx_queue_transmit.term_lvl   = term_lvl;
+    p_slot->data.tx_queue_transmit.req_orig   = req_orig;
+    p_slot->data.tx_queue_transmit.p_data     = p_data;
+    p_slot->data.tx_queue_transmit.cca        = cca;
+    p_slot->data.tx_queue_transmit.notif_func = notify_function;
+    p_slot->data.tx_queue_transmit.p_result   = p_result;
+
+    req_exit();
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state from the SWI priority.
  *
@@ -377,6 +431,31 @@ static void swi_energy_detection(nrf_802154_term_t term_lvl,
     req_exit();
 }
 
+/**
+ * @brief Requests entering the @ref RADIO_STATE_ED state to scan multiple channels from the SWI
+ *        priority.
+ *
+ * @param[in]   term_lvl       Termination level of this request. Selects procedures to abort.
+ * @param[in]   channel_mask   Mask of channels to scan.
+ * @param[in]   dwell_time_us  Requested duration of the energy detection on each channel.
+ * @param[out]  p_result       Result of entering the energy detection state.
+ */
+static void swi_energy_scan(nrf_802154_term_t term_lvl,
+                            uint32_t          channel_mask,
+                            uint32_t          dwell_time_us,
+                            bool            * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                           = REQ_TYPE_ENERGY_SCAN;
+    p_slot->data.energy_scan.term_lvl      = term_lvl;
+    p_slot->data.energy_scan.channel_mask  = channel_mask;
+    p_slot->data.energy_scan.dwell_time_us = dwell_time_us;
+    p_slot->data.energy_scan.p_result      = p_result;
+
+    req_exit();
+}
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state from the SWI priority.
  *
@@ -582,6 +661,24 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                      notify_function)
 }
 
+#if NRF_802154_TX_QUEUE_SIZE
+bool nrf_802154_request_tx_queue_transmit(nrf_802154_term_t              term_lvl,
+                                          req_originator_t               req_orig,
+                                          const uint8_t                * p_data,
+                                          bool                           cca,
+                                          nrf_802154_notification_func_t notify_function)
+{
+    REQUEST_FUNCTION(nrf_802154_core_tx_queue_transmit,
+                     swi_tx_queue_transmit,
+                     term_lvl,
+                     req_orig,
+                     p_data,
+                     cca,
+                     notify_function)
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
                                          uint32_t          time_us)
 {
@@ -591,6 +688,17 @@ bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
                      time_us)
 }
 
+bool nrf_802154_request_energy_scan(nrf_802154_term_t term_lvl,
+                                    uint32_t          channel_mask,
+                                    uint32_t          dwell_time_us)
+{
+    REQUEST_FUNCTION(nrf_802154_core_energy_scan,
+                     swi_energy_scan,
+                     term_lvl,
+                     channel_mask,
+                     dwell_time_us)
+}
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION(nrf_802154_core_cca, swi_cca, term_lvl)
@@ -678,6 +786,18 @@ static void irq_handler_req_event(void)
                                              p_slot->data.transmit.notif_func);
                 break;
 
+#if NRF_802154_TX_QUEUE_SIZE
+            case REQ_TYPE_TX_QUEUE_TRANSMIT:
+                *(p_slot->data.tx_queue_transmit.p_result) =
+                    nrf_802154_core_tx_queue_transmit(
+                        p_slot->data.tx_queue_transmit.term_lvl,
+                        p_slot->data.tx_queue_transmit.req_orig,
+                        p_slot->data.tx_queue_transmit.p_data,
+                        p_slot->data.tx_queue_transmit.cca,
+                        p_slot->data.tx_queue_transmit.notif_func);
+                break;
+#endif // NRF_802154_TX_QUEUE_SIZE
+
             case REQ_TYPE_ENERGY_DETECTION:
                 *(p_slot->data.energy_detection.p_result) =
                     nrf_802154_core_energy_detection(
@@ -685,6 +805,14 @@ static void irq_handler_req_event(void)
                         p_slot->data.energy_detection.time_us);
                 break;
 
+            case REQ_TYPE_ENERGY_SCAN:
+                *(p_slot->data.energy_scan.p_result) =
+                    nrf_802154_core_energy_scan(
+                        p_slot->data.energy_scan.term_lvl,
+                        p_slot->data.energy_scan.channel_mask,
+                        p_slot->data.energy_scan.dwell_time_us);
+                break;
+
             case REQ_TYPE_CCA:
                 *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
                 break;
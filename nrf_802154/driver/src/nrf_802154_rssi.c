@@ -40,6 +40,7 @@
 #include "nrf_802154_rssi.h"
 
 #include "nrf.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "platform/nrf_802154_temperature.h"
@@ -47,11 +48,10 @@
 #if defined(NRF52_SERIES)
 
 /* Implementation for nRF52 family. */
-int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+static int8_t corr_value_calculate(uint8_t rssi_sample, int8_t temp)
 {
     (void)rssi_sample;
 
-    int8_t temp = nrf_802154_temperature_get();
     int8_t result;
 
 #if defined(NRF52840_XXAA) || defined(NRF52820_XXAA) || defined(NRF52833_XXAA)
@@ -90,6 +90,7 @@ int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
     }
 #else
     /* Implementation for other SoCs from nRF52 family */
+    (void)temp;
     result = 0;
 #endif
     return result;
@@ -133,19 +134,19 @@ static int8_t normalize_rssi(int32_t rssi_value)
 }
 
 /* Implementation based on Errata 87 for nRF53 family. */
-int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+static int8_t corr_value_calculate(uint8_t rssi_sample, int8_t temp)
 {
-    int32_t temp;
+    int32_t temp_i32;
     int32_t rssi_sample_i32;
     int8_t  compensated_rssi;
 
-    temp            = (int32_t)nrf_802154_temperature_get();
+    temp_i32        = (int32_t)temp;
     rssi_sample_i32 = (int32_t)rssi_sample;
 
     compensated_rssi = normalize_rssi((RSSI_COEFF_A1 * rssi_sample_i32)
                                       + (RSSI_COEFF_A3 * POW_3(rssi_sample_i32))
                                       - (RSSI_COEFF_A2 * POW_2(rssi_sample_i32))
-                                      - (RSSI_COEFF_TEMP * temp) - RSSI_COEFF_A0);
+                                      - (RSSI_COEFF_TEMP * temp_i32) - RSSI_COEFF_A0);
 
     return compensated_rssi - (int8_t)rssi_sample;
 }
@@ -154,22 +155,72 @@ int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
 #error Unsupported chip family
 #endif
 
+#define CORR_TABLE_SIZE (UINT8_MAX + 1) ///< Number of entries of each correction table.
+
+/// Correction tables calculated for a single temperature.
+typedef struct
+{
+    uint8_t sample_corrected[CORR_TABLE_SIZE]; ///< RSSISAMPLE values corrected for @ref temp, indexed by the raw value.
+    uint8_t value_corrected[CORR_TABLE_SIZE];  ///< LQI, EDSAMPLE and CCA ED threshold values corrected for @ref temp, indexed by the raw value.
+    int8_t  temp;                              ///< Temperature the tables were calculated for.
+} corr_tables_t;
+
+static corr_tables_t                   m_corr_tables[2];                   ///< Correction tables. One set is in use while the other one is recalculated.
+static const corr_tables_t * volatile mp_corr_tables = &m_corr_tables[0]; ///< Pointer to the set of correction tables in use.
+static bool                            m_corr_tables_valid;                ///< Flag indicating if the correction tables were calculated.
+
+void nrf_802154_rssi_temperature_update(void)
+{
+    int8_t                temp     = nrf_802154_temperature_get();
+    const corr_tables_t * p_active = mp_corr_tables;
+    corr_tables_t       * p_next;
+
+    if (m_corr_tables_valid && (temp == p_active->temp))
+    {
+        return;
+    }
+
+    // The radio IRQ handler may read the tables in use at any time, so the other set is
+    // recalculated and swapped in when complete.
+    p_next = (p_active == &m_corr_tables[0]) ? &m_corr_tables[1] : &m_corr_tables[0];
+
+    for (uint32_t i = 0; i < CORR_TABLE_SIZE; i++)
+    {
+        int8_t corr = corr_value_calculate((uint8_t)i, temp);
+
+        p_next->sample_corrected[i] = (uint8_t)i + corr;
+        p_next->value_corrected[i]  = (uint8_t)i - corr;
+    }
+
+    p_next->temp = temp;
+
+    __DMB();
+
+    mp_corr_tables      = p_next;
+    m_corr_tables_valid = true;
+}
+
+int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+{
+    return (int8_t)(mp_corr_tables->sample_corrected[rssi_sample] - rssi_sample);
+}
+
 uint8_t nrf_802154_rssi_sample_corrected_get(uint8_t rssi_sample)
 {
-    return rssi_sample + nrf_802154_rssi_sample_temp_corr_value_get(rssi_sample);
+    return mp_corr_tables->sample_corrected[rssi_sample];
 }
 
 uint8_t nrf_802154_rssi_lqi_corrected_get(uint8_t lqi)
 {
-    return lqi - nrf_802154_rssi_sample_temp_corr_value_get(lqi);
+    return mp_corr_tables->value_corrected[lqi];
 }
 
 uint8_t nrf_802154_rssi_ed_corrected_get(uint8_t ed)
 {
-    return ed - nrf_802154_rssi_sample_temp_corr_value_get(ed);
+    return mp_corr_tables->value_corrected[ed];
 }
 
 uint8_t nrf_802154_rssi_cca_ed_threshold_corrected_get(uint8_t cca_ed)
 {
-    return cca_ed - nrf_802154_rssi_sample_temp_corr_value_get(cca_ed);
+    return mp_corr_tables->value_corrected[cca_ed];
 }
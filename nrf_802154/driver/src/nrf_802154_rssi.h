@@ -44,10 +44,23 @@
  * @brief RSSI calculations used internally in the 802.15.4 driver.
  */
 
+/**
+ * @brief Recalculates the temperature correction tables.
+ *
+ * The correction functions below read precalculated tables instead of evaluating the correction
+ * formulas for each sample. This function recalculates the tables for the temperature reported
+ * by @ref nrf_802154_temperature_get if it differs from the one they were calculated for.
+ * It must be called during initialization and whenever the temperature changes. The tables in
+ * use are replaced only when the new ones are complete, so the correction functions may preempt
+ * this function.
+ */
+void nrf_802154_rssi_temperature_update(void);
+
 /**
  * @brief Gets the RSSISAMPLE temperature correction value.
  *
- * The correction value is based on the last temperature value reported by the platform.
+ * The correction value is based on the temperature passed to the last call to
+ * @ref nrf_802154_rssi_temperature_update.
  *
  * @param[in]  rssi_sample  Value read from the RSSISAMPLE register.
  *
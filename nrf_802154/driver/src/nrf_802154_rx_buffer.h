@@ -44,6 +44,7 @@
 #include <stdint.h>
 
 #include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -54,8 +55,9 @@ extern "C" {
  */
 typedef struct
 {
-    uint8_t data[MAX_PACKET_SIZE + 1];
-    bool    free; // If this buffer is free or contains a frame.
+    uint8_t                       data[MAX_PACKET_SIZE + 1];
+    bool                          free;         // If this buffer is free or contains a frame.
+    nrf_802154_pan_context_mask_t pan_contexts; // Address contexts the contained frame was accepted in.
 } rx_buffer_t;
 
 /**
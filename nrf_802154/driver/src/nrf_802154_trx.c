@@ -678,8 +678,8 @@ static void rx_antenna_update(void)
 /**
  * Updates the antenna for transmission, according to antenna diversity configuration.
  *
- * Antenna diversity for tx is not currently supported. If antenna diversity is not
- * in disabled state, default antenna will always be used for transmission.
+ * In automatic mode, the antenna diversity module provides the antenna selected for
+ * the destination of the frame being transmitted.
  */
 static void tx_antenna_update(void)
 {
@@ -694,11 +694,11 @@ static void tx_antenna_update(void)
             break;
 
         case NRF_802154_SL_ANT_DIV_MODE_MANUAL:
+        case NRF_802154_SL_ANT_DIV_MODE_AUTO:
             result = nrf_802154_sl_ant_div_antenna_set(
                 nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX));
             break;
 
-        case NRF_802154_SL_ANT_DIV_MODE_AUTO:
         default:
             assert(false);
             break;
@@ -1074,6 +1074,7 @@ bool nrf_802154_trx_rssi_sample_is_available(void)
 
 void nrf_802154_trx_transmit_frame(const void                            * p_transmit_buffer,
                                    bool                                    cca,
+                                   nrf_radio_txpower_t                     tx_power,
                                    nrf_802154_trx_transmit_notifications_t notifications_mask)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -1086,7 +1087,7 @@ void nrf_802154_trx_transmit_frame(const void                            * p_tra
     m_trx_state         = TRX_STATE_TXFRAME;
     m_transmit_with_cca = cca;
 
-    nrf_radio_txpower_set(NRF_RADIO, nrf_802154_pib_tx_power_get());
+    nrf_radio_txpower_set(NRF_RADIO, tx_power);
     nrf_radio_packetptr_set(NRF_RADIO, p_transmit_buffer);
 
     // Set shorts
@@ -340,12 +340,15 @@ bool nrf_802154_trx_receive_buffer_set(void * p_receive_buffer);
  *                           real transmission. If false no cca will be performed.
  *                           If true, cca will be performed.
  *
+ * @param tx_power           Transmit power to be used for the frame.
+ *
  * @param notifications_mask Selects additional notifications generated during a frame transmission.
  *                           It is bitwise combination of @ref nrf_802154_trx_transmit_notifications_t values.
  * @note To transmit ack after frame is received use @ref nrf_802154_trx_transmit_ack.
  */
 void nrf_802154_trx_transmit_frame(const void                            * p_transmit_buffer,
                                    bool                                    cca,
+                                   nrf_radio_txpower_t                     tx_power,
                                    nrf_802154_trx_transmit_notifications_t notifications_mask);
 
 /**@brief Puts the trx module into transmit ACK mode.
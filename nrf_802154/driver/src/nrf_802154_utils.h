@@ -41,6 +41,9 @@
 #include <nrfx.h>
 #include <soc/nrfx_coredep.h>
 
+#include "nrf_802154_config.h"
+#include "nrf_802154_crit_sect_prof.h"
+
 /**
  * @defgroup nrf_802154_utils Utils definitions used in the 802.15.4 driver
  * @{
@@ -110,6 +113,11 @@ typedef uint32_t nrf_802154_mcu_critical_state_t;
     {                                                     \
         (mcu_critical_state) = __get_PRIMASK();           \
         __disable_irq();                                  \
+        if (NRF_802154_CRIT_SECT_PROF_ENABLED &&          \
+            ((mcu_critical_state) == 0))                  \
+        {                                                 \
+            nrf_802154_crit_sect_prof_irq_masked();       \
+        }                                                 \
     }                                                     \
     while (0)
 
@@ -124,6 +132,11 @@ typedef uint32_t nrf_802154_mcu_critical_state_t;
 #define nrf_802154_mcu_critical_exit(mcu_critical_state) \
     do                                                   \
     {                                                    \
+        if (NRF_802154_CRIT_SECT_PROF_ENABLED &&         \
+            ((mcu_critical_state) == 0))                 \
+        {                                                \
+            nrf_802154_crit_sect_prof_irq_unmasked();    \
+        }                                                \
         __set_PRIMASK(mcu_critical_state);               \
     }                                                    \
     while (0)
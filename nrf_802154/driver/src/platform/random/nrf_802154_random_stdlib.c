@@ -98,3 +98,11 @@ uint32_t nrf_802154_random_get(void)
 {
     return (uint32_t)rand();
 }
+
+#if !NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+void nrf_802154_random_irq_handler(void)
+{
+    // Intentionally empty
+}
+
+#endif // !NRF_802154_INTERNAL_RNG_IRQ_HANDLING
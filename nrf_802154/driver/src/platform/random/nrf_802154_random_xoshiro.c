@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the pseudo-random number generator abstraction layer.
+ *
+ * This pseudo-random number abstraction layer uses the xoshiro128** generator. Its state is seeded
+ * with entropy read from the RNG peripheral during initialization, so that devices started at
+ * the same time do not produce the same numbers. Later, the state is periodically mixed with
+ * entropy collected in the background by the RNG interrupt handler, so generation of a number
+ * never waits for the peripheral.
+ *
+ */
+
+#include "nrf_802154_random.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf.h"
+#include "nrf_802154_config.h"
+
+#if RAAL_SOFTDEVICE
+
+#if defined (__GNUC__)
+_Pragma("GCC diagnostic push")
+_Pragma("GCC diagnostic ignored \"-Wreturn-type\"")
+_Pragma("GCC diagnostic ignored \"-Wunused-parameter\"")
+_Pragma("GCC diagnostic ignored \"-Wpedantic\"")
+#endif
+
+#include <nrf_soc.h>
+
+#if defined (__GNUC__)
+_Pragma("GCC diagnostic pop")
+#endif
+
+#endif // RAAL_SOFTDEVICE
+
+#define STATE_WORDS 4                            ///< Number of 32-bit words of the generator state.
+#define POOL_SIZE   (STATE_WORDS * sizeof(uint32_t)) ///< Number of entropy bytes mixed in at once.
+
+#if NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+#define RNG_IRQ_HANDLER RNG_IRQHandler                ///< Symbol of RNG IRQ handler.
+#else
+#define RNG_IRQ_HANDLER nrf_802154_random_irq_handler ///< Symbol of RNG IRQ handler.
+#endif
+
+/// Generator state the entropy is mixed into (splitmix64 outputs of 0).
+static const uint32_t m_initial_state[STATE_WORDS] =
+{
+    0x6457827dUL, 0xe220a839UL, 0x3ab7b1ffUL, 0x910a2decUL,
+};
+
+static uint32_t m_state[STATE_WORDS];   ///< Generator state.
+static uint32_t m_outputs;              ///< Numbers generated since the last reseed.
+static bool     m_reseed_pending;       ///< Entropy collection has been requested.
+
+#if !RAAL_SOFTDEVICE
+static uint8_t       m_pool[POOL_SIZE]; ///< Entropy collected from the RNG peripheral.
+static uint8_t       m_pool_bytes;      ///< Number of bytes collected in @ref m_pool.
+static volatile bool m_pool_ready;      ///< @ref m_pool is full and can be mixed in.
+#endif
+
+static inline uint32_t rotl(uint32_t value, uint32_t shift)
+{
+    return (value << shift) | (value >> (32U - shift));
+}
+
+/**
+ * @brief Mixes entropy into the generator state.
+ *
+ * @param[in]  p_entropy  Pointer to @ref POOL_SIZE bytes of entropy.
+ */
+static void state_mix(const uint8_t * p_entropy)
+{
+    uint32_t any = 0;
+
+    for (uint32_t i = 0; i < STATE_WORDS; i++)
+    {
+        uint32_t word = (uint32_t)p_entropy[4 * i] |
+                        ((uint32_t)p_entropy[4 * i + 1] << 8) |
+                        ((uint32_t)p_entropy[4 * i + 2] << 16) |
+                        ((uint32_t)p_entropy[4 * i + 3] << 24);
+
+        m_state[i] ^= word;
+        any        |= m_state[i];
+    }
+
+    // All-zero state is the only one xoshiro never leaves.
+    if (any == 0)
+    {
+        m_state[0] = m_initial_state[0];
+    }
+
+    m_outputs = 0;
+}
+
+#if RAAL_SOFTDEVICE
+
+/**
+ * @brief Gets entropy from the SoftDevice, waiting until it is available.
+ *
+ * @param[out]  p_entropy  Pointer to a buffer of @ref POOL_SIZE bytes.
+ */
+static void entropy_read(uint8_t * p_entropy)
+{
+    uint32_t result;
+
+    do
+    {
+        result = sd_rand_application_vector_get(p_entropy, POOL_SIZE);
+    }
+    while (result != NRF_SUCCESS);
+}
+
+/**
+ * @brief Tries to get entropy from the SoftDevice without waiting for it.
+ */
+static void reseed_try(void)
+{
+    uint8_t entropy[POOL_SIZE];
+
+    if (sd_rand_application_vector_get(entropy, sizeof(entropy)) == NRF_SUCCESS)
+    {
+        state_mix(entropy);
+        m_reseed_pending = false;
+    }
+}
+
+#else // RAAL_SOFTDEVICE
+
+/**
+ * @brief Reads entropy from the RNG peripheral, waiting until it is available.
+ *
+ * @param[out]  p_entropy  Pointer to a buffer of @ref POOL_SIZE bytes.
+ */
+static void entropy_read(uint8_t * p_entropy)
+{
+    NRF_RNG->EVENTS_VALRDY = 0;
+    NRF_RNG->TASKS_START   = 1;
+
+    for (uint32_t i = 0; i < POOL_SIZE; i++)
+    {
+        while (!NRF_RNG->EVENTS_VALRDY)
+        {
+            // Intentionally empty
+        }
+
+        NRF_RNG->EVENTS_VALRDY = 0;
+        p_entropy[i]           = (uint8_t)NRF_RNG->VALUE;
+    }
+
+    NRF_RNG->TASKS_STOP = 1;
+}
+
+/**
+ * @brief Starts collecting entropy from the RNG peripheral in the background.
+ */
+static void entropy_collect_start(void)
+{
+    m_pool_bytes = 0;
+    m_pool_ready = false;
+
+    NRF_RNG->EVENTS_VALRDY = 0;
+    NRF_RNG->INTENSET      = RNG_INTENSET_VALRDY_Msk;
+    NRF_RNG->TASKS_START   = 1;
+}
+
+/**
+ * @brief Mixes collected entropy into the generator state if it is available.
+ */
+static void reseed_try(void)
+{
+    if (m_pool_ready)
+    {
+        state_mix(m_pool);
+        m_pool_ready     = false;
+        m_reseed_pending = false;
+    }
+}
+
+#endif // RAAL_SOFTDEVICE
+
+void nrf_802154_random_init(void)
+{
+    uint8_t entropy[POOL_SIZE];
+
+    for (uint32_t i = 0; i < STATE_WORDS; i++)
+    {
+        m_state[i] = m_initial_state[i];
+    }
+
+    m_reseed_pending = false;
+
+#if !RAAL_SOFTDEVICE
+    m_pool_bytes = 0;
+    m_pool_ready = false;
+#endif
+
+    // The first number must already depend on the entropy, so the seed is read synchronously.
+    entropy_read(entropy);
+    state_mix(entropy);
+
+#if !RAAL_SOFTDEVICE && NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+    // Otherwise the RNG IRQ is owned by the OS, which passes it to nrf_802154_random_irq_handler.
+    NVIC_ClearPendingIRQ(RNG_IRQn);
+    NVIC_EnableIRQ(RNG_IRQn);
+#endif // !RAAL_SOFTDEVICE && NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+}
+
+void nrf_802154_random_deinit(void)
+{
+#if !RAAL_SOFTDEVICE
+#if NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+    NVIC_DisableIRQ(RNG_IRQn);
+#endif
+
+    NRF_RNG->INTENCLR      = RNG_INTENCLR_VALRDY_Msk;
+    NRF_RNG->TASKS_STOP    = 1;
+    NRF_RNG->EVENTS_VALRDY = 0;
+
+#if NRF_802154_INTERNAL_RNG_IRQ_HANDLING
+    NVIC_ClearPendingIRQ(RNG_IRQn);
+#endif
+#endif // !RAAL_SOFTDEVICE
+}
+
+uint32_t nrf_802154_random_get(void)
+{
+    uint32_t result;
+    uint32_t t;
+
+    if (m_reseed_pending)
+    {
+        reseed_try();
+    }
+
+    result = rotl(m_state[1] * 5U, 7) * 9U;
+    t      = m_state[1] << 9;
+
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= t;
+    m_state[3]  = rotl(m_state[3], 11);
+
+    if (!m_reseed_pending && (++m_outputs >= NRF_802154_RANDOM_RESEED_INTERVAL))
+    {
+        m_reseed_pending = true;
+#if !RAAL_SOFTDEVICE
+        entropy_collect_start();
+#endif
+    }
+
+    return result;
+}
+
+void RNG_IRQ_HANDLER(void)
+{
+#if !RAAL_SOFTDEVICE
+    if (NRF_RNG->EVENTS_VALRDY)
+    {
+        NRF_RNG->EVENTS_VALRDY = 0;
+
+        if (m_pool_bytes < POOL_SIZE)
+        {
+            m_pool[m_pool_bytes++] = (uint8_t)NRF_RNG->VALUE;
+        }
+
+        if (m_pool_bytes >= POOL_SIZE)
+        {
+            NRF_RNG->INTENCLR   = RNG_INTENCLR_VALRDY_Msk;
+            NRF_RNG->TASKS_STOP = 1;
+            m_pool_ready        = true;
+        }
+    }
+#endif // !RAAL_SOFTDEVICE
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the thermometer abstraction that caches temperature measured by
+ *   the platform.
+ *
+ * The platform passes its measurements with @ref nrf_802154_temperature_measurement_set.
+ * The cached temperature is updated, and @ref nrf_802154_temperature_changed is called, only when
+ * a measurement differs from it by at least @ref NRF_802154_TEMPERATURE_UPDATE_THRESHOLD, so
+ * that the correction tables are not recalculated on measurement noise. Until the first
+ * measurement, the default temperature of 20 C is reported.
+ *
+ */
+
+#include "platform/nrf_802154_temperature.h"
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#define DEFAULT_TEMPERATURE     20 ///< Temperature reported before the first measurement [C].
+#define TEMPERATURE_UNITS_PER_C 4 ///< Number of measurement units in one centigrade.
+
+static volatile int8_t m_temperature = DEFAULT_TEMPERATURE; ///< Cached temperature [C].
+
+/**
+ * @brief Converts a measurement to centigrades, rounding to the nearest value.
+ *
+ * @param[in]  temperature  Measured temperature, in 0.25 C units.
+ *
+ * @returns Temperature in centigrades, limited to the range of int8_t.
+ */
+static int8_t temperature_to_c(int32_t temperature)
+{
+    int32_t result;
+
+    if (temperature < 0)
+    {
+        result = -((-temperature + TEMPERATURE_UNITS_PER_C / 2) / TEMPERATURE_UNITS_PER_C);
+    }
+    else
+    {
+        result = (temperature + TEMPERATURE_UNITS_PER_C / 2) / TEMPERATURE_UNITS_PER_C;
+    }
+
+    if (result > INT8_MAX)
+    {
+        result = INT8_MAX;
+    }
+    else if (result < INT8_MIN)
+    {
+        result = INT8_MIN;
+    }
+
+    return (int8_t)result;
+}
+
+void nrf_802154_temperature_init(void)
+{
+    m_temperature = DEFAULT_TEMPERATURE;
+}
+
+void nrf_802154_temperature_deinit(void)
+{
+    // Intentionally empty
+}
+
+int8_t nrf_802154_temperature_get(void)
+{
+    return m_temperature;
+}
+
+void nrf_802154_temperature_measurement_set(int32_t temperature)
+{
+    int8_t  measured   = temperature_to_c(temperature);
+    int32_t difference = (int32_t)measured - (int32_t)m_temperature;
+
+    if ((difference >= NRF_802154_TEMPERATURE_UPDATE_THRESHOLD) ||
+        (difference <= -NRF_802154_TEMPERATURE_UPDATE_THRESHOLD))
+    {
+        m_temperature = measured;
+        nrf_802154_temperature_changed();
+    }
+}
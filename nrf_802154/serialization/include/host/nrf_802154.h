@@ -235,6 +235,59 @@ bool nrf_802154_sleep(void);
  */
 bool nrf_802154_receive(void);
 
+/**
+ * @brief Requests reception at the specified time.
+ *
+ * This function works as a delayed version of @ref nrf_802154_receive. It is asynchronous.
+ * It queues the delayed reception using the Radio Scheduler module.
+ * If the delayed reception cannot be performed (@ref nrf_802154_receive_at would return false)
+ * or the requested reception timeslot is denied, @ref nrf_drv_radio802154_receive_failed is called
+ * with the @ref NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED argument.
+ *
+ * If the requested reception time is in the past, the function returns false and does not
+ * schedule reception.
+ *
+ * A scheduled reception can be cancelled by a call to @ref nrf_802154_receive_at_cancel.
+ *
+ * @note The identifier @p id must be unique. It must not have the same value as identifiers
+ * of other delayed timeslots active at the moment, so that it can be mapped unambiguously
+ * to an active delayed operation if the request is successful. In particular, none of the reserved
+ * identifiers can be used.
+ *
+ * @param[in]   t0       Base of delay time - absolute time used by the Timer Scheduler,
+ *                       in microseconds (us).
+ * @param[in]   dt       Delta of delay time from @p t0, in microseconds (us).
+ * @param[in]   timeout  Reception timeout (counted from @p t0 + @p dt), in microseconds (us).
+ * @param[in]   channel  Radio channel on which the frame is to be received.
+ * @param[in]   id       Identifier of the scheduled reception window. If the reception has been
+ *                       scheduled successfully, the value of this parameter can be used in
+ *                       @ref nrf_802154_receive_at_cancel to cancel it.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure.
+ */
+bool nrf_802154_receive_at(uint32_t t0,
+                           uint32_t dt,
+                           uint32_t timeout,
+                           uint8_t  channel,
+                           uint32_t id);
+
+/**
+ * @brief Cancels a delayed reception scheduled by a call to @ref nrf_802154_receive_at.
+ *
+ * If the receive window has been scheduled but has not started yet, this function prevents
+ * entering the receive window. If the receive window has been scheduled and has already started,
+ * the radio remains in the receive state, but a window timeout will not be reported.
+ *
+ * @param[in]  id  Identifier of the delayed reception window to be cancelled. If the provided
+ *                 value does not refer to any scheduled or active receive window, the function
+ *                 returns false.
+ *
+ * @retval  true    The delayed reception was scheduled and successfully cancelled.
+ * @retval  false   No delayed reception was scheduled.
+ */
+bool nrf_802154_receive_at_cancel(uint32_t id);
+
 /** @brief Sets the channel on which the radio is to operate.
  *
  * @param[in]  channel  Channel number (11-26).
@@ -275,6 +328,47 @@ void nrf_802154_short_address_set(const uint8_t * p_short_address);
  */
 void nrf_802154_extended_address_set(const uint8_t * p_extended_address);
 
+/**
+ * @brief Configures and enables an address context.
+ *
+ * Frames destined to any enabled address context pass the frame filter and are acknowledged
+ * using the source address matching method of the context they were accepted in.
+ * Address context 0 holds the addresses set by @ref nrf_802154_pan_id_set,
+ * @ref nrf_802154_short_address_set and @ref nrf_802154_extended_address_set.
+ *
+ * This function makes a copy of the addresses.
+ *
+ * @param[in]  context    Index of the address context.
+ * @param[in]  p_context  Pointer to the address context configuration.
+ *
+ * @retval  true   The address context was configured.
+ * @retval  false  The index of the address context is invalid.
+ */
+bool nrf_802154_pan_context_set(uint8_t context, const nrf_802154_pan_context_t * p_context);
+
+/**
+ * @brief Disables an address context.
+ *
+ * @param[in]  context  Index of the address context. Context 0 cannot be disabled.
+ *
+ * @retval  true   The address context was disabled.
+ * @retval  false  The index of the address context is invalid.
+ */
+bool nrf_802154_pan_context_clear(uint8_t context);
+
+/**
+ * @brief Gets the address contexts a received frame was accepted in.
+ *
+ * @note This function can be called only for a buffer passed by
+ *       @ref nrf_802154_received_timestamp_raw that was not freed yet.
+ *
+ * @param[in]  p_data  Pointer to the buffer containing PHR and PSDU of the received frame.
+ *
+ * @returns Mask of address contexts matched by the destination of the frame. The mask is 0 for
+ *          frames that were received only due to the promiscuous mode.
+ */
+nrf_802154_pan_context_mask_t nrf_802154_pan_contexts_get_raw(const uint8_t * p_data);
+
 /**
  * @brief Configures the device as the PAN coordinator.
  *
@@ -333,6 +427,25 @@ bool nrf_802154_cca(void);
  */
 bool nrf_802154_energy_detection(uint32_t time_us);
 
+/**
+ * @brief Changes the radio state to energy detection to scan multiple channels.
+ *
+ * The energy detection procedure is performed on each channel selected by @p channel_mask.
+ * The results of all channels are reported to the higher layer at once by
+ * @ref nrf_802154_energy_scan_done.
+ *
+ * @note @ref nrf_802154_energy_scan_done can be called before this function returns a result.
+ *
+ * @param[in]  channel_mask   Mask of channels to scan. Bit @c n selects channel @c n. Only
+ *                            channels from 11 to 26 can be selected.
+ * @param[in]  dwell_time_us  Duration of energy detection on each channel. The given value is
+ *                            rounded up to multiplication of 8 symbols (128 us).
+ *
+ * @retval  true   The energy scan procedure was scheduled.
+ * @retval  false  The driver could not schedule the energy scan procedure.
+ */
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us);
+
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_TX.
  *
@@ -372,6 +485,63 @@ bool nrf_802154_energy_detection(uint32_t time_us);
  */
 bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
 
+/**
+ * @brief Requests transmission at the specified time.
+ *
+ * @note This function is implemented in a zero-copy fashion. It passes the given buffer pointer to
+ *       the RADIO peripheral.
+ *
+ * This function works as a delayed version of @ref nrf_802154_transmit_raw. It is asynchronous.
+ * It queues the delayed transmission using the Radio Scheduler module and performs it
+ * at the specified time.
+ *
+ * If the delayed transmission is successfully performed, @ref nrf_802154_transmitted is called.
+ * If the delayed transmission cannot be performed (@ref nrf_802154_transmit_raw would return false)
+ * or the requested transmission timeslot is denied, @ref nrf_802154_transmit_failed with the
+ * @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED argument is called.
+ *
+ * This function is designed to transmit the first symbol of SHR at the given time.
+ *
+ * If the requested transmission time is in the past, the function returns false and does not
+ * schedule transmission.
+ *
+ * A successfully scheduled transmission can be cancelled by a call
+ * to @ref nrf_802154_transmit_at_cancel.
+ *
+ * @param[in]  p_data   Pointer to the array with data to transmit. The first byte must contain
+ *                      the frame length (including PHR and FCS). The following bytes contain data.
+ *                      The CRC is computed automatically by the radio hardware. Therefore, the FCS
+ *                      field can contain any bytes.
+ * @param[in]  cca      If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
+ *                      in microseconds (us).
+ * @param[in]  dt       Delta of delay time from @p t0, in microseconds (us).
+ * @param[in]  channel  Radio channel on which the frame is to be transmitted.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
+                                bool            cca,
+                                uint32_t        t0,
+                                uint32_t        dt,
+                                uint8_t         channel);
+
+/**
+ * @brief Cancels a delayed transmission scheduled by a call to @ref nrf_802154_transmit_raw_at.
+ *
+ * If a delayed transmission has been scheduled but the transmission has not been started yet,
+ * a call to this function prevents the transmission. If the transmission is ongoing,
+ * it will not be aborted.
+ *
+ * If a delayed transmission has not been scheduled (or has already finished), this function does
+ * not change state and returns false.
+ *
+ * @retval  true    The delayed transmission was scheduled and successfully cancelled.
+ * @retval  false   No delayed transmission was scheduled.
+ */
+bool nrf_802154_transmit_at_cancel(void);
+
 /**
  * @brief Performs the CSMA-CA procedure and transmits a frame in case of success.
  *
@@ -390,6 +560,99 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
  */
 void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data);
 
+/**
+ * @brief Sets the minimum value of the backoff exponent (BE) in the CSMA-CA algorithm.
+ *
+ * @param[in] min_be  Minimum value of the backoff exponent.
+ *
+ * @retval true   When value provided by @p min_be has been set successfully.
+ * @retval false  Otherwise.
+ */
+bool nrf_802154_csma_ca_min_be_set(uint8_t min_be);
+
+/**
+ * @brief Sets the maximum value of the backoff exponent (BE) in the CSMA-CA algorithm.
+ *
+ * @param[in] max_be  Maximum value of the backoff exponent.
+ *
+ * @retval true   When value provided by @p max_be has been set successfully.
+ * @retval false  Otherwise.
+ */
+bool nrf_802154_csma_ca_max_be_set(uint8_t max_be);
+
+/**
+ * @brief Sets the maximum number of backoffs the CSMA-CA algorithm will attempt before declaring
+ *        a channel access failure.
+ *
+ * @param[in] max_backoffs  Maximum number of backoffs.
+ */
+void nrf_802154_csma_ca_max_backoffs_set(uint8_t max_backoffs);
+
+/**
+ * @brief Sets IFS operation mode.
+ *
+ * @param[in] mode  IFS operation mode. Refer to @ref nrf_802154_ifs_mode_t for details.
+ *
+ * @retval    true  The update of IFS operation mode was successful.
+ * @retval    false The update of IFS operation mode failed. Provided mode is unsupported
+ */
+bool nrf_802154_ifs_mode_set(nrf_802154_ifs_mode_t mode);
+
+/**
+ * @brief Sets Short IFS period in microseconds.
+ *
+ * @param[in] period Short IFS period in microseconds.
+ */
+void nrf_802154_ifs_min_sifs_period_set(uint16_t period);
+
+/**
+ * @brief Sets Long IFS period in microseconds.
+ *
+ * @param[in] period Long IFS period in microseconds.
+ */
+void nrf_802154_ifs_min_lifs_period_set(uint16_t period);
+
+/**
+ * @brief Sets nRF 802.15.4 Radio Driver Global MAC Frame Counter.
+ *
+ * The driver automatically increments the counter in every outgoing frame
+ * which uses the Global MAC Frame Counter.
+ * This call is meant to set the initial value of the frame counter.
+ *
+ * @param[in] frame_counter Global MAC Frame Counter to set.
+ */
+void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter);
+
+/**
+ * @brief Store the 802.15.4 MAC Security Key inside the nRF 802.15.4 Radio Driver.
+ *
+ * @param[in] p_key Pointer to the key to store. Refer to @ref nrf_802154_key_t for details.
+ *                  Storing the key copies the content of the key and key ID into the Radio Driver.
+ *                  This input parameter can be destroyed after the call.
+ *
+ * @note This function is not reentrant and must be called from thread context only.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE               Storing of key is successful.
+ * @retval NRF_802154_SECURITY_ERROR_TYPE_NOT_SUPPORTED Type of the key is not supported.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED ID mode of the key is not supported.
+ * @retval NRF_802154_SECURITY_ERROR_ALREADY_PRESENT    Failed to store the key - key of such id is already
+ *                                                      present. Remove the key first to overwrite.
+ * @retval NRF_802154_SECURITY_ERROR_STORAGE_FULL       Failed to store the key - storage full.
+ */
+nrf_802154_security_error_t nrf_802154_security_key_store(nrf_802154_key_t * p_key);
+
+/**
+ * @brief Remove the 802.15.4 MAC Security Key from the nRF 802.15.4 Radio Driver.
+ *
+ * @param[in] p_id Pointer to the ID of the key to remove.
+ *
+ * @note This function is not reentrant and must be called from thread context only.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE          Removal of key is successful.
+ * @retval NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND Failed to remove the key - no such key found.
+ */
+nrf_802154_security_error_t nrf_802154_security_key_remove(nrf_802154_key_id_t * p_id);
+
 /**
  * @brief Notifies the driver that the buffer containing the received frame is not used anymore.
  *
@@ -435,4 +698,36 @@ int8_t nrf_802154_dbm_from_energy_level_calculate(uint8_t energy_level);
  */
 nrf_802154_capabilities_t nrf_802154_capabilities_get(void);
 
+/**
+ * @brief Gets link statistics of the neighbors the driver has heard from.
+ *
+ * @param[in]  first_index  Index of the first table entry to retrieve.
+ * @param[out] p_stats      Array that will be filled with neighbor statistics.
+ * @param[in]  max_count    Number of elements in the @p p_stats array.
+ *
+ * @returns Number of entries written to @p p_stats.
+ */
+uint8_t nrf_802154_neighbor_stats_get(uint8_t                       first_index,
+                                      nrf_802154_neighbor_stats_t * p_stats,
+                                      uint8_t                       max_count);
+
+/**
+ * @brief Removes all neighbors from the link statistics table.
+ */
+void nrf_802154_neighbor_stats_reset(void);
+
+/**
+ * @brief Gets the current time.
+ *
+ * The time returned by this function is to be used to calculate timing parameters for
+ * @ref nrf_802154_transmit_raw_at and @ref nrf_802154_receive_at functions.
+ *
+ * @note If @ref NRF_802154_SER_TIME_TRANSLATION_ENABLED is set, the time is read from the local
+ *       clock and translated to the remote core time base whenever it crosses the serialization
+ *       link. Otherwise, the time is read from the remote core on every call.
+ *
+ * @returns Current time in microseconds.
+ */
+uint32_t nrf_802154_time_get(void);
+
 #endif
@@ -86,6 +86,17 @@ extern void nrf_802154_energy_detected(uint8_t result);
  */
 extern void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error);
 
+/**
+ * @brief Notifies that the energy scan procedure finished.
+ *
+ * @param[in]  channel_mask  Mask of scanned channels.
+ * @param[in]  p_results     Array of @ref NRF_802154_ENERGY_SCAN_CHANNELS_NUM maximum energy
+ *                           levels, indexed with
+ *                           (channel - @ref NRF_802154_ENERGY_SCAN_FIRST_CHANNEL). Only entries
+ *                           of channels selected by @p channel_mask are valid.
+ */
+extern void nrf_802154_energy_scan_done(uint32_t channel_mask, const uint8_t * p_results);
+
 /**
  * @brief Notifies about the start of the ACK frame transmission.
  *
@@ -176,6 +187,46 @@ extern void nrf_802154_transmitted_raw(const uint8_t * p_frame,
 extern void nrf_802154_transmit_failed(const uint8_t       * p_frame,
                                        nrf_802154_tx_error_t error);
 
+/**
+ * @brief Notifies that a frame was transmitted.
+ *
+ * This function works like @ref nrf_802154_transmitted_raw and adds metadata of the transmission
+ * procedure to the parameter list. The default implementation calls
+ * @ref nrf_802154_transmitted_raw.
+ *
+ * @param[in]  p_frame     Pointer to a buffer that contains PHR and PSDU of the transmitted frame.
+ * @param[in]  p_ack       Pointer to a buffer that contains PHR and PSDU of the received ACK
+ *                         or NULL if ACK was not requested.
+ * @param[in]  power       RSSI of the received frame or 0 if ACK was not requested.
+ * @param[in]  lqi         LQI of the received frame or 0 if ACK was not requested.
+ * @param[in]  p_metadata  Pointer to metadata of the transmission procedure. Valid only during
+ *                         the call.
+ */
+extern void nrf_802154_transmitted_metadata_raw(
+    const uint8_t                             * p_frame,
+    uint8_t                                   * p_ack,
+    int8_t                                      power,
+    uint8_t                                     lqi,
+    const nrf_802154_transmit_done_metadata_t * p_metadata);
+
+/**
+ * @brief Notifies that a frame was not transmitted.
+ *
+ * This function works like @ref nrf_802154_transmit_failed and adds metadata of the transmission
+ * procedure to the parameter list. The default implementation calls
+ * @ref nrf_802154_transmit_failed.
+ *
+ * @param[in]  p_frame     Pointer to a buffer that contains PHR and PSDU of the frame that was not
+ *                         transmitted.
+ * @param[in]  error       Reason of the failure.
+ * @param[in]  p_metadata  Pointer to metadata of the transmission procedure. Valid only during
+ *                         the call.
+ */
+extern void nrf_802154_transmit_failed_metadata(
+    const uint8_t                             * p_frame,
+    nrf_802154_tx_error_t                       error,
+    const nrf_802154_transmit_done_metadata_t * p_metadata);
+
 #endif /* NRF_802154_CALLOUTS_H_ */
 
 /** @} */
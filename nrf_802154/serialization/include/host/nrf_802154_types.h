@@ -35,6 +35,7 @@
 #ifndef NRF_802154_TYPES_H__
 #define NRF_802154_TYPES_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /**
@@ -82,6 +83,17 @@ typedef uint8_t nrf_802154_ed_error_t;
 
 #define NRF_802154_ED_ERROR_ABORTED 0x01 // !< Procedure was aborted by another operation.
 
+/**
+ * @brief Channels covered by the energy scan procedure.
+ *
+ * Bit @c n of the channel mask passed to the energy scan procedure selects channel @c n.
+ * Results of the procedure are stored in an array indexed with
+ * (channel - @ref NRF_802154_ENERGY_SCAN_FIRST_CHANNEL).
+ */
+#define NRF_802154_ENERGY_SCAN_FIRST_CHANNEL 11U          // !< First channel that can be scanned.
+#define NRF_802154_ENERGY_SCAN_CHANNELS_NUM  16U          // !< Number of channels that can be scanned.
+#define NRF_802154_ENERGY_SCAN_CHANNEL_MASK  0x07fff800UL // !< Mask of all channels that can be scanned.
+
 /**
  * @brief Possible errors during the CCA procedure.
  */
@@ -114,6 +126,51 @@ typedef uint8_t nrf_802154_src_addr_match_t;
 #define NRF_802154_SRC_ADDR_MATCH_ZIGBEE   0x01 // !< Implementation for the Zigbee protocol.
 #define NRF_802154_SRC_ADDR_MATCH_ALWAYS_1 0x02 // !< Standard compliant implementation.
 
+/**
+ * @brief Mask of address contexts.
+ *
+ * Bit @c n of the mask corresponds to the address context @c n.
+ */
+typedef uint8_t nrf_802154_pan_context_mask_t;
+
+/**
+ * @brief Structure for configuring an address context.
+ */
+typedef struct
+{
+    uint8_t                     pan_id[2];        // !< PAN ID (little-endian).
+    uint8_t                     short_addr[2];    // !< Short address (little-endian).
+    uint8_t                     extended_addr[8]; // !< Extended address (little-endian).
+    nrf_802154_src_addr_match_t src_addr_match;   // !< Source address matching method used in ACK frames sent in this context.
+} nrf_802154_pan_context_t;
+
+/**
+ * @brief Possible errors during key handling.
+ */
+typedef uint8_t nrf_802154_security_error_t;
+
+#define NRF_802154_SECURITY_ERROR_NONE                   0x00 // !< There is no error.
+#define NRF_802154_SECURITY_ERROR_STORAGE_FULL           0x01 // !< The key storage is full - removal of stored keys is needed.
+#define NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND          0x02 // !< The provided key was not found inside the storage.
+#define NRF_802154_SECURITY_ERROR_ALREADY_PRESENT        0x03 // !< The storage already has the key of the same ID.
+#define NRF_802154_SECURITY_ERROR_TYPE_NOT_SUPPORTED     0x04 // !< The provided key type is not supported.
+#define NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED     0x05 // !< The provided key id mode is not supported.
+#define NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW 0x06 // !< The associated frame counter overflowed.
+
+/**
+ * @brief Mode of handling Interframe spacing.
+ *
+ * Possible values:
+ * - @ref NRF_802154_IFS_MODE_DISABLED,
+ * - @ref NRF_802154_IFS_MODE_MATCHING_ADDRESSES,
+ * - @ref NRF_802154_IFS_MODE_ALWAYS
+ */
+typedef uint8_t nrf_802154_ifs_mode_t;
+
+#define NRF_802154_IFS_MODE_DISABLED           0x00 // !< Interframe spacing is never inserted.
+#define NRF_802154_IFS_MODE_MATCHING_ADDRESSES 0x01 // !< Interframe spacing is inserted only on matching addresses.
+#define NRF_802154_IFS_MODE_ALWAYS             0x02 // !< Interframe spacing is always inserted.
+
 /**
  * @brief Capabilites of nrf 802.15.4 radio driver
  *
@@ -137,6 +194,73 @@ typedef uint32_t nrf_802154_capabilities_t;
 #define NRF_802154_CAPABILITY_IFS           (1UL << 5UL) // !< Inter-frame spacing supported
 #define NRF_802154_CAPABILITY_TIMESTAMP     (1UL << 6UL) // !< Frame timestamping supported
 
+/**
+ * @brief Type of structure holding link statistics of a single neighbor.
+ *
+ * Averaged values are exponentially weighted moving averages updated with every frame
+ * received from the neighbor and with every ACK the neighbor sent in response to a frame
+ * transmitted by this node.
+ */
+typedef struct
+{
+    uint8_t  addr[8];          // !< Address of the neighbor, little endian. Only first 2 bytes are valid for a short address.
+    bool     extended;         // !< Whether @ref addr holds an extended address.
+    int8_t   rssi_avg;         // !< Averaged RSSI in dBm.
+    uint8_t  lqi_avg;          // !< Averaged LQI.
+    uint32_t rx_frames;        // !< Number of frames received from the neighbor.
+    uint32_t tx_ack_requested; // !< Number of frames with the ACK request bit set transmitted to the neighbor.
+    uint32_t tx_acked;         // !< Number of transmitted frames the neighbor acknowledged.
+    uint32_t last_seen;        // !< Time in microseconds at which the last frame or ACK from the neighbor was received.
+} nrf_802154_neighbor_stats_t;
+
+/**
+ * @brief Types of keys which can be used with the nRF 802.15.4 Radio Driver.
+ *
+ * Possible values:
+ * - @ref NRF_802154_KEY_CLEARTEXT,
+ *
+ */
+typedef uint32_t nrf_802154_key_type_t;
+
+#define NRF_802154_KEY_CLEARTEXT 0x00 // !< Key stored in clear text.
+
+/**
+ * @brief Type holding the value of Key Id Mode of the key stored in nRF 802.15.4 Radio Driver.
+ */
+typedef uint8_t nrf_802154_key_id_mode_t;
+
+/**
+ * @brief Type holding the value of Key Id for the keys stored in nRF 802.15.4 Radio Driver.
+ */
+typedef struct
+{
+    nrf_802154_key_id_mode_t mode;     // !< Key Id Mode (0..3)
+    uint8_t                * p_key_id; // !< Pointer to the Key Id field
+} nrf_802154_key_id_t;
+
+/**
+ * @brief Type of structure holding a 802.15.4 MAC Security Key.
+ */
+typedef struct
+{
+    union
+    {
+        uint8_t * p_cleartext_key;                  // !< Pointer to the cleartext representation of the key.
+    }                     value;                    // !< Union holding different representations of the key.
+    nrf_802154_key_id_t   id;                       // !< Key Id of the key.
+    nrf_802154_key_type_t type;                     // !< @ref nrf_802154_key_type_t type of the key used.
+    uint32_t              frame_counter;            // !< Frame counter to use in case @ref use_global_frame_counter is set to false.
+    bool                  use_global_frame_counter; // !< Whether to use the global frame counter instead of the one defined in this structure.
+} nrf_802154_key_t;
+
+/**
+ * @brief Type of structure holding metadata of a frame whose transmission procedure finished.
+ */
+typedef struct
+{
+    uint8_t attempts; // !< Number of transmission attempts of the frame, including the first one.
+} nrf_802154_transmit_done_metadata_t;
+
 /**
  *@}
  **/
@@ -63,6 +63,48 @@ extern "C" {
 nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data,
                                                            size_t       data_len);
 
+/**
+ * @brief Allocates a buffer for an outgoing spinel frame in the memory of the spinel backend.
+ *
+ * This function is the first phase of the zero-copy send path used when
+ * @ref NRF_802154_SER_ZERO_COPY_TX_ENABLED is set. The spinel frame is encoded directly into
+ * the returned buffer, which must then be passed either to
+ * @ref nrf_802154_spinel_encoded_packet_commit or to @ref nrf_802154_spinel_encoded_packet_discard.
+ *
+ * @note This function can be called from any context, including interrupt handlers.
+ *
+ * @param[out] pp_data    Pointer to the variable that is populated with the address of the buffer.
+ * @param[out] p_max_len  Pointer to the variable that is populated with the size of the buffer.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_alloc(void  ** pp_data,
+                                                            size_t * p_max_len);
+
+/**
+ * @brief Sends a spinel frame encoded in a buffer allocated by the spinel backend.
+ *
+ * The ownership of the buffer returns to the backend, regardless of the result.
+ *
+ * @param[in]  p_data    Pointer to a buffer allocated by @ref nrf_802154_spinel_encoded_packet_alloc
+ *                       that contains spinel encoded frame.
+ * @param[in]  data_len  Length of the encoded frame.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_commit(void * p_data, size_t data_len);
+
+/**
+ * @brief Releases a buffer allocated by @ref nrf_802154_spinel_encoded_packet_alloc without
+ *        sending it.
+ *
+ * @param[in]  p_data  Pointer to the buffer to release.
+ *
+ */
+void nrf_802154_spinel_encoded_packet_discard(void * p_data);
+
 /**
  * @brief Initializes spinel backend.
  *
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_spinel_serialization_backend_loopback
+ * 802.15.4 radio driver spinel serialization loopback backend
+ * @{
+ *
+ * The loopback backend implements @ref nrf_802154_spinel_serialization_backend without any
+ * transport. Frames sent by the serialization library are queued in a static pool and passed back
+ * to @ref nrf_802154_spinel_encoded_packet_received when @ref nrf_802154_spinel_backend_loopback_process
+ * is called. The backend is meant for host builds, in which it allows measuring the cost of
+ * the encoding path and exercising the library without a second core.
+ */
+
+#ifndef NRF_802154_SPINEL_BACKEND_LOOPBACK_H_
+#define NRF_802154_SPINEL_BACKEND_LOOPBACK_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Statistics of the loopback backend.
+ */
+typedef struct
+{
+    uint32_t frames;         ///< Number of frames committed for sending.
+    uint32_t bytes;          ///< Total length of the frames committed for sending.
+    uint32_t copies;         ///< Number of frames copied into the backend by @ref nrf_802154_spinel_encoded_packet_send.
+    uint32_t alloc_failures; ///< Number of allocations that failed because the pool was exhausted.
+} nrf_802154_spinel_backend_loopback_stats_t;
+
+/**
+ * @brief Passes all queued frames to @ref nrf_802154_spinel_encoded_packet_received.
+ *
+ * Frames are delivered in the order in which they were committed. Frames sent while this function
+ * is running are delivered in the same call.
+ *
+ * @returns Number of delivered frames.
+ */
+uint32_t nrf_802154_spinel_backend_loopback_process(void);
+
+/**
+ * @brief Gets the statistics of the loopback backend.
+ *
+ * @param[out] p_stats  Pointer to the structure to be populated with the statistics.
+ */
+void nrf_802154_spinel_backend_loopback_stats_get(nrf_802154_spinel_backend_loopback_stats_t * p_stats);
+
+/**
+ * @brief Resets the statistics of the loopback backend.
+ */
+void nrf_802154_spinel_backend_loopback_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_BACKEND_LOOPBACK_H_ */
+
+/** @} */
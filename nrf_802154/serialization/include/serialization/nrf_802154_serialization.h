@@ -52,6 +52,19 @@ extern "C" {
  */
 void nrf_802154_serialization_init(void);
 
+/**
+ * @brief Synchronizes the local time base with the time base of the remote core.
+ *
+ * The offset between the clocks is estimated by reading the remote time and comparing it with
+ * the midpoint of the local time sampled before and after the request. The function is called
+ * by @ref nrf_802154_init and should be called periodically afterwards to compensate for clock
+ * drift between the cores.
+ *
+ * @note This function is available on the serialization host only. It has an effect only if
+ *       @ref NRF_802154_SER_TIME_TRANSLATION_ENABLED is set.
+ */
+void nrf_802154_serialization_time_sync(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,4 +49,29 @@
 #define NRF_802154_TX_BUFFERS 4
 #endif
 
+/**
+ * @brief If the serialization host translates timestamps between the local and remote clocks.
+ *
+ * When enabled, the host keeps an offset between its own time base, provided by
+ * @ref nrf_802154_serialization_time_get, and the time base of the remote core. Timestamps passed
+ * to the delayed operations and reported with received frames are translated using this offset,
+ * so that the host application can schedule operations against its local clock.
+ */
+#ifndef NRF_802154_SER_TIME_TRANSLATION_ENABLED
+#define NRF_802154_SER_TIME_TRANSLATION_ENABLED 0
+#endif
+
+/**
+ * @brief If spinel frames are encoded directly into buffers owned by the spinel backend.
+ *
+ * When enabled, outgoing frames are allocated with @ref nrf_802154_spinel_encoded_packet_alloc,
+ * encoded in place and sent with @ref nrf_802154_spinel_encoded_packet_commit. This avoids
+ * a frame-sized buffer on the stack and a copy of every frame into the transport memory,
+ * but requires the backend to implement the allocation API. When disabled, frames are passed
+ * to @ref nrf_802154_spinel_encoded_packet_send.
+ */
+#ifndef NRF_802154_SER_ZERO_COPY_TX_ENABLED
+#define NRF_802154_SER_ZERO_COPY_TX_ENABLED 0
+#endif
+
 #endif // NRF_802154_SER_CONFIG_H__
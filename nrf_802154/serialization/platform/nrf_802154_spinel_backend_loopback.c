@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_backend_loopback.c
+ * @brief Spinel backend that loops frames back to the local serialization library.
+ */
+
+#include "nrf_802154_spinel_backend_loopback.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_backend.h"
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_serialization_error.h"
+
+/**
+ * @brief Number of frames the loopback backend can hold at the same time.
+ */
+#ifndef NRF_802154_SPINEL_BACKEND_LOOPBACK_SLOTS
+#define NRF_802154_SPINEL_BACKEND_LOOPBACK_SLOTS 4
+#endif
+
+typedef enum
+{
+    SLOT_STATE_FREE,      ///< The slot can be allocated.
+    SLOT_STATE_ALLOCATED, ///< The slot is being filled by the serialization library.
+    SLOT_STATE_PENDING,   ///< The slot holds a frame waiting for delivery.
+} slot_state_t;
+
+typedef struct
+{
+    uint8_t      data[NRF_802154_SPINEL_FRAME_BUFFER_SIZE]; ///< Frame buffer.
+    size_t       len;                                       ///< Length of the committed frame.
+    slot_state_t state;                                     ///< State of the slot.
+} slot_t;
+
+static slot_t                                     m_slots[NRF_802154_SPINEL_BACKEND_LOOPBACK_SLOTS];
+static uint8_t                                    m_pending[NRF_802154_SPINEL_BACKEND_LOOPBACK_SLOTS]; ///< Indices of pending slots in commit order.
+static uint8_t                                    m_pending_head;                                      ///< Index in @ref m_pending of the oldest pending slot.
+static uint8_t                                    m_pending_count;                                     ///< Number of pending slots.
+static nrf_802154_spinel_backend_loopback_stats_t m_stats;
+
+static slot_t * slot_by_data_get(void * p_data)
+{
+    return (slot_t *)((uint8_t *)p_data - offsetof(slot_t, data));
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_alloc(void  ** pp_data,
+                                                            size_t * p_max_len)
+{
+    nrf_802154_ser_err_t res = NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    uint32_t             critical_section;
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+
+    for (size_t i = 0; i < NRF_802154_SPINEL_BACKEND_LOOPBACK_SLOTS; i++)
+    {
+        if (m_slots[i].state == SLOT_STATE_FREE)
+        {
+            m_slots[i].state = SLOT_STATE_ALLOCATED;
+
+            *pp_data   = m_slots[i].data;
+            *p_max_len = sizeof(m_slots[i].data);
+
+            res = NRF_802154_SERIALIZATION_ERROR_OK;
+            break;
+        }
+    }
+
+    if (res != NRF_802154_SERIALIZATION_ERROR_OK)
+    {
+        m_stats.alloc_failures++;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+
+    return res;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_commit(void * p_data, size_t data_len)
+{
+    slot_t * p_slot = slot_by_data_get(p_data);
+    uint32_t critical_section;
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+
+    p_slot->len   = data_len;
+    p_slot->state = SLOT_STATE_PENDING;
+
+    m_pending[(m_pending_head + m_pending_count) % NRF_802154_SPINEL_BACKEND_LOOPBACK_SLOTS] =
+        (uint8_t)(p_slot - m_slots);
+    m_pending_count++;
+
+    m_stats.frames++;
+    m_stats.bytes += data_len;
+
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+
+    return (nrf_802154_ser_err_t)data_len;
+}
+
+void nrf_802154_spinel_encoded_packet_discard(void * p_data)
+{
+    slot_t * p_slot = slot_by_data_get(p_data);
+
+    p_slot->state = SLOT_STATE_FREE;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data,
+                                                           size_t       data_len)
+{
+    void               * p_buff;
+    size_t               buff_len;
+    nrf_802154_ser_err_t res;
+
+    res = nrf_802154_spinel_encoded_packet_alloc(&p_buff, &buff_len);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    if (data_len > buff_len)
+    {
+        nrf_802154_spinel_encoded_packet_discard(p_buff);
+        return NRF_802154_SERIALIZATION_ERROR_BACKEND_FAILURE;
+    }
+
+    memcpy(p_buff, p_data, data_len);
+    m_stats.copies++;
+
+    return nrf_802154_spinel_encoded_packet_commit(p_buff, data_len);
+}
+
+nrf_802154_ser_err_t nrf_802154_backend_init(void)
+{
+    memset(m_slots, 0, sizeof(m_slots));
+    m_pending_head  = 0;
+    m_pending_count = 0;
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+uint32_t nrf_802154_spinel_backend_loopback_process(void)
+{
+    uint32_t delivered = 0;
+
+    while (true)
+    {
+        slot_t * p_slot = NULL;
+        uint32_t critical_section;
+
+        nrf_802154_serialization_crit_sect_enter(&critical_section);
+
+        if (m_pending_count > 0)
+        {
+            p_slot         = &m_slots[m_pending[m_pending_head]];
+            m_pending_head = (m_pending_head + 1) % NRF_802154_SPINEL_BACKEND_LOOPBACK_SLOTS;
+            m_pending_count--;
+        }
+
+        nrf_802154_serialization_crit_sect_exit(critical_section);
+
+        if (p_slot == NULL)
+        {
+            break;
+        }
+
+        // The slot stays owned by the backend until the frame is consumed, so a frame sent
+        // by the receive handler cannot overwrite it.
+        nrf_802154_spinel_encoded_packet_received(p_slot->data, p_slot->len);
+        p_slot->state = SLOT_STATE_FREE;
+        delivered++;
+    }
+
+    return delivered;
+}
+
+void nrf_802154_spinel_backend_loopback_stats_get(nrf_802154_spinel_backend_loopback_stats_t * p_stats)
+{
+    uint32_t critical_section;
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+    *p_stats = m_stats;
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+}
+
+void nrf_802154_spinel_backend_loopback_stats_reset(void)
+{
+    uint32_t critical_section;
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+    memset(&m_stats, 0, sizeof(m_stats));
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+}
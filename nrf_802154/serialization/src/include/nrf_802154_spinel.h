@@ -42,6 +42,8 @@
 #ifndef NRF_802154_SPINEL_H_
 #define NRF_802154_SPINEL_H_
 
+#include <stdint.h>
+
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
@@ -99,6 +101,30 @@ nrf_802154_buffer_mgr_dst_t * nrf_802154_spinel_dst_buffer_mgr_get(void);
  */
 nrf_802154_buffer_mgr_src_t * nrf_802154_spinel_src_buffer_mgr_get(void);
 
+/**
+ * @brief Translates a time of the local core to the time base of the remote core.
+ *
+ * @note This function is available on the serialization host only. If
+ *       @ref NRF_802154_SER_TIME_TRANSLATION_ENABLED is not set, the time is returned unchanged.
+ *
+ * @param[in]  local_time  Local time in microseconds.
+ *
+ * @returns Corresponding remote time in microseconds.
+ */
+uint32_t nrf_802154_spinel_time_local_to_remote(uint32_t local_time);
+
+/**
+ * @brief Translates a time of the remote core to the time base of the local core.
+ *
+ * @note This function is available on the serialization host only. If
+ *       @ref NRF_802154_SER_TIME_TRANSLATION_ENABLED is not set, the time is returned unchanged.
+ *
+ * @param[in]  remote_time  Remote time in microseconds.
+ *
+ * @returns Corresponding local time in microseconds.
+ */
+uint32_t nrf_802154_spinel_time_remote_to_local(uint32_t remote_time);
+
 #ifdef __cplusplus
 }
 #endif
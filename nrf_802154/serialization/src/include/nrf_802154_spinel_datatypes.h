@@ -266,6 +266,126 @@ typedef enum
      */
     SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR =
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 33,
+
+    /**
+     * Vendor property for nrf_802154_neighbor_stats_get serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 34,
+
+    /**
+     * Vendor property for nrf_802154_neighbor_stats_reset serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_RESET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 35,
+
+    /**
+     * Vendor property for nrf_802154_energy_scan serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 36,
+
+    /**
+     * Vendor property for nrf_802154_energy_scan_done serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 37,
+
+    /**
+     * Vendor property for nrf_802154_transmit_raw_at serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 38,
+
+    /**
+     * Vendor property for nrf_802154_transmit_at_cancel serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 39,
+
+    /**
+     * Vendor property for nrf_802154_receive_at serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 40,
+
+    /**
+     * Vendor property for nrf_802154_receive_at_cancel serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 41,
+
+    /**
+     * Vendor property for nrf_802154_time_get serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 42,
+
+    /**
+     * Vendor property for nrf_802154_csma_ca_min_be_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 43,
+
+    /**
+     * Vendor property for nrf_802154_csma_ca_max_be_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 44,
+
+    /**
+     * Vendor property for nrf_802154_csma_ca_max_backoffs_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 45,
+
+    /**
+     * Vendor property for nrf_802154_ifs_mode_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 46,
+
+    /**
+     * Vendor property for nrf_802154_ifs_min_sifs_period_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 47,
+
+    /**
+     * Vendor property for nrf_802154_ifs_min_lifs_period_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 48,
+
+    /**
+     * Vendor property for nrf_802154_security_global_frame_counter_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 49,
+
+    /**
+     * Vendor property for nrf_802154_security_key_store serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 50,
+
+    /**
+     * Vendor property for nrf_802154_security_key_remove serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 51,
+
+    /**
+     * Vendor property for nrf_802154_pan_context_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 52,
+
+    /**
+     * Vendor property for nrf_802154_pan_context_clear serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_CLEAR =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 53,
 } spinel_prop_vendor_key_t;
 
 /**
@@ -430,7 +550,8 @@ typedef enum
     SPINEL_DATATYPE_NRF_802154_HDATA_S /* Received frame */ \
     SPINEL_DATATYPE_INT8_S             /* Power */          \
     SPINEL_DATATYPE_UINT8_S            /* lqi */            \
-    SPINEL_DATATYPE_UINT32_S           /* timestamp */
+    SPINEL_DATATYPE_UINT32_S           /* timestamp */      \
+    SPINEL_DATATYPE_UINT8_S            /* Address contexts */
 
 /**
  * @brief Spinel data type description for nrf_802154_receive_failed
@@ -544,14 +665,16 @@ typedef enum
     SPINEL_DATATYPE_UINT32_S           /* Handle to transmitted frame */ \
     SPINEL_DATATYPE_NRF_802154_HDATA_S /* Ack frame with its handle */   \
     SPINEL_DATATYPE_INT8_S             /* Power */                       \
-    SPINEL_DATATYPE_UINT8_S            /* LQI */
+    SPINEL_DATATYPE_UINT8_S            /* LQI */                         \
+    SPINEL_DATATYPE_UINT8_S            /* Transmission attempts */
 
 /**
  * @brief Spinel data type description for nrf_802154_transmit_failed.
  */
 #define SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED             \
     SPINEL_DATATYPE_UINT32_S /* Handle to transmitted frame */ \
-    SPINEL_DATATYPE_UINT8_S  /* Error code */
+    SPINEL_DATATYPE_UINT8_S  /* Error code */                  \
+    SPINEL_DATATYPE_UINT8_S  /* Transmission attempts */
 
 /**
  * @brief Spinel data type description for nrf_802154_capabilities_get.
@@ -563,6 +686,225 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET SPINEL_DATATYPE_UINT32_S
 
+/**
+ * @brief Maximum number of neighbor statistics entries carried by a single spinel frame.
+ */
+#define NRF_802154_SPINEL_NEIGHBOR_STATS_MAX_COUNT 8
+
+/**
+ * @brief Spinel data type description for nrf_802154_neighbor_stats_get.
+ */
+#define SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_GET       \
+    SPINEL_DATATYPE_UINT8_S /* Index of first entry */      \
+    SPINEL_DATATYPE_UINT8_S /* Maximum number of entries */
+
+/**
+ * @brief Spinel data type description for nrf_802154_neighbor_stats_get_ret.
+ *
+ * The data consists of up to @ref NRF_802154_SPINEL_NEIGHBOR_STATS_MAX_COUNT entries, each
+ * encoded as @ref SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_S.
+ */
+#define SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_GET_RET SPINEL_DATATYPE_DATA_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_neighbor_stats_t.
+ */
+#define SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_S                     \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Short or extended address */         \
+    SPINEL_DATATYPE_INT8_S      /* Averaged RSSI */                     \
+    SPINEL_DATATYPE_UINT8_S     /* Averaged LQI */                      \
+    SPINEL_DATATYPE_UINT32_S    /* Received frames */                   \
+    SPINEL_DATATYPE_UINT32_S    /* Transmitted frames requesting ACK */ \
+    SPINEL_DATATYPE_UINT32_S    /* Acknowledged frames */               \
+    SPINEL_DATATYPE_UINT32_S    /* Last seen time */
+
+/**
+ * @brief Spinel data type description for nrf_802154_neighbor_stats_reset.
+ */
+#define SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_RESET SPINEL_DATATYPE_NULL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_energy_scan.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN                \
+    SPINEL_DATATYPE_UINT32_S /* Channel mask */               \
+    SPINEL_DATATYPE_UINT32_S /* Dwell time on each channel */
+
+/**
+ * @brief Spinel data type description for nrf_802154_energy_scan result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_energy_scan_done.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_DONE                 \
+    SPINEL_DATATYPE_UINT32_S    /* Channel mask */                  \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Energy levels of all channels */
+
+/**
+ * @brief Spinel data type description for nrf_802154_transmit_raw_at.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT                             \
+    SPINEL_DATATYPE_NRF_802154_HDATA_S /* Frame to transmit with its handle */ \
+    SPINEL_DATATYPE_BOOL_S             /* CCA */                               \
+    SPINEL_DATATYPE_UINT32_S           /* t0 */                                \
+    SPINEL_DATATYPE_UINT32_S           /* dt */                                \
+    SPINEL_DATATYPE_UINT8_S            /* Channel */
+
+/**
+ * @brief Spinel data type description for nrf_802154_transmit_raw_at result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET    SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_transmit_at_cancel.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL     SPINEL_DATATYPE_NULL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_transmit_at_cancel result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_at.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_AT          \
+    SPINEL_DATATYPE_UINT32_S /* t0 */                  \
+    SPINEL_DATATYPE_UINT32_S /* dt */                  \
+    SPINEL_DATATYPE_UINT32_S /* Timeout */             \
+    SPINEL_DATATYPE_UINT8_S  /* Channel */             \
+    SPINEL_DATATYPE_UINT32_S /* Reception window id */
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_at result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET        SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_at_cancel.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL     SPINEL_DATATYPE_UINT32_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_at_cancel result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_time_get.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TIME_GET              SPINEL_DATATYPE_NULL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_time_get result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TIME_GET_RET          SPINEL_DATATYPE_UINT32_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_min_be_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET       SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_min_be_set result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET   SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_max_be_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET       SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_max_be_set result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET   SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_max_backoffs_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_ifs_mode_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET             SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_ifs_mode_set result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET         SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_ifs_min_sifs_period_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET  SPINEL_DATATYPE_UINT16_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_ifs_min_lifs_period_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET  SPINEL_DATATYPE_UINT16_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_global_frame_counter_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET SPINEL_DATATYPE_UINT32_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_key_store.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE                    \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Key value */                          \
+    SPINEL_DATATYPE_UINT8_S     /* Key id mode */                        \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Key id */                             \
+    SPINEL_DATATYPE_UINT32_S    /* Key type */                           \
+    SPINEL_DATATYPE_UINT32_S    /* Frame counter */                      \
+    SPINEL_DATATYPE_BOOL_S      /* Whether to use global frame counter */
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_key_store result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE_RET SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_key_remove.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE \
+    SPINEL_DATATYPE_UINT8_S     /* Key id mode */      \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Key id */
+
+/**
+ * @brief Spinel data type description for nrf_802154_security_key_remove result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE_RET SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_pan_context_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_SET                   \
+    SPINEL_DATATYPE_UINT8_S     /* Address context */                \
+    SPINEL_DATATYPE_DATA_WLEN_S /* PAN ID */                         \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Short address */                  \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Extended address */               \
+    SPINEL_DATATYPE_UINT8_S     /* Source address matching method */
+
+/**
+ * @brief Spinel data type description for nrf_802154_pan_context_set result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_SET_RET   SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_pan_context_clear.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_CLEAR     SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_pan_context_clear result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_CLEAR_RET SPINEL_DATATYPE_BOOL_S
+
 #ifdef __cplusplus
 }
 #endif
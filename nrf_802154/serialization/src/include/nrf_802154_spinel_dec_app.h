@@ -112,6 +112,37 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_channel(const void * p_proper
                                                            size_t       property_data_len,
                                                            uint8_t    * p_channel);
 
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_time             Decoded time of the remote core, in microseconds.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_time_get_ret(
+    const void * p_property_data,
+    size_t       property_data_len,
+    uint32_t   * p_time);
+
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE and
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_err              Decoded security error code.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_security_error_ret(
+    const void                  * p_property_data,
+    size_t                        property_data_len,
+    nrf_802154_security_error_t * p_err);
+
 /**
  * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET.
  *
@@ -127,6 +158,39 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_capabilities_get_r
     size_t                      property_data_len,
     nrf_802154_capabilities_t * p_capabilities);
 
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_stats            Array to be filled with decoded neighbor statistics.
+ * @param[in]  max_count          Number of elements in the @p p_stats array.
+ * @param[out] p_count            Number of decoded entries.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_neighbor_stats_get_ret(
+    const void                  * p_property_data,
+    size_t                        property_data_len,
+    nrf_802154_neighbor_stats_t * p_stats,
+    uint8_t                       max_count,
+    uint8_t                     * p_count);
+
+/**
+ * @brief Stores the address contexts a received frame was accepted in.
+ *
+ * The contexts are kept until the frame is freed by @ref nrf_802154_buffer_free_raw.
+ *
+ * @param[in]  p_data        Pointer to the local buffer containing the received frame.
+ * @param[in]  pan_contexts  Mask of address contexts decoded with the frame.
+ *
+ * @returns zero on success or negative error value on failure.
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_received_pan_contexts_store(
+    const uint8_t               * p_data,
+    nrf_802154_pan_context_mask_t pan_contexts);
+
 /**
  * @brief Decode and dispatch SPINEL_CMD_PROP_VALUE_IS.
  *
@@ -91,6 +91,39 @@ bail:
 
 nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
 {
+#if NRF_802154_SER_ZERO_COPY_TX_ENABLED
+    void               * p_command_buff;
+    size_t               command_buff_len;
+    spinel_ssize_t       siz;
+    nrf_802154_ser_err_t res;
+
+    va_list args;
+
+    res = nrf_802154_spinel_encoded_packet_alloc(&p_command_buff, &command_buff_len);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    va_start(args, p_fmt);
+
+    siz = spinel_datatype_vpack(p_command_buff, command_buff_len, p_fmt, args);
+
+    va_end(args);
+
+    // The packer returns the length the frame requires even if it does not fit into the buffer.
+    if ((siz < 0) || ((size_t)siz > command_buff_len))
+    {
+        nrf_802154_spinel_encoded_packet_discard(p_command_buff);
+        return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
+    }
+
+    NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
+    NRF_802154_SPINEL_LOG_BUFF_NAMED(p_command_buff, siz, "data");
+
+    return nrf_802154_spinel_encoded_packet_commit(p_command_buff, (size_t)siz);
+#else // NRF_802154_SER_ZERO_COPY_TX_ENABLED
     uint8_t        command_buff[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
     spinel_ssize_t siz;
 
@@ -102,7 +135,7 @@ nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
 
     va_end(args);
 
-    if (siz < 0)
+    if ((siz < 0) || ((size_t)siz > sizeof(command_buff)))
     {
         return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
     }
@@ -111,6 +144,7 @@ nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
     NRF_802154_SPINEL_LOG_BUFF_NAMED(command_buff, siz, "data");
 
     return nrf_802154_spinel_encoded_packet_send(command_buff, (size_t)siz);
+#endif // NRF_802154_SER_ZERO_COPY_TX_ENABLED
 }
 
 void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len)
@@ -49,6 +49,8 @@
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_serialization.h"
+#include "nrf_802154_serialization_config.h"
+#include "nrf_802154_serialization_time.h"
 #include "nrf_802154_spinel.h"
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_enc_app.h"
@@ -59,10 +61,44 @@
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_kvmap.h"
 
 #include "nrf_802154.h"
 #include "nrf_802154_types.h"
 
+/**
+ * @brief Offset between the time base of the remote core and the local time base.
+ *
+ * The remote time is the local time incremented by this value, modulo 2^32.
+ */
+static uint32_t m_remote_time_offset;
+
+/**
+ * @brief Buffer handle of the frame of the pending delayed transmission.
+ *
+ * A cancelled delayed transmission is not followed by a transmit result notification,
+ * so the handle has to be released when the cancel succeeds.
+ */
+static uint32_t m_transmit_at_data_handle;
+
+/**
+ * @brief Indicates that @ref m_transmit_at_data_handle refers to a pending delayed transmission.
+ */
+static bool m_transmit_at_pending;
+
+/**
+ * @brief Memory of the map of address contexts of the received frames that were not freed yet.
+ */
+static uint8_t m_pan_contexts_map_memory[NRF_802154_KVMAP_MEMORY_SIZE(
+                                             NRF_802154_RX_BUFFERS,
+                                             sizeof(void *),
+                                             sizeof(nrf_802154_pan_context_mask_t))];
+
+/**
+ * @brief Map of address contexts of the received frames, keyed by the local frame pointer.
+ */
+static nrf_802154_kvmap_t m_pan_contexts_map;
+
 /**
  * @brief Wait with timeout for SPINEL_STATUS_OK to be received.
  *
@@ -279,9 +315,252 @@ bail:
     return error;
 }
 
+/**
+ * @brief Wait with timeout for neighbor statistics property to be received.
+ *
+ * @param[in]  timeout    Timeout in us.
+ * @param[out] p_stats    Array to be filled with received neighbor statistics.
+ * @param[in]  max_count  Number of elements in the @p p_stats array.
+ * @param[out] p_count    Number of received entries.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t neighbor_stats_await(uint32_t                      timeout,
+                                                 nrf_802154_neighbor_stats_t * p_stats,
+                                                 uint8_t                       max_count,
+                                                 uint8_t                     * p_count)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
+        timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_neighbor_stats_get_ret(p_notify_data->data,
+                                                                          p_notify_data->data_len,
+                                                                          p_stats,
+                                                                          max_count,
+                                                                          p_count);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", *p_count, "Neighbors");
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+/**
+ * @brief Wait with timeout for time property to be received.
+ *
+ * @param[in]  timeout   Timeout in us.
+ * @param[out] p_time    Pointer to the time variable which needs to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t time_await(uint32_t timeout, uint32_t * p_time)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
+        timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_time_get_ret(p_notify_data->data,
+                                                                p_notify_data->data_len,
+                                                                p_time);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", *p_time, "time");
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+/**
+ * @brief Wait with timeout for security error property to be received.
+ *
+ * @param[in]  timeout   Timeout in us.
+ * @param[out] p_err     Pointer to the security error variable which needs to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t security_error_await(uint32_t                      timeout,
+                                                 nrf_802154_security_error_t * p_err)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
+        timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_security_error_ret(p_notify_data->data,
+                                                                      p_notify_data->data_len,
+                                                                      p_err);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", *p_err, "security error");
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+/**
+ * @brief Gets the size of the Key Identifier field for a given Key Identifier Mode.
+ *
+ * @param[in]  mode  Key Identifier Mode.
+ *
+ * @returns  Size of the Key Identifier field in bytes.
+ */
+static uint32_t key_id_size_get(nrf_802154_key_id_mode_t mode)
+{
+    switch (mode)
+    {
+        case 1:
+            return KEY_ID_MODE_1_SIZE;
+
+        case 2:
+            return KEY_ID_MODE_2_SIZE;
+
+        case 3:
+            return KEY_ID_MODE_3_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Reads the current time of the remote core.
+ *
+ * @param[out] p_time  Pointer to the variable to be populated with the remote time.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+static nrf_802154_ser_err_t remote_time_get(uint32_t * p_time)
+{
+    nrf_802154_ser_err_t res;
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET,
+        SPINEL_DATATYPE_NRF_802154_TIME_GET,
+        NULL);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    return time_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, p_time);
+}
+
+uint32_t nrf_802154_spinel_time_local_to_remote(uint32_t local_time)
+{
+    return local_time + m_remote_time_offset;
+}
+
+uint32_t nrf_802154_spinel_time_remote_to_local(uint32_t remote_time)
+{
+    return remote_time - m_remote_time_offset;
+}
+
+void nrf_802154_serialization_time_sync(void)
+{
+#if NRF_802154_SER_TIME_TRANSLATION_ENABLED
+    nrf_802154_ser_err_t res;
+    uint32_t             remote_time;
+    uint32_t             t_before;
+    uint32_t             t_after;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    t_before = nrf_802154_serialization_time_get();
+    res      = remote_time_get(&remote_time);
+    t_after  = nrf_802154_serialization_time_get();
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    // Assume the remote core sampled its clock halfway through the round trip.
+    m_remote_time_offset = remote_time - (t_before + ((t_after - t_before) / 2));
+
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", m_remote_time_offset, "time offset");
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+#endif // NRF_802154_SER_TIME_TRANSLATION_ENABLED
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_received_pan_contexts_store(
+    const uint8_t               * p_data,
+    nrf_802154_pan_context_mask_t pan_contexts)
+{
+    if (!nrf_802154_kvmap_add(&m_pan_contexts_map, &p_data, &pan_contexts))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
 void nrf_802154_init(void)
 {
+    nrf_802154_kvmap_init(&m_pan_contexts_map,
+                          m_pan_contexts_map_memory,
+                          sizeof(m_pan_contexts_map_memory),
+                          sizeof(void *),
+                          sizeof(nrf_802154_pan_context_mask_t));
+
     nrf_802154_serialization_init();
+    nrf_802154_serialization_time_sync();
 }
 
 bool nrf_802154_sleep(void)
@@ -342,6 +621,80 @@ bail:
     return receive_remote_resp;
 }
 
+bool nrf_802154_receive_at(uint32_t t0,
+                           uint32_t dt,
+                           uint32_t timeout,
+                           uint8_t  channel,
+                           uint32_t id)
+{
+    nrf_802154_ser_err_t res;
+    bool                 receive_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", t0);
+    NRF_802154_SPINEL_LOG_VAR("%u", dt);
+    NRF_802154_SPINEL_LOG_VAR("%u", timeout);
+    NRF_802154_SPINEL_LOG_VAR("%u", channel);
+    NRF_802154_SPINEL_LOG_VAR("%u", id);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_AT,
+        nrf_802154_spinel_time_local_to_remote(t0),
+        dt,
+        timeout,
+        channel,
+        id);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(&receive_result,
+                                          CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return receive_result;
+}
+
+bool nrf_802154_receive_at_cancel(uint32_t id)
+{
+    nrf_802154_ser_err_t res;
+    bool                 cancel_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", id);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL,
+        id);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(&cancel_result,
+                                          CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return cancel_result;
+}
+
 void nrf_802154_pan_id_set(const uint8_t * p_pan_id)
 {
     nrf_802154_ser_err_t res;
@@ -425,66 +778,148 @@ bail:
     return;
 }
 
-void nrf_802154_pan_coord_set(bool enabled)
+bool nrf_802154_pan_context_set(uint8_t context, const nrf_802154_pan_context_t * p_context)
 {
     nrf_802154_ser_err_t res;
+    bool                 context_set_res = false;
 
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
-    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", enabled ? "true" : "false", "enabled");
+    NRF_802154_SPINEL_LOG_VAR("%u", context);
+    NRF_802154_SPINEL_LOG_BUFF(p_context->pan_id, PAN_ID_SIZE);
+    NRF_802154_SPINEL_LOG_BUFF(p_context->short_addr, SHORT_ADDRESS_SIZE);
+    NRF_802154_SPINEL_LOG_BUFF(p_context->extended_addr, EXTENDED_ADDRESS_SIZE);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_SET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_SET,
-        SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET,
-        enabled);
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_SET,
+        SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_SET,
+        context,
+        p_context->pan_id,
+        PAN_ID_SIZE,
+        p_context->short_addr,
+        SHORT_ADDRESS_SIZE,
+        p_context->extended_addr,
+        EXTENDED_ADDRESS_SIZE,
+        (uint8_t)p_context->src_addr_match);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = net_generic_bool_response_await(&context_set_res,
+                                          CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
-    return;
+    return context_set_res;
 }
 
-void nrf_802154_promiscuous_set(bool enabled)
+bool nrf_802154_pan_context_clear(uint8_t context)
 {
     nrf_802154_ser_err_t res;
+    bool                 context_clear_res = false;
 
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
-    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", enabled ? "true" : "false", "enabled");
+    NRF_802154_SPINEL_LOG_VAR("%u", context);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_CLEAR);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PROMISCUOUS_SET,
-        SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET,
-        enabled);
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_CLEAR,
+        SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_CLEAR,
+        context);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = net_generic_bool_response_await(&context_clear_res,
+                                          CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return context_clear_res;
 }
 
-void nrf_802154_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method)
+nrf_802154_pan_context_mask_t nrf_802154_pan_contexts_get_raw(const uint8_t * p_data)
+{
+    nrf_802154_pan_context_mask_t pan_contexts = 0;
+
+    // The mask is sent along with the received frame, so no request to the remote is needed
+    (void)nrf_802154_kvmap_search(&m_pan_contexts_map, &p_data, &pan_contexts);
+
+    return pan_contexts;
+}
+
+void nrf_802154_pan_coord_set(bool enabled)
 {
     nrf_802154_ser_err_t res;
 
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
-    NRF_802154_SPINEL_LOG_VAR("%u", match_method);
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", enabled ? "true" : "false", "enabled");
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_SET,
+        SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET,
+        enabled);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+void nrf_802154_promiscuous_set(bool enabled)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", enabled ? "true" : "false", "enabled");
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PROMISCUOUS_SET,
+        SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET,
+        enabled);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+}
+
+void nrf_802154_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", match_method);
 
     nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
 
@@ -810,6 +1245,40 @@ bail:
     return ed_result;
 }
 
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us)
+{
+    nrf_802154_ser_err_t res;
+    bool                 scan_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%#x", channel_mask);
+    NRF_802154_SPINEL_LOG_VAR("%u", dwell_time_us);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN,
+        channel_mask,
+        dwell_time_us);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(
+        &scan_result,
+        CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return scan_result;
+}
+
 void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data)
 {
     nrf_802154_ser_err_t res;
@@ -893,6 +1362,110 @@ bail:
     return transmit_result;
 }
 
+bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
+                                bool            cca,
+                                uint32_t        t0,
+                                uint32_t        dt,
+                                uint8_t         channel)
+{
+    nrf_802154_ser_err_t res;
+    uint32_t             data_handle;
+    bool                 transmit_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_data, p_data[0]);
+    NRF_802154_SPINEL_LOG_VAR("%u", t0);
+    NRF_802154_SPINEL_LOG_VAR("%u", dt);
+    NRF_802154_SPINEL_LOG_VAR("%u", channel);
+
+    bool handle_added = nrf_802154_buffer_mgr_src_add(nrf_802154_spinel_src_buffer_mgr_get(),
+                                                      p_data,
+                                                      &data_handle);
+
+    SERIALIZATION_ERROR_IF(!handle_added, NRF_802154_SERIALIZATION_ERROR_NO_MEMORY, error, bail);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT,
+        SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT,
+        NRF_802154_HDATA_ENCODE(data_handle, p_data, p_data[0]),
+        cca,
+        nrf_802154_spinel_time_local_to_remote(t0),
+        dt,
+        channel);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(&transmit_result,
+                                          CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    if (transmit_result)
+    {
+        m_transmit_at_data_handle = data_handle;
+        m_transmit_at_pending     = true;
+    }
+
+    return transmit_result;
+
+bail:
+    if (handle_added)
+    {
+        /* Rollback what we did until an error to avoid memory leak. */
+        nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
+            nrf_802154_spinel_src_buffer_mgr_get(),
+            data_handle);
+    }
+
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return transmit_result;
+}
+
+bool nrf_802154_transmit_at_cancel(void)
+{
+    nrf_802154_ser_err_t res;
+    bool                 cancel_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL,
+        SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(&cancel_result,
+                                          CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    if (cancel_result && m_transmit_at_pending)
+    {
+        /* No transmit result is notified for a cancelled frame, release it here. */
+        nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
+            nrf_802154_spinel_src_buffer_mgr_get(),
+            m_transmit_at_data_handle);
+        m_transmit_at_pending = false;
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return cancel_result;
+}
+
 void nrf_802154_buffer_free_raw(uint8_t * p_data)
 {
     nrf_802154_ser_err_t res;
@@ -927,6 +1500,7 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
 
     (void)nrf_802154_buffer_mgr_dst_remove_by_local_pointer(nrf_802154_spinel_dst_buffer_mgr_get(),
                                                             p_data);
+    (void)nrf_802154_kvmap_remove(&m_pan_contexts_map, &p_data);
 
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
@@ -934,6 +1508,298 @@ bail:
     return;
 }
 
+bool nrf_802154_csma_ca_min_be_set(uint8_t min_be)
+{
+    nrf_802154_ser_err_t res;
+    bool                 min_be_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", min_be);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET,
+        min_be);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(&min_be_result,
+                                          CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return min_be_result;
+}
+
+bool nrf_802154_csma_ca_max_be_set(uint8_t max_be)
+{
+    nrf_802154_ser_err_t res;
+    bool                 max_be_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", max_be);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET,
+        max_be);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(&max_be_result,
+                                          CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return max_be_result;
+}
+
+void nrf_802154_csma_ca_max_backoffs_set(uint8_t max_backoffs)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", max_backoffs);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
+        max_backoffs);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+bool nrf_802154_ifs_mode_set(nrf_802154_ifs_mode_t mode)
+{
+    nrf_802154_ser_err_t res;
+    bool                 mode_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", mode);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET,
+        SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET,
+        mode);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(&mode_result,
+                                          CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return mode_result;
+}
+
+void nrf_802154_ifs_min_sifs_period_set(uint16_t period)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", period);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
+        SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
+        period);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+void nrf_802154_ifs_min_lifs_period_set(uint16_t period)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", period);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
+        SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
+        period);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", frame_counter);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+        frame_counter);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+nrf_802154_security_error_t nrf_802154_security_key_store(nrf_802154_key_t * p_key)
+{
+    nrf_802154_ser_err_t        res;
+    nrf_802154_security_error_t err = NRF_802154_SECURITY_ERROR_NONE;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", p_key->id.mode);
+    NRF_802154_SPINEL_LOG_BUFF(p_key->id.p_key_id, key_id_size_get(p_key->id.mode));
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE,
+        p_key->value.p_cleartext_key,
+        (uint32_t)AES_CCM_KEY_SIZE,
+        p_key->id.mode,
+        p_key->id.p_key_id,
+        key_id_size_get(p_key->id.mode),
+        p_key->type,
+        p_key->frame_counter,
+        p_key->use_global_frame_counter);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = security_error_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &err);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return err;
+}
+
+nrf_802154_security_error_t nrf_802154_security_key_remove(nrf_802154_key_id_t * p_id)
+{
+    nrf_802154_ser_err_t        res;
+    nrf_802154_security_error_t err = NRF_802154_SECURITY_ERROR_NONE;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", p_id->mode);
+    NRF_802154_SPINEL_LOG_BUFF(p_id->p_key_id, key_id_size_get(p_id->mode));
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE,
+        p_id->mode,
+        p_id->p_key_id,
+        key_id_size_get(p_id->mode));
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = security_error_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &err);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return err;
+}
+
+uint32_t nrf_802154_time_get(void)
+{
+#if NRF_802154_SER_TIME_TRANSLATION_ENABLED
+    return nrf_802154_serialization_time_get();
+#else
+    nrf_802154_ser_err_t res;
+    uint32_t             time = 0UL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    res = remote_time_get(&time);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return time;
+#endif // NRF_802154_SER_TIME_TRANSLATION_ENABLED
+}
+
 void nrf_802154_tx_power_set(int8_t power)
 {
     nrf_802154_ser_err_t res;
@@ -1016,6 +1882,93 @@ bail:
     return caps;
 }
 
+uint8_t nrf_802154_neighbor_stats_get(uint8_t                       first_index,
+                                      nrf_802154_neighbor_stats_t * p_stats,
+                                      uint8_t                       max_count)
+{
+    nrf_802154_ser_err_t res;
+    uint8_t              count = 0;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", first_index);
+    NRF_802154_SPINEL_LOG_VAR("%u", max_count);
+
+    // The table is transferred in chunks, each fitting a single spinel frame.
+    while (count < max_count)
+    {
+        uint32_t index     = (uint32_t)first_index + count;
+        uint8_t  requested = max_count - count;
+        uint8_t  received  = 0;
+
+        if (index > UINT8_MAX)
+        {
+            // No table entries exist beyond the last index.
+            break;
+        }
+
+        if (requested > NRF_802154_SPINEL_NEIGHBOR_STATS_MAX_COUNT)
+        {
+            requested = NRF_802154_SPINEL_NEIGHBOR_STATS_MAX_COUNT;
+        }
+
+        nrf_802154_spinel_response_notifier_lock_before_request(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_GET);
+
+        res = nrf_802154_spinel_send_cmd_prop_value_set(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_GET,
+            SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_GET,
+            (uint8_t)index,
+            requested);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        res = neighbor_stats_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                   &p_stats[count],
+                                   requested,
+                                   &received);
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        count += received;
+
+        if (received < requested)
+        {
+            break;
+        }
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return count;
+}
+
+void nrf_802154_neighbor_stats_reset(void)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_RESET,
+        SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_RESET,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+    return;
+}
+
 int8_t nrf_802154_dbm_from_energy_level_calculate(uint8_t energy_level)
 {
     return ED_MIN_DBM + (energy_level / ED_RESULT_FACTOR);
@@ -34,15 +34,19 @@
 
 #include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #ifndef TEST
 #include <nrf.h>
 #endif
 
+#include "nrf_802154_const.h"
+
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_spinel.h"
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_dec.h"
+#include "nrf_802154_spinel_dec_app.h"
 #include "nrf_802154_spinel_response_notifier.h"
 #include "nrf_802154_spinel_log.h"
 #include "nrf_802154_serialization_error.h"
@@ -159,6 +163,42 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection_faile
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_scan_done(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t        channel_mask;
+    const uint8_t * p_results;
+    size_t          results_len;
+
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_DONE,
+                                                &channel_mask,
+                                                &p_results,
+                                                &results_len);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    if (results_len != NRF_802154_ENERGY_SCAN_CHANNELS_NUM)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    nrf_802154_energy_scan_done(channel_mask, p_results);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
  *
@@ -169,13 +209,15 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t remote_frame_handle;
-    void   * p_frame;
-    size_t   frame_hdata_len;
-    int8_t   power;
-    uint8_t  lqi;
-    uint32_t timestamp;
-    void   * p_local_ptr;
+    uint32_t                      remote_frame_handle;
+    void                        * p_frame;
+    size_t                        frame_hdata_len;
+    int8_t                        power;
+    uint8_t                       lqi;
+    uint32_t                      timestamp;
+    nrf_802154_pan_context_mask_t pan_contexts;
+    void                        * p_local_ptr;
+    nrf_802154_ser_err_t          res;
 
     spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
                                                 property_data_len,
@@ -185,7 +227,8 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw
                                                                         frame_hdata_len),
                                                 &power,
                                                 &lqi,
-                                                &timestamp);
+                                                &timestamp,
+                                                &pan_contexts);
 
     if (siz < 0)
     {
@@ -206,7 +249,21 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw
         return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
     }
 
-    nrf_802154_received_timestamp_raw(p_local_ptr, power, lqi, timestamp);
+    res = nrf_802154_spinel_received_pan_contexts_store(p_local_ptr, pan_contexts);
+
+    if (res < 0)
+    {
+        (void)nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
+            nrf_802154_spinel_dst_buffer_mgr_get(),
+            p_local_ptr);
+
+        return res;
+    }
+
+    nrf_802154_received_timestamp_raw(p_local_ptr,
+                                      power,
+                                      lqi,
+                                      nrf_802154_spinel_time_remote_to_local(timestamp));
 
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
@@ -279,14 +336,15 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmitted_raw(
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t frame_handle;
-    uint32_t remote_ack_handle;
-    void   * p_ack;
-    size_t   ack_hdata_len;
-    int8_t   power;
-    uint8_t  lqi;
-    void   * p_frame;
-    void   * p_ack_local_ptr = NULL;
+    uint32_t                            frame_handle;
+    uint32_t                            remote_ack_handle;
+    void                              * p_ack;
+    size_t                              ack_hdata_len;
+    int8_t                              power;
+    uint8_t                             lqi;
+    nrf_802154_transmit_done_metadata_t metadata;
+    void                              * p_frame;
+    void                              * p_ack_local_ptr = NULL;
 
     spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
                                                 property_data_len,
@@ -296,7 +354,8 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmitted_raw(
                                                                         p_ack,
                                                                         ack_hdata_len),
                                                 &power,
-                                                &lqi);
+                                                &lqi,
+                                                &metadata.attempts);
 
     if (siz < 0)
     {
@@ -347,7 +406,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmitted_raw(
         return NRF_802154_SERIALIZATION_ERROR_INVALID_BUFFER;
     }
 
-    nrf_802154_transmitted_raw(p_frame, p_ack_local_ptr, power, lqi);
+    nrf_802154_transmitted_metadata_raw(p_frame, p_ack_local_ptr, power, lqi, &metadata);
 
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
@@ -362,15 +421,17 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_failed(
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t              frame_handle;
-    nrf_802154_tx_error_t tx_error;
-    void                * p_frame;
+    uint32_t                            frame_handle;
+    nrf_802154_tx_error_t               tx_error;
+    nrf_802154_transmit_done_metadata_t metadata;
+    void                              * p_frame;
 
     spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
                                                 property_data_len,
                                                 SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED,
                                                 &frame_handle,
-                                                &tx_error);
+                                                &tx_error,
+                                                &metadata.attempts);
 
     if (siz < 0)
     {
@@ -399,7 +460,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_failed(
         return NRF_802154_SERIALIZATION_ERROR_INVALID_BUFFER;
     }
 
-    nrf_802154_transmit_failed(p_frame, tx_error);
+    nrf_802154_transmit_failed_metadata(p_frame, tx_error, &metadata);
 
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
@@ -459,6 +520,34 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_channel(const void * p_proper
             NRF_802154_SERIALIZATION_ERROR_OK);
 }
 
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_time_get_ret(
+    const void * p_property_data,
+    size_t       property_data_len,
+    uint32_t   * p_time)
+{
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_TIME_GET_RET,
+                                                p_time);
+
+    return ((siz) < 0 ? NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE :
+            NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_security_error_ret(
+    const void                  * p_property_data,
+    size_t                        property_data_len,
+    nrf_802154_security_error_t * p_err)
+{
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE_RET,
+                                                p_err);
+
+    return ((siz) < 0 ? NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE :
+            NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_capabilities_get_ret(
     const void                * p_property_data,
     size_t                      property_data_len,
@@ -473,6 +562,73 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_capabilities_get_r
             NRF_802154_SERIALIZATION_ERROR_OK);
 }
 
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_neighbor_stats_get_ret(
+    const void                  * p_property_data,
+    size_t                        property_data_len,
+    nrf_802154_neighbor_stats_t * p_stats,
+    uint8_t                       max_count,
+    uint8_t                     * p_count)
+{
+    const uint8_t * p_data;
+    size_t          data_len;
+    spinel_ssize_t  siz;
+    uint8_t         count = 0;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_GET_RET,
+                                 &p_data,
+                                 &data_len);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    while (data_len > 0)
+    {
+        const uint8_t * p_addr;
+        size_t          addr_len;
+
+        if (count >= max_count)
+        {
+            return NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID;
+        }
+
+        siz = spinel_datatype_unpack(p_data,
+                                     data_len,
+                                     SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_S,
+                                     &p_addr,
+                                     &addr_len,
+                                     &p_stats[count].rssi_avg,
+                                     &p_stats[count].lqi_avg,
+                                     &p_stats[count].rx_frames,
+                                     &p_stats[count].tx_ack_requested,
+                                     &p_stats[count].tx_acked,
+                                     &p_stats[count].last_seen);
+
+        if ((siz < 0) ||
+            ((addr_len != EXTENDED_ADDRESS_SIZE) && (addr_len != SHORT_ADDRESS_SIZE)))
+        {
+            return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+        }
+
+        memset(p_stats[count].addr, 0, sizeof(p_stats[count].addr));
+        memcpy(p_stats[count].addr, p_addr, addr_len);
+        p_stats[count].extended = (addr_len == EXTENDED_ADDRESS_SIZE);
+        p_stats[count].last_seen =
+            nrf_802154_spinel_time_remote_to_local(p_stats[count].last_seen);
+
+        p_data   += siz;
+        data_len -= (size_t)siz;
+        count++;
+    }
+
+    *p_count = count;
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
     const void * p_cmd_data,
     size_t       cmd_data_len)
@@ -506,12 +662,16 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
         // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION:
         // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN:
+        // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET:
         // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET:
         // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET:
         // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_GET:
+        // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET:
         // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR:
@@ -521,6 +681,30 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR:
         // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_SET:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_CLEAR:
             nrf_802154_spinel_response_notifier_property_notify(property,
                                                                 p_property_data,
                                                                 property_data_len);
@@ -542,6 +726,10 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
             return spinel_decode_prop_nrf_802154_energy_detection_failed(p_property_data,
                                                                          property_data_len);
 
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE:
+            return spinel_decode_prop_nrf_802154_energy_scan_done(p_property_data,
+                                                                  property_data_len);
+
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW:
             return spinel_decode_prop_nrf_802154_received_timestamp_raw(p_property_data,
                                                                         property_data_len);
@@ -619,6 +807,18 @@ __WEAK void nrf_802154_transmitted_raw(const uint8_t * p_data,
     // Intentionally empty
 }
 
+__WEAK void nrf_802154_transmitted_metadata_raw(
+    const uint8_t                             * p_data,
+    uint8_t                                   * p_ack,
+    int8_t                                      rssi,
+    uint8_t                                     lqi,
+    const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_metadata;
+
+    nrf_802154_transmitted_raw(p_data, p_ack, rssi, lqi);
+}
+
 __WEAK void nrf_802154_transmit_failed(const uint8_t       * p_data,
                                        nrf_802154_tx_error_t error)
 {
@@ -626,6 +826,16 @@ __WEAK void nrf_802154_transmit_failed(const uint8_t       * p_data,
     // Intentionally empty
 }
 
+__WEAK void nrf_802154_transmit_failed_metadata(
+    const uint8_t                             * p_data,
+    nrf_802154_tx_error_t                       error,
+    const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_metadata;
+
+    nrf_802154_transmit_failed(p_data, error);
+}
+
 __WEAK void nrf_802154_tx_ack_started(const uint8_t * p_data)
 {
     (void)p_data;
@@ -656,4 +866,11 @@ __WEAK void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
     // Intentionally empty
 }
 
+__WEAK void nrf_802154_energy_scan_done(uint32_t channel_mask, const uint8_t * p_results)
+{
+    (void)channel_mask;
+    (void)p_results;
+    // Intentionally empty
+}
+
 #endif // TEST
@@ -34,6 +34,7 @@
 
 #include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154_const.h"
 
@@ -49,6 +50,13 @@
 
 #include "nrf_802154.h"
 
+/** Local copy of the frame of the pending delayed transmission.
+ *
+ * A cancelled delayed transmission is not followed by a transmit result notification,
+ * so the buffer has to be released when the cancel succeeds.
+ */
+static void * mp_transmit_at_frame;
+
 /**
  * @brief Deal with SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP request and send response.
  *
@@ -344,6 +352,40 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection(
         result);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_scan(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t       channel_mask;
+    uint32_t       dwell_time_us;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN,
+                                 &channel_mask,
+                                 &dwell_time_us);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_energy_scan(channel_mask, dwell_time_us);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_RET,
+        result);
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_AUTO_PENDING_BIT_SET.
  *
@@ -873,6 +915,708 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_capabilities_get(
         caps);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_neighbor_stats_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_neighbor_stats_t stats[NRF_802154_SPINEL_NEIGHBOR_STATS_MAX_COUNT];
+    uint8_t                     data[NRF_802154_SPINEL_NEIGHBOR_STATS_MAX_COUNT *
+                                     (sizeof(uint16_t) + sizeof(nrf_802154_neighbor_stats_t))];
+    size_t                      data_len = 0;
+    uint8_t                     first_index;
+    uint8_t                     max_count;
+    uint8_t                     count;
+    spinel_ssize_t              siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_GET,
+                                 &first_index,
+                                 &max_count);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    if (max_count > NRF_802154_SPINEL_NEIGHBOR_STATS_MAX_COUNT)
+    {
+        max_count = NRF_802154_SPINEL_NEIGHBOR_STATS_MAX_COUNT;
+    }
+
+    count = nrf_802154_neighbor_stats_get(first_index, stats, max_count);
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        siz = spinel_datatype_pack(&data[data_len],
+                                   sizeof(data) - data_len,
+                                   SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_S,
+                                   stats[i].addr,
+                                   (size_t)(stats[i].extended ? EXTENDED_ADDRESS_SIZE :
+                                            SHORT_ADDRESS_SIZE),
+                                   stats[i].rssi_avg,
+                                   stats[i].lqi_avg,
+                                   stats[i].rx_frames,
+                                   stats[i].tx_ack_requested,
+                                   stats[i].tx_acked,
+                                   stats[i].last_seen);
+
+        if (siz < 0)
+        {
+            return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
+        }
+
+        data_len += (size_t)siz;
+    }
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_GET,
+        SPINEL_DATATYPE_NRF_802154_NEIGHBOR_STATS_GET_RET,
+        data,
+        data_len);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_RESET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer - unused here (no additional data to decode).
+ * @param[in]  property_data_len  Size of the @ref p_data buffer - unused here.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_neighbor_stats_reset(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    (void)p_property_data;
+    (void)property_data_len;
+
+    nrf_802154_neighbor_stats_reset();
+
+    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw_at(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t     remote_frame_handle;
+    const void * p_frame;
+    size_t       frame_hdata_len;
+    bool         cca;
+    uint32_t     t0;
+    uint32_t     dt;
+    uint8_t      channel;
+    void       * p_local_frame_ptr;
+
+    spinel_ssize_t siz = spinel_datatype_unpack(
+        p_property_data,
+        property_data_len,
+        SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT,
+        NRF_802154_HDATA_DECODE(remote_frame_handle, p_frame, frame_hdata_len),
+        &cca,
+        &t0,
+        &dt,
+        &channel);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    // Map the remote handle to locally accessible pointer and copy the buffer content there
+    bool frame_added = nrf_802154_buffer_mgr_dst_add(
+        nrf_802154_spinel_dst_buffer_mgr_get(),
+        remote_frame_handle,
+        p_frame,
+        NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len),
+        &p_local_frame_ptr);
+
+    if (!frame_added)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+
+    bool result = nrf_802154_transmit_raw_at(p_local_frame_ptr, cca, t0, dt, channel);
+
+    if (result)
+    {
+        mp_transmit_at_frame = p_local_frame_ptr;
+    }
+    else
+    {
+        nrf_802154_buffer_mgr_dst_remove_by_local_pointer(nrf_802154_spinel_dst_buffer_mgr_get(),
+                                                          p_local_frame_ptr);
+    }
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT,
+        SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer - unused here (no additional data to decode).
+ * @param[in]  property_data_len  Size of the @ref p_data buffer - unused here.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_at_cancel(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    (void)p_property_data;
+    (void)property_data_len;
+
+    bool result = nrf_802154_transmit_at_cancel();
+
+    if (result && (mp_transmit_at_frame != NULL))
+    {
+        nrf_802154_buffer_mgr_dst_remove_by_local_pointer(nrf_802154_spinel_dst_buffer_mgr_get(),
+                                                          mp_transmit_at_frame);
+        mp_transmit_at_frame = NULL;
+    }
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL,
+        SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_RECEIVE_AT.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t       t0;
+    uint32_t       dt;
+    uint32_t       timeout;
+    uint8_t        channel;
+    uint32_t       id;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_RECEIVE_AT,
+                                 &t0,
+                                 &dt,
+                                 &timeout,
+                                 &channel,
+                                 &id);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_receive_at(t0, dt, timeout, channel, id);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at_cancel(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t       id;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL,
+                                 &id);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_receive_at_cancel(id);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer - unused here (no additional data to decode).
+ * @param[in]  property_data_len  Size of the @ref p_data buffer - unused here.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_time_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    (void)p_property_data;
+    (void)property_data_len;
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET,
+        SPINEL_DATATYPE_NRF_802154_TIME_GET_RET,
+        nrf_802154_time_get());
+}
+
+#if NRF_802154_CSMA_CA_ENABLED
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_min_be_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t        min_be;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET,
+                                 &min_be);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_csma_ca_min_be_set(min_be);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_be_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t        max_be;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET,
+                                 &max_be);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_csma_ca_max_be_set(max_be);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t        max_backoffs;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
+                                 &max_backoffs);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    nrf_802154_csma_ca_max_backoffs_set(max_backoffs);
+
+    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+}
+
+#endif // NRF_802154_CSMA_CA_ENABLED
+
+#if NRF_802154_IFS_ENABLED
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_mode_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_ifs_mode_t mode;
+    spinel_ssize_t        siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET,
+                                 &mode);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_ifs_mode_set(mode);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET,
+        SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_min_sifs_period_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint16_t       period;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
+                                 &period);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    nrf_802154_ifs_min_sifs_period_set(period);
+
+    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_min_lifs_period_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint16_t       period;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
+                                 &period);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    nrf_802154_ifs_min_lifs_period_set(period);
+
+    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+}
+
+#endif // NRF_802154_IFS_ENABLED
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_global_frame_counter_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t       frame_counter;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+                                 &frame_counter);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    nrf_802154_security_global_frame_counter_set(frame_counter);
+
+    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+}
+
+/**
+ * @brief Checks if the length of a decoded Key Identifier matches its Key Identifier Mode.
+ *
+ * @param[in]  mode    Key Identifier Mode.
+ * @param[in]  length  Length of the decoded Key Identifier field.
+ *
+ * @retval  true   Length matches the mode.
+ * @retval  false  Mode is invalid or length does not match it.
+ */
+static bool key_id_length_is_valid(nrf_802154_key_id_mode_t mode, size_t length)
+{
+    switch (mode)
+    {
+        case 0:
+            return length == 0;
+
+        case 1:
+            return length == KEY_ID_MODE_1_SIZE;
+
+        case 2:
+            return length == KEY_ID_MODE_2_SIZE;
+
+        case 3:
+            return length == KEY_ID_MODE_3_SIZE;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_key_store(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_key_t            key;
+    const void                * p_key_value;
+    size_t                      key_value_len;
+    const void                * p_key_id;
+    size_t                      key_id_len;
+    nrf_802154_security_error_t err;
+    spinel_ssize_t              siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE,
+                                 &p_key_value,
+                                 &key_value_len,
+                                 &key.id.mode,
+                                 &p_key_id,
+                                 &key_id_len,
+                                 &key.type,
+                                 &key.frame_counter,
+                                 &key.use_global_frame_counter);
+
+    if ((siz < 0) ||
+        (key_value_len != AES_CCM_KEY_SIZE) ||
+        !key_id_length_is_valid(key.id.mode, key_id_len))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    // The driver copies the key content, so it can be passed directly from the received frame.
+    key.value.p_cleartext_key = (uint8_t *)p_key_value;
+    key.id.p_key_id           = (uint8_t *)p_key_id;
+
+    err = nrf_802154_security_key_store(&key);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE_RET,
+        err);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_key_remove(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_key_id_t         id;
+    const void                * p_key_id;
+    size_t                      key_id_len;
+    nrf_802154_security_error_t err;
+    spinel_ssize_t              siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE,
+                                 &id.mode,
+                                 &p_key_id,
+                                 &key_id_len);
+
+    if ((siz < 0) || !key_id_length_is_valid(id.mode, key_id_len))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    id.p_key_id = (uint8_t *)p_key_id;
+
+    err = nrf_802154_security_key_remove(&id);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE,
+        SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE_RET,
+        err);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pan_context_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t                  context;
+    nrf_802154_pan_context_t pan_context;
+    const void             * p_pan_id;
+    size_t                   pan_id_len;
+    const void             * p_short_addr;
+    size_t                   short_addr_len;
+    const void             * p_extended_addr;
+    size_t                   extended_addr_len;
+    uint8_t                  src_addr_match;
+    bool                     result;
+    spinel_ssize_t           siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_SET,
+                                 &context,
+                                 &p_pan_id,
+                                 &pan_id_len,
+                                 &p_short_addr,
+                                 &short_addr_len,
+                                 &p_extended_addr,
+                                 &extended_addr_len,
+                                 &src_addr_match);
+
+    if ((siz < 0) ||
+        (pan_id_len != PAN_ID_SIZE) ||
+        (short_addr_len != SHORT_ADDRESS_SIZE) ||
+        (extended_addr_len != EXTENDED_ADDRESS_SIZE))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    memcpy(pan_context.pan_id, p_pan_id, PAN_ID_SIZE);
+    memcpy(pan_context.short_addr, p_short_addr, SHORT_ADDRESS_SIZE);
+    memcpy(pan_context.extended_addr, p_extended_addr, EXTENDED_ADDRESS_SIZE);
+    pan_context.src_addr_match = (nrf_802154_src_addr_match_t)src_addr_match;
+
+    result = nrf_802154_pan_context_set(context, &pan_context);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_SET,
+        SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_SET_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_CLEAR.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pan_context_clear(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t        context;
+    bool           result;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_CLEAR,
+                                 &context);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    result = nrf_802154_pan_context_clear(context);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_CLEAR,
+        SPINEL_DATATYPE_NRF_802154_PAN_CONTEXT_CLEAR_RET,
+        result);
+}
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_cmd_data,
                                                                  size_t       cmd_data_len)
 {
@@ -952,6 +1696,10 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_
             return spinel_decode_prop_nrf_802154_energy_detection(p_property_data,
                                                                   property_data_len);
 
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN:
+            return spinel_decode_prop_nrf_802154_energy_scan(p_property_data,
+                                                             property_data_len);
+
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET:
             return spinel_decode_prop_nrf_802154_tx_power_set(p_property_data, property_data_len);
 
@@ -981,6 +1729,80 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_
             return spinel_decode_prop_nrf_802154_ack_data_clear(p_property_data,
                                                                 property_data_len);
 
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_GET:
+            return spinel_decode_prop_nrf_802154_neighbor_stats_get(p_property_data,
+                                                                    property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_NEIGHBOR_STATS_RESET:
+            return spinel_decode_prop_nrf_802154_neighbor_stats_reset(p_property_data,
+                                                                      property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT:
+            return spinel_decode_prop_nrf_802154_transmit_raw_at(p_property_data,
+                                                                 property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL:
+            return spinel_decode_prop_nrf_802154_transmit_at_cancel(p_property_data,
+                                                                    property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT:
+            return spinel_decode_prop_nrf_802154_receive_at(p_property_data, property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL:
+            return spinel_decode_prop_nrf_802154_receive_at_cancel(p_property_data,
+                                                                   property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET:
+            return spinel_decode_prop_nrf_802154_time_get(p_property_data, property_data_len);
+
+#if NRF_802154_CSMA_CA_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET:
+            return spinel_decode_prop_nrf_802154_csma_ca_min_be_set(p_property_data,
+                                                                    property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET:
+            return spinel_decode_prop_nrf_802154_csma_ca_max_be_set(p_property_data,
+                                                                    property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET:
+            return spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_set(p_property_data,
+                                                                          property_data_len);
+#endif // NRF_802154_CSMA_CA_ENABLED
+
+#if NRF_802154_IFS_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET:
+            return spinel_decode_prop_nrf_802154_ifs_mode_set(p_property_data, property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_SET:
+            return spinel_decode_prop_nrf_802154_ifs_min_sifs_period_set(p_property_data,
+                                                                         property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_SET:
+            return spinel_decode_prop_nrf_802154_ifs_min_lifs_period_set(p_property_data,
+                                                                         property_data_len);
+#endif // NRF_802154_IFS_ENABLED
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET:
+            return spinel_decode_prop_nrf_802154_security_global_frame_counter_set(
+                p_property_data,
+                property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE:
+            return spinel_decode_prop_nrf_802154_security_key_store(p_property_data,
+                                                                    property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE:
+            return spinel_decode_prop_nrf_802154_security_key_remove(p_property_data,
+                                                                     property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_SET:
+            return spinel_decode_prop_nrf_802154_pan_context_set(p_property_data,
+                                                                 property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_CONTEXT_CLEAR:
+            return spinel_decode_prop_nrf_802154_pan_context_clear(p_property_data,
+                                                                   property_data_len);
+
         default:
             NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
                                       spinel_prop_key_to_cstr(property),
@@ -169,6 +169,30 @@ bail:
     return;
 }
 
+void nrf_802154_energy_scan_done(uint32_t channel_mask, const uint8_t * p_results)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%#x", channel_mask);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_DONE,
+        channel_mask,
+        p_results,
+        NRF_802154_ENERGY_SCAN_CHANNELS_NUM);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
 void nrf_802154_tx_ack_started(const uint8_t * p_data)
 {
     /* Due to timing restrictions this function cannot be serialized directly.
@@ -234,7 +258,8 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
         NRF_802154_HDATA_ENCODE(local_data_handle, p_data, p_data[0]),
         power,
         lqi,
-        time);
+        time,
+        nrf_802154_pan_contexts_get_raw(p_data));
 
     if (res < 0)
     {
@@ -278,10 +303,12 @@ bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(ser_error);
 }
 
-void nrf_802154_transmitted_raw(const uint8_t * p_frame,
-                                uint8_t       * p_ack,
-                                int8_t          power,
-                                uint8_t         lqi)
+void nrf_802154_transmitted_metadata_raw(
+    const uint8_t                             * p_frame,
+    uint8_t                                   * p_ack,
+    int8_t                                      power,
+    uint8_t                                     lqi,
+    const nrf_802154_transmit_done_metadata_t * p_metadata)
 {
     uint32_t remote_frame_handle;
     uint32_t ack_handle = 0;
@@ -329,7 +356,8 @@ void nrf_802154_transmitted_raw(const uint8_t * p_frame,
         remote_frame_handle,
         NRF_802154_HDATA_ENCODE(ack_handle, p_ack, ack_len),
         power,
-        lqi);
+        lqi,
+        p_metadata->attempts);
 
     // Free the local frame pointer no matter the result of serialization
     local_transmitted_frame_ptr_free((void *)p_frame);
@@ -343,8 +371,10 @@ bail:
     return;
 }
 
-void nrf_802154_transmit_failed(const uint8_t       * p_frame,
-                                nrf_802154_tx_error_t tx_error)
+void nrf_802154_transmit_failed_metadata(
+    const uint8_t                             * p_frame,
+    nrf_802154_tx_error_t                       tx_error,
+    const nrf_802154_transmit_done_metadata_t * p_metadata)
 {
     uint32_t remote_frame_handle;
 
@@ -370,7 +400,8 @@ void nrf_802154_transmit_failed(const uint8_t       * p_frame,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_FAILED,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED,
         remote_frame_handle,
-        tx_error);
+        tx_error,
+        p_metadata->attempts);
 
     // Free the local frame pointer no matter the result of serialization
     local_transmitted_frame_ptr_free((void *)p_frame);
@@ -43,6 +43,7 @@
 #include <stdbool.h>
 
 #include "nrf.h"
+#include "nrf_802154_sl_config.h"
 
 /**
  * @brief RSSI measurement results.
@@ -78,7 +79,7 @@ typedef uint8_t nrf_802154_sl_ant_div_mode_t;
 
 #define NRF_802154_SL_ANT_DIV_MODE_DISABLED 0x00 // !< Antenna diversity is disabled - Antenna will not be controlled by sl_ant_div module. While in this mode, current antenna is unspecified.
 #define NRF_802154_SL_ANT_DIV_MODE_MANUAL   0x01 // !< Antenna is selected manually
-#define NRF_802154_SL_ANT_DIV_MODE_AUTO     0x02 // !< Antenna is selected automatically based on RSSI - not supported for transmission.
+#define NRF_802154_SL_ANT_DIV_MODE_AUTO     0x02 // !< Antenna is selected automatically based on RSSI - supported for transmission only if NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE is not 0.
 
 /**
  * @brief Available antennas
@@ -383,4 +384,33 @@ void nrf_802154_sl_ant_div_energy_detection_aborted_notify(void);
  */
 void nrf_802154_sl_ant_div_txack_notify(void);
 
+#if NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+
+/**
+ * @brief Notification to be called with the source address of a successfully received frame.
+ *
+ * This notification must be called after @ref nrf_802154_sl_ant_div_rx_frame_received_notify.
+ * The RSSI measured on both antennas during reception of the frame is used to update the best
+ * antenna remembered for the neighbor.
+ *
+ * @param[in] p_src_addr  Pointer to the source address of the received frame (little-endian).
+ * @param[in] extended    True if @p p_src_addr is an extended address, false if short.
+ */
+void nrf_802154_sl_ant_div_rx_frame_source_notify(const uint8_t * p_src_addr, bool extended);
+
+/**
+ * @brief Notification to be called when transmission of a frame is about to be started.
+ *
+ * When antenna diversity for transmission operates in @ref NRF_802154_SL_ANT_DIV_MODE_AUTO mode,
+ * this notification selects the antenna returned by @ref nrf_802154_sl_ant_div_cfg_antenna_get
+ * for @ref NRF_802154_SL_ANT_DIV_OP_TX, based on the best antenna remembered for the destination.
+ *
+ * @param[in] p_dst_addr  Pointer to the destination address of the frame (little-endian),
+ *                        or NULL if the frame has no destination address.
+ * @param[in] extended    True if @p p_dst_addr is an extended address, false if short.
+ */
+void nrf_802154_sl_ant_div_tx_frame_destination_notify(const uint8_t * p_dst_addr, bool extended);
+
+#endif // NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+
 #endif // NRF_802154_SL_ANT_DIV_H
@@ -80,4 +80,19 @@
 #define NRF_802154_SL_ANT_DIV_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+ *
+ * Number of neighbors for which the antenna diversity module remembers the best antenna.
+ * The best antenna of a neighbor is learned from RSSI measurements performed on both antennas
+ * during reception of frames from that neighbor, and is used to transmit frames to it when
+ * antenna diversity for transmission operates in @ref NRF_802154_SL_ANT_DIV_MODE_AUTO mode.
+ * Setting this option to 0 disables the per-neighbor antenna memory.
+ *
+ * @note This option is supported only by the open-source implementation of the Service Layer.
+ */
+#ifndef NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+#define NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE 0
+#endif
+
 #endif // NRF_802154_SL_CONFIG_H__
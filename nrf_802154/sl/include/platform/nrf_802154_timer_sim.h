@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that controls the simulated clock of the host timer backends.
+ *
+ */
+
+#ifndef NRF_802154_TIMER_SIM_H_
+#define NRF_802154_TIMER_SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_timer_sim Simulated clock for the 802.15.4 driver timers
+ * @{
+ * @ingroup nrf_802154_timer
+ * @brief Simulated clock driving the host implementations of the LP and HP timers.
+ *
+ * The simulated LP and HP timer implementations do not use any peripheral. Time is kept in
+ * a virtual 64-bit microsecond counter that advances only when requested by the functions of
+ * this module, which makes the timing of the driver fully deterministic and allows to run
+ * long scenarios at accelerated time.
+ *
+ * Timers that expire while the clock advances fire in the order of their expiration times,
+ * with the clock set to the expiration time of the timer being fired. A timer started with
+ * an expiration time in the past fires during the next call to @ref nrf_802154_timer_sim_advance.
+ * Timers that expire while the LP timer critical section is entered fire when the critical
+ * section is exited.
+ *
+ * The 32-bit time seen by the driver wraps around every 2^32 microseconds. Wraparound handling
+ * can be tested by moving the clock close to the wraparound point with
+ * @ref nrf_802154_timer_sim_wraparound_inject.
+ */
+
+/**
+ * @brief Resets the simulated clock.
+ *
+ * Stops all simulated timers and sets the clock to the given time.
+ *
+ * @param[in]  time  Initial time of the clock in microseconds.
+ */
+void nrf_802154_timer_sim_reset(uint64_t time);
+
+/**
+ * @brief Gets the current time of the simulated clock.
+ *
+ * @returns  Current time in microseconds.
+ */
+uint64_t nrf_802154_timer_sim_time_get(void);
+
+/**
+ * @brief Advances the simulated clock, firing timers that expire on the way.
+ *
+ * @param[in]  dt  Time to advance the clock by, in microseconds.
+ */
+void nrf_802154_timer_sim_advance(uint64_t dt);
+
+/**
+ * @brief Advances the simulated clock to the expiration time of the nearest running timer.
+ *
+ * @retval  true   A timer was fired.
+ * @retval  false  No timer is running. The clock was not advanced.
+ */
+bool nrf_802154_timer_sim_advance_to_next_event(void);
+
+/**
+ * @brief Advances the simulated clock to a point just before the 32-bit time wraps around.
+ *
+ * Timers that expire before that point fire as with @ref nrf_802154_timer_sim_advance.
+ *
+ * @param[in]  margin  Time in microseconds left until the wraparound after the call.
+ */
+void nrf_802154_timer_sim_wraparound_inject(uint32_t margin);
+
+/**
+ * @brief Captures the current HP timer value as the timestamp of an event.
+ *
+ * Simulates triggering of the task returned by @ref nrf_802154_hp_timer_timestamp_task_get.
+ * The captured value is returned by @ref nrf_802154_hp_timer_timestamp_get.
+ */
+void nrf_802154_timer_sim_hp_timestamp_capture(void);
+
+/**
+ * @brief Captures the current HP timer value as the synchronization timestamp.
+ *
+ * Simulates triggering of the task returned by @ref nrf_802154_hp_timer_sync_task_get.
+ * The simulated LP timer calls this function when its synchronization timer expires.
+ */
+void nrf_802154_timer_sim_hp_sync_capture(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_TIMER_SIM_H_ */
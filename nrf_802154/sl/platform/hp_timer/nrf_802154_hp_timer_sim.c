@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file contains the host implementation of the nRF 802.15.4 high precision timer abstraction.
+ *
+ * This implementation does not use any peripheral. It counts microseconds of the simulated clock
+ * controlled through the nrf_802154_timer_sim module.
+ *
+ */
+
+#include "platform/nrf_802154_hp_timer.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform/nrf_802154_timer_sim.h"
+
+#define SIM_SYNC_TASK_ADDRESS      0xfffff004UL ///< Dummy address of the synchronization task.
+#define SIM_TIMESTAMP_TASK_ADDRESS 0xfffff008UL ///< Dummy address of the timestamp task.
+
+static uint64_t m_start_time;  ///< Time of the simulated clock when the timer was started [us].
+static uint32_t m_sync_time;   ///< Timer value captured by the synchronization task.
+static bool     m_sync_valid;  ///< Information if @ref m_sync_time was captured since preparation.
+static uint32_t m_timestamp;   ///< Timer value captured by the timestamp task.
+
+/**@brief Get current time on the Timer. */
+static inline uint32_t timer_time_get(void)
+{
+    return (uint32_t)(nrf_802154_timer_sim_time_get() - m_start_time);
+}
+
+void nrf_802154_timer_sim_hp_timestamp_capture(void)
+{
+    m_timestamp = timer_time_get();
+}
+
+void nrf_802154_timer_sim_hp_sync_capture(void)
+{
+    m_sync_time  = timer_time_get();
+    m_sync_valid = true;
+}
+
+void nrf_802154_hp_timer_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_hp_timer_deinit(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_hp_timer_start(void)
+{
+    m_start_time = nrf_802154_timer_sim_time_get();
+}
+
+void nrf_802154_hp_timer_stop(void)
+{
+    // Intentionally empty
+}
+
+uint32_t nrf_802154_hp_timer_sync_task_get(void)
+{
+    return SIM_SYNC_TASK_ADDRESS;
+}
+
+void nrf_802154_hp_timer_sync_prepare(void)
+{
+    m_sync_valid = false;
+}
+
+bool nrf_802154_hp_timer_sync_time_get(uint32_t * p_timestamp)
+{
+    assert(p_timestamp != NULL);
+
+    if (m_sync_valid)
+    {
+        *p_timestamp = m_sync_time;
+    }
+
+    return m_sync_valid;
+}
+
+uint32_t nrf_802154_hp_timer_timestamp_task_get(void)
+{
+    return SIM_TIMESTAMP_TASK_ADDRESS;
+}
+
+uint32_t nrf_802154_hp_timer_timestamp_get(void)
+{
+    return m_timestamp;
+}
+
+uint32_t nrf_802154_hp_timer_current_time_get(void)
+{
+    return timer_time_get();
+}
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file contains the host implementation of the nRF 802.15.4 timer abstraction.
+ *
+ * This implementation does not use any peripheral. It is driven by the simulated clock
+ * controlled through the nrf_802154_timer_sim module, and is intended for tests and benchmarks
+ * of the driver running on a host.
+ *
+ */
+
+#include "platform/nrf_802154_lp_timer.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform/nrf_802154_timer_sim.h"
+
+#define HALF_32BIT_US              (1ULL << 31)
+#define EPOCH_32BIT_US             (1ULL << 32)
+
+#define SIM_SYNC_EVENT_ADDRESS     0xfffff000UL ///< Dummy address of the synchronization event.
+
+// Enum holding all simulated compare channels.
+typedef enum {LP_TIMER_CHANNEL, SYNC_CHANNEL, CHANNEL_CNT} compare_channel_t;
+
+static uint64_t m_now;                       ///< Current time of the simulated clock [us].
+static uint64_t m_target_times[CHANNEL_CNT]; ///< Target time of given channel [us].
+static bool     m_running[CHANNEL_CNT];      ///< Information if given channel is running.
+static uint32_t m_critical_section;          ///< Nesting level of the timer critical section.
+static bool     m_firing;                    ///< Information if a timer callback is being executed.
+
+/** @brief Convert 32-bit time to the nearest 64-bit time of the simulated clock. */
+static uint64_t convert_to_64bit_time(uint32_t time)
+{
+    uint32_t now = (uint32_t)m_now;
+
+    if ((uint32_t)(now - time) < HALF_32BIT_US)
+    {
+        // Given time is in the past.
+        return m_now - (uint32_t)(now - time);
+    }
+    else
+    {
+        return m_now + (uint32_t)(time - now);
+    }
+}
+
+/** @brief Get the running channel with the earliest target time.
+ *
+ * @param[out]  p_channel  Channel with the earliest target time.
+ *
+ * @retval  true   A channel is running and @p p_channel is valid.
+ * @retval  false  No channel is running.
+ */
+static bool next_channel_get(compare_channel_t * p_channel)
+{
+    bool found = false;
+
+    for (compare_channel_t ch = LP_TIMER_CHANNEL; ch < CHANNEL_CNT; ch++)
+    {
+        if (m_running[ch] && (!found || (m_target_times[ch] < m_target_times[*p_channel])))
+        {
+            *p_channel = ch;
+            found      = true;
+        }
+    }
+
+    return found;
+}
+
+/** @brief Fire the given channel. */
+static void channel_fire(compare_channel_t channel)
+{
+    m_running[channel] = false;
+    m_firing           = true;
+
+    if (channel == SYNC_CHANNEL)
+    {
+        nrf_802154_timer_sim_hp_sync_capture();
+        nrf_802154_lp_timer_synchronized();
+    }
+    else
+    {
+        nrf_802154_lp_timer_fired();
+    }
+
+    m_firing = false;
+}
+
+/** @brief Fire all channels that expire not later than the given time, in order.
+ *
+ * When the critical section is entered, expired channels are left pending until the critical
+ * section is exited.
+ *
+ * @param[in]  end_time  Time the clock is advanced to.
+ */
+static void clock_advance_to(uint64_t end_time)
+{
+    compare_channel_t channel;
+
+    // Timer callbacks must not advance the clock.
+    assert(!m_firing);
+
+    while (next_channel_get(&channel) && (m_target_times[channel] <= end_time))
+    {
+        if (m_critical_section > 0)
+        {
+            break;
+        }
+
+        if (m_target_times[channel] > m_now)
+        {
+            m_now = m_target_times[channel];
+        }
+
+        channel_fire(channel);
+    }
+
+    if (end_time > m_now)
+    {
+        m_now = end_time;
+    }
+}
+
+/** @brief Start the given channel. */
+static void channel_start(compare_channel_t channel, uint32_t t0, uint32_t dt)
+{
+    m_target_times[channel] = convert_to_64bit_time(t0) + dt;
+    m_running[channel]      = true;
+}
+
+void nrf_802154_timer_sim_reset(uint64_t time)
+{
+    m_now              = time;
+    m_critical_section = 0;
+    m_firing           = false;
+
+    for (compare_channel_t ch = LP_TIMER_CHANNEL; ch < CHANNEL_CNT; ch++)
+    {
+        m_running[ch]      = false;
+        m_target_times[ch] = 0;
+    }
+}
+
+uint64_t nrf_802154_timer_sim_time_get(void)
+{
+    return m_now;
+}
+
+void nrf_802154_timer_sim_advance(uint64_t dt)
+{
+    clock_advance_to(m_now + dt);
+}
+
+bool nrf_802154_timer_sim_advance_to_next_event(void)
+{
+    compare_channel_t channel;
+
+    if (!next_channel_get(&channel))
+    {
+        return false;
+    }
+
+    clock_advance_to((m_target_times[channel] > m_now) ? m_target_times[channel] : m_now);
+
+    return true;
+}
+
+void nrf_802154_timer_sim_wraparound_inject(uint32_t margin)
+{
+    uint64_t wrap_time = (m_now - (uint32_t)m_now) + EPOCH_32BIT_US;
+
+    if (wrap_time - m_now < margin)
+    {
+        wrap_time += EPOCH_32BIT_US;
+    }
+
+    clock_advance_to(wrap_time - margin);
+}
+
+void nrf_802154_lp_timer_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_lp_timer_deinit(void)
+{
+    m_running[LP_TIMER_CHANNEL] = false;
+    m_running[SYNC_CHANNEL]     = false;
+}
+
+void nrf_802154_lp_timer_critical_section_enter(void)
+{
+    // Nesting is tolerated, so that the timer scheduler built on top of this implementation
+    // can protect its list while the driver critical section is entered.
+    m_critical_section++;
+}
+
+void nrf_802154_lp_timer_critical_section_exit(void)
+{
+    assert(m_critical_section > 0);
+
+    m_critical_section--;
+
+    // Fire channels which expired while the critical section was entered.
+    if ((m_critical_section == 0) && !m_firing)
+    {
+        clock_advance_to(m_now);
+    }
+}
+
+uint32_t nrf_802154_lp_timer_time_get(void)
+{
+    return (uint32_t)m_now;
+}
+
+uint32_t nrf_802154_lp_timer_granularity_get(void)
+{
+    return 1UL;
+}
+
+void nrf_802154_lp_timer_start(uint32_t t0, uint32_t dt)
+{
+    channel_start(LP_TIMER_CHANNEL, t0, dt);
+}
+
+void nrf_802154_lp_timer_stop(void)
+{
+    m_running[LP_TIMER_CHANNEL] = false;
+}
+
+bool nrf_802154_lp_timer_is_running(void)
+{
+    return m_running[LP_TIMER_CHANNEL];
+}
+
+void nrf_802154_lp_timer_sync_start_now(void)
+{
+    channel_start(SYNC_CHANNEL, (uint32_t)m_now, 0);
+}
+
+void nrf_802154_lp_timer_sync_start_at(uint32_t t0, uint32_t dt)
+{
+    channel_start(SYNC_CHANNEL, t0, dt);
+}
+
+void nrf_802154_lp_timer_sync_stop(void)
+{
+    m_running[SYNC_CHANNEL] = false;
+}
+
+uint32_t nrf_802154_lp_timer_sync_event_get(void)
+{
+    return SIM_SYNC_EVENT_ADDRESS;
+}
+
+uint32_t nrf_802154_lp_timer_sync_time_get(void)
+{
+    return (uint32_t)m_target_times[SYNC_CHANNEL];
+}
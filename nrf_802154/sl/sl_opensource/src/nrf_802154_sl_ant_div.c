@@ -34,130 +34,514 @@
 
 /**
  * @brief 802.15.4 antenna diversity module.
+ *
+ * This implementation controls the antenna with the antenna selection pin. When the automatic
+ * mode is enabled for reception, the RSSI is sampled on both antennas as soon as a preamble is
+ * detected and the antenna with the stronger signal is used for the rest of the frame. Energy
+ * detection is split between both antennas. Optionally, the best antenna of each neighbor is
+ * remembered and used for transmission of frames to that neighbor.
+ *
+ * @note The PPI, GPIOTE and TIMER resources from @ref nrf_802154_sl_ant_div_cfg_t are not used,
+ *       as the antenna is not toggled while waiting for a preamble.
  */
 
 #include "nrf_802154_sl_ant_div.h"
 
+#include <stddef.h>
+#include <string.h>
+
+#include "hal/nrf_gpio.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define ANT_DIV_OPS_NUM           2 ///< Number of types of antenna diversity operations.
+#define ANT_DIV_ADDR_SIZE_MAX     8 ///< Size of the extended address.
+#define ANT_DIV_ADDR_SIZE_SHORT   2 ///< Size of the short address.
+
+#define ANT_DIV_RSSI_DIFF_WEIGHT  4 ///< Weight of the history in the RSSI difference average.
+
+static nrf_802154_sl_ant_div_cfg_t     m_cfg;                          ///< Interface configuration.
+static bool                            m_cfg_is_set;                   ///< Flag indicating that the interface is configured.
+static bool                            m_is_initialized;               ///< Flag indicating that the module is initialized.
+static nrf_802154_sl_ant_div_mode_t    m_mode[ANT_DIV_OPS_NUM];        ///< Modes of antenna diversity operations.
+static nrf_802154_sl_ant_div_antenna_t m_cfg_antenna[ANT_DIV_OPS_NUM]; ///< Antennas selected for manual mode.
+
+static nrf_802154_sl_ant_div_antenna_t m_antenna              = NRF_802154_SL_ANT_DIV_ANTENNA_NONE; ///< Currently used antenna.
+static nrf_802154_sl_ant_div_antenna_t m_rx_best_antenna      = NRF_802154_SL_ANT_DIV_ANTENNA_NONE; ///< Best antenna for the frame being received.
+static nrf_802154_sl_ant_div_antenna_t m_last_rx_best_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE; ///< Best antenna for the last received frame.
+
+static bool   m_rssi_measured; ///< Flag indicating that RSSI was measured on both antennas for the current preamble.
+static int8_t m_rssi_diff;     ///< RSSI on the second antenna minus RSSI on the first one, for the current preamble.
+
+static uint8_t  m_ed_pass;           ///< Energy detection pass: 0 - idle, 1 - first antenna, 2 - second antenna.
+static bool     m_ed_second_pending; ///< Flag indicating that the second energy detection pass is to be started.
+static uint32_t m_ed_second_time;    ///< Time of energy detection on the second antenna [us].
+
+#if NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+
+/**
+ * @brief Best antenna memory entry of a single neighbor.
+ */
+typedef struct
+{
+    uint8_t addr[ANT_DIV_ADDR_SIZE_MAX]; ///< Address of the neighbor.
+    uint8_t addr_size;                   ///< Size of the address. Zero if the entry is unused.
+    int8_t  rssi_diff;                   ///< Averaged RSSI on the second antenna minus RSSI on the first one.
+} ant_div_neighbor_t;
+
+static ant_div_neighbor_t m_neighbors[NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE]; ///< Best antenna memory.
+static uint8_t            m_neighbor_next;                                        ///< Index of the entry to be replaced next.
+
+static bool   m_last_rx_rssi_measured; ///< Flag indicating that RSSI was measured for the last received frame.
+static int8_t m_last_rx_rssi_diff;     ///< RSSI difference measured for the last received frame.
+
+static nrf_802154_sl_ant_div_antenna_t m_tx_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE; ///< Antenna selected for the current transmission.
+
+#endif // NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+
+static bool op_is_valid(nrf_802154_sl_ant_div_op_t op)
+{
+    return (op == NRF_802154_SL_ANT_DIV_OP_RX) || (op == NRF_802154_SL_ANT_DIV_OP_TX);
+}
+
+static bool antenna_is_valid(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    return (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_1) ||
+           (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_2);
+}
+
+static nrf_802154_sl_ant_div_antenna_t antenna_other_get(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    return (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_1) ?
+           NRF_802154_SL_ANT_DIV_ANTENNA_2 : NRF_802154_SL_ANT_DIV_ANTENNA_1;
+}
+
+static void antenna_switch(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    if (antenna != m_antenna)
+    {
+        nrf_gpio_pin_write(m_cfg.ant_sel_pin, (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_2) ? 1 : 0);
+        m_antenna = antenna;
+    }
+}
+
+static bool rx_auto_mode_is_enabled(void)
+{
+    return m_is_initialized &&
+           (m_mode[NRF_802154_SL_ANT_DIV_OP_RX] == NRF_802154_SL_ANT_DIV_MODE_AUTO);
+}
+
+/** Antenna on which the receiver should listen for the next preamble. */
+static nrf_802154_sl_ant_div_antenna_t rx_listening_antenna_get(void)
+{
+    return antenna_is_valid(m_last_rx_best_antenna) ?
+           m_last_rx_best_antenna : m_cfg_antenna[NRF_802154_SL_ANT_DIV_OP_RX];
+}
+
+static void rx_measurement_reset(void)
+{
+    m_rssi_measured   = false;
+    m_rx_best_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+}
+
+#if NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+
+static nrf_802154_sl_ant_div_antenna_t antenna_from_rssi_diff(int8_t rssi_diff)
+{
+    return (rssi_diff > 0) ? NRF_802154_SL_ANT_DIV_ANTENNA_2 : NRF_802154_SL_ANT_DIV_ANTENNA_1;
+}
+
+static ant_div_neighbor_t * neighbor_find(const uint8_t * p_addr, uint8_t addr_size)
+{
+    for (uint32_t i = 0; i < NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE; i++)
+    {
+        if ((m_neighbors[i].addr_size == addr_size) &&
+            (0 == memcmp(m_neighbors[i].addr, p_addr, addr_size)))
+        {
+            return &m_neighbors[i];
+        }
+    }
+
+    return NULL;
+}
+
+static ant_div_neighbor_t * neighbor_add(const uint8_t * p_addr, uint8_t addr_size)
+{
+    ant_div_neighbor_t * p_neighbor = &m_neighbors[m_neighbor_next];
+
+    m_neighbor_next = (m_neighbor_next + 1) % NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE;
+
+    memcpy(p_neighbor->addr, p_addr, addr_size);
+    p_neighbor->addr_size = addr_size;
+    p_neighbor->rssi_diff = 0;
+
+    return p_neighbor;
+}
+
+static bool addr_is_broadcast(const uint8_t * p_addr, uint8_t addr_size)
+{
+    return (addr_size == ANT_DIV_ADDR_SIZE_SHORT) && (p_addr[0] == 0xff) && (p_addr[1] == 0xff);
+}
+
+#endif // NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+
 void nrf_802154_sl_ant_div_cfg_set(const nrf_802154_sl_ant_div_cfg_t * p_cfg)
 {
-    (void)p_cfg;
+    if (m_cfg_is_set || (p_cfg == NULL))
+    {
+        return;
+    }
+
+    m_cfg        = *p_cfg;
+    m_cfg_is_set = true;
 }
 
 bool nrf_802154_sl_ant_div_cfg_get(nrf_802154_sl_ant_div_cfg_t * p_cfg)
 {
-    (void)p_cfg;
+    if (!m_cfg_is_set)
+    {
+        return false;
+    }
 
-    return false;
+    *p_cfg = m_cfg;
+
+    return true;
 }
 
 bool nrf_802154_sl_ant_div_cfg_mode_set(nrf_802154_sl_ant_div_op_t   op,
                                         nrf_802154_sl_ant_div_mode_t mode)
 {
-    (void)op;
-    (void)mode;
+    if (!op_is_valid(op))
+    {
+        return false;
+    }
 
-    return false;
+    switch (mode)
+    {
+        case NRF_802154_SL_ANT_DIV_MODE_DISABLED:
+        case NRF_802154_SL_ANT_DIV_MODE_MANUAL:
+            break;
+
+        case NRF_802154_SL_ANT_DIV_MODE_AUTO:
+#if !NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+            if (op == NRF_802154_SL_ANT_DIV_OP_TX)
+            {
+                return false;
+            }
+#endif
+            break;
+
+        default:
+            return false;
+    }
+
+    if ((op == NRF_802154_SL_ANT_DIV_OP_RX) && (m_mode[op] != mode))
+    {
+        if (mode == NRF_802154_SL_ANT_DIV_MODE_AUTO)
+        {
+            nrf_802154_sl_ant_div_rx_auto_mode_enable_notify();
+        }
+        else if (m_mode[op] == NRF_802154_SL_ANT_DIV_MODE_AUTO)
+        {
+            nrf_802154_sl_ant_div_rx_auto_mode_disable_notify();
+        }
+    }
+
+    m_mode[op] = mode;
+
+    return true;
 }
 
 nrf_802154_sl_ant_div_mode_t nrf_802154_sl_ant_div_cfg_mode_get(nrf_802154_sl_ant_div_op_t op)
 {
-    (void)op;
-
-    return NRF_802154_SL_ANT_DIV_MODE_DISABLED;
+    return op_is_valid(op) ? m_mode[op] : NRF_802154_SL_ANT_DIV_MODE_DISABLED;
 }
 
 bool nrf_802154_sl_ant_div_cfg_antenna_set(nrf_802154_sl_ant_div_op_t      op,
                                            nrf_802154_sl_ant_div_antenna_t antenna)
 {
-    (void)op;
-    (void)antenna;
+    if (!op_is_valid(op) || !antenna_is_valid(antenna))
+    {
+        return false;
+    }
 
-    return false;
+    m_cfg_antenna[op] = antenna;
+
+    return true;
 }
 
 nrf_802154_sl_ant_div_antenna_t nrf_802154_sl_ant_div_cfg_antenna_get(nrf_802154_sl_ant_div_op_t op)
 {
-    (void)op;
+    if (!op_is_valid(op))
+    {
+        return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    }
+
+#if NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+    if ((op == NRF_802154_SL_ANT_DIV_OP_TX) &&
+        (m_mode[op] == NRF_802154_SL_ANT_DIV_MODE_AUTO) &&
+        antenna_is_valid(m_tx_antenna))
+    {
+        return m_tx_antenna;
+    }
+#endif
 
-    return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    return m_cfg_antenna[op];
 }
 
 bool nrf_802154_sl_ant_div_init(void)
 {
-    return false;
+    if (!m_cfg_is_set)
+    {
+        return false;
+    }
+
+    nrf_gpio_cfg_output(m_cfg.ant_sel_pin);
+
+    m_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    antenna_switch(NRF_802154_SL_ANT_DIV_ANTENNA_1);
+    rx_measurement_reset();
+
+    m_is_initialized = true;
+
+    return true;
 }
 
 bool nrf_802154_sl_ant_div_antenna_set(nrf_802154_sl_ant_div_antenna_t antenna)
 {
-    (void)antenna;
+    if (!antenna_is_valid(antenna) || !m_is_initialized)
+    {
+        return false;
+    }
 
-    return false;
+    antenna_switch(antenna);
+
+    return true;
 }
 
 nrf_802154_sl_ant_div_antenna_t nrf_802154_sl_ant_div_antenna_get(void)
 {
-    return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    return m_is_initialized ? m_antenna : NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
 }
 
 nrf_802154_sl_ant_div_antenna_t nrf_802154_sl_ant_div_last_rx_best_antenna_get(void)
 {
-    return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    return m_last_rx_best_antenna;
 }
 
-bool nrf_802154_sl_ant_div_rx_frame_started_notify(void)
+void nrf_802154_sl_ant_div_timer_irq_handle(void)
 {
-    return false;
+    // Intentionally empty: the antenna is not toggled with the timer.
 }
 
-void nrf_802154_sl_ant_div_rx_frame_received_notify(void)
+void nrf_802154_sl_ant_div_rx_auto_mode_enable_notify(void)
 {
-    // Intenionally empty
+    rx_measurement_reset();
 }
 
-void nrf_802154_sl_ant_div_rx_aborted_notify(void)
+void nrf_802154_sl_ant_div_rx_auto_mode_disable_notify(void)
 {
-    // Intentionally empty
+    rx_measurement_reset();
+    m_last_rx_best_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
 }
 
-void nrf_802154_sl_ant_div_rx_preamble_timeout_notify(void)
+void nrf_802154_sl_ant_div_rx_started_notify(void)
 {
-    // Intentionally empty
+    if (!rx_auto_mode_is_enabled())
+    {
+        return;
+    }
+
+    rx_measurement_reset();
+    antenna_switch(rx_listening_antenna_get());
 }
 
 void nrf_802154_sl_ant_div_rx_preamble_detected_notify(void)
 {
-    // Intentionally empty
+    if (!rx_auto_mode_is_enabled() || m_rssi_measured)
+    {
+        return;
+    }
+
+    nrf_802154_sl_ant_div_antenna_t first  = antenna_is_valid(m_antenna) ?
+                                             m_antenna : NRF_802154_SL_ANT_DIV_ANTENNA_1;
+    nrf_802154_sl_ant_div_antenna_t second = antenna_other_get(first);
+    int8_t                          rssi_first;
+    int8_t                          rssi_second;
+
+    antenna_switch(first);
+    rssi_first = nrf_802154_sl_ant_div_rssi_measure_get();
+
+    if (rssi_first == NRF_802154_SL_ANT_DIV_RSSI_INVALID)
+    {
+        return;
+    }
+
+    antenna_switch(second);
+    rssi_second = nrf_802154_sl_ant_div_rssi_measure_get();
+
+    if (rssi_second == NRF_802154_SL_ANT_DIV_RSSI_INVALID)
+    {
+        antenna_switch(first);
+        return;
+    }
+
+    m_rssi_diff = (first == NRF_802154_SL_ANT_DIV_ANTENNA_1) ?
+                  (int8_t)(rssi_second - rssi_first) : (int8_t)(rssi_first - rssi_second);
+
+    // Stay on the antenna used for listening unless the other one is strictly better.
+    m_rx_best_antenna = (rssi_second > rssi_first) ? second : first;
+    m_rssi_measured   = true;
+
+    antenna_switch(m_rx_best_antenna);
+}
+
+bool nrf_802154_sl_ant_div_rx_frame_started_notify(void)
+{
+    return rx_auto_mode_is_enabled() && m_rssi_measured;
+}
+
+void nrf_802154_sl_ant_div_rx_frame_received_notify(void)
+{
+    if (!rx_auto_mode_is_enabled())
+    {
+        m_last_rx_best_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+        return;
+    }
+
+    m_last_rx_best_antenna = m_rx_best_antenna;
+
+#if NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+    m_last_rx_rssi_measured = m_rssi_measured;
+    m_last_rx_rssi_diff     = m_rssi_diff;
+#endif
+
+    rx_measurement_reset();
+}
+
+void nrf_802154_sl_ant_div_rx_aborted_notify(void)
+{
+    rx_measurement_reset();
+}
+
+void nrf_802154_sl_ant_div_rx_preamble_timeout_notify(void)
+{
+    // Frame start was not detected. Measure again when the next preamble is detected.
+    rx_measurement_reset();
 }
 
 void nrf_802154_sl_ant_div_energy_detection_requested_notify(uint32_t * p_ed_time)
 {
-    (void)p_ed_time;
+    if (!rx_auto_mode_is_enabled())
+    {
+        return;
+    }
+
+    if (m_ed_second_pending)
+    {
+        m_ed_second_pending = false;
+        *p_ed_time          = m_ed_second_time;
+    }
+    else if (m_ed_pass == 0)
+    {
+        m_ed_pass        = 1;
+        m_ed_second_time = *p_ed_time / 2;
+        *p_ed_time      -= m_ed_second_time;
+    }
+    else
+    {
+        // Energy detection is resumed in a new timeslot on the same antenna.
+    }
+
+    antenna_switch((m_ed_pass == 1) ? NRF_802154_SL_ANT_DIV_ANTENNA_1 :
+                   NRF_802154_SL_ANT_DIV_ANTENNA_2);
 }
 
 void nrf_802154_sl_ant_div_energy_detection_aborted_notify(void)
 {
-    // Intentionally empty
+    m_ed_pass           = 0;
+    m_ed_second_pending = false;
 }
 
 bool nrf_802154_sl_ant_div_energy_detection_finished_notify(void)
 {
+    if ((m_ed_pass == 1) && rx_auto_mode_is_enabled() && (m_ed_second_time != 0U))
+    {
+        m_ed_pass           = 2;
+        m_ed_second_pending = true;
+
+        return true;
+    }
+
+    m_ed_pass           = 0;
+    m_ed_second_pending = false;
+
     return false;
 }
 
-void nrf_802154_sl_ant_div_rx_started_notify(void)
+void nrf_802154_sl_ant_div_txack_notify(void)
 {
-    // Intentionally empty
+    // Intentionally empty: the ACK is sent with the antenna selected for the received frame.
 }
 
-void nrf_802154_sl_ant_div_txack_notify(void)
+#if NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+
+void nrf_802154_sl_ant_div_rx_frame_source_notify(const uint8_t * p_src_addr, bool extended)
+{
+    uint8_t              addr_size = extended ? ANT_DIV_ADDR_SIZE_MAX : ANT_DIV_ADDR_SIZE_SHORT;
+    ant_div_neighbor_t * p_neighbor;
+
+    if (!m_last_rx_rssi_measured || (p_src_addr == NULL))
+    {
+        return;
+    }
+
+    m_last_rx_rssi_measured = false;
+
+    p_neighbor = neighbor_find(p_src_addr, addr_size);
+
+    if (p_neighbor == NULL)
+    {
+        p_neighbor            = neighbor_add(p_src_addr, addr_size);
+        p_neighbor->rssi_diff = m_last_rx_rssi_diff;
+    }
+    else
+    {
+        int16_t sum = (int16_t)p_neighbor->rssi_diff * (ANT_DIV_RSSI_DIFF_WEIGHT - 1) +
+                      m_last_rx_rssi_diff;
+
+        p_neighbor->rssi_diff = (int8_t)(sum / ANT_DIV_RSSI_DIFF_WEIGHT);
+    }
+}
+
+void nrf_802154_sl_ant_div_tx_frame_destination_notify(const uint8_t * p_dst_addr, bool extended)
 {
-    // Intentionally empty
+    uint8_t              addr_size  = extended ? ANT_DIV_ADDR_SIZE_MAX : ANT_DIV_ADDR_SIZE_SHORT;
+    ant_div_neighbor_t * p_neighbor = NULL;
+
+    if ((p_dst_addr != NULL) && !addr_is_broadcast(p_dst_addr, addr_size))
+    {
+        p_neighbor = neighbor_find(p_dst_addr, addr_size);
+    }
+
+    if (p_neighbor != NULL)
+    {
+        m_tx_antenna = antenna_from_rssi_diff(p_neighbor->rssi_diff);
+    }
+    else if (antenna_is_valid(m_last_rx_best_antenna))
+    {
+        m_tx_antenna = m_last_rx_best_antenna;
+    }
+    else
+    {
+        m_tx_antenna = m_cfg_antenna[NRF_802154_SL_ANT_DIV_OP_TX];
+    }
 }
 
+#endif // NRF_802154_SL_ANT_DIV_NEIGHBOR_TABLE_SIZE
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2017 - 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the timer scheduler and the timer coordinator on top of the LP and HP
+ *   timer abstractions.
+ *
+ * This implementation is used instead of the kernel-based one when the driver runs on a host
+ * against the simulated LP and HP timers. It supports any number of concurrently running timers
+ * kept in a list sorted by their expiration time.
+ *
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform/nrf_802154_hp_timer.h"
+#include "platform/nrf_802154_lp_timer.h"
+#include "timer/nrf_802154_timer_coord.h"
+#include "timer/nrf_802154_timer_sched.h"
+
+static nrf_802154_timer_t * mp_head;      ///< Running timer that expires first.
+static uint32_t             m_hp_base;    ///< LP timer time at which the HP timer was started.
+static bool                 m_hp_running; ///< Information if the HP timer is synchronized.
+
+/** @brief Get expiration time of the given timer. */
+static inline uint32_t timer_target_get(const nrf_802154_timer_t * p_timer)
+{
+    return p_timer->t0 + p_timer->dt;
+}
+
+/** @brief Check if timer @p p_a expires before timer @p p_b. */
+static inline bool timer_expires_before(const nrf_802154_timer_t * p_a,
+                                        const nrf_802154_timer_t * p_b)
+{
+    return (int32_t)(timer_target_get(p_a) - timer_target_get(p_b)) < 0;
+}
+
+/** @brief Start the LP timer for the first timer in the list or stop it if the list is empty. */
+static void lp_timer_update(void)
+{
+    if (mp_head != NULL)
+    {
+        nrf_802154_lp_timer_start(mp_head->t0, mp_head->dt);
+    }
+    else
+    {
+        nrf_802154_lp_timer_stop();
+    }
+}
+
+/** @brief Remove the given timer from the list.
+ *
+ * @retval  true   The timer was found in the list and removed.
+ * @retval  false  The timer was not in the list.
+ */
+static bool timer_unlink(nrf_802154_timer_t * p_timer)
+{
+    for (nrf_802154_timer_t ** pp_item = &mp_head; *pp_item != NULL; pp_item = &(*pp_item)->p_next)
+    {
+        if (*pp_item == p_timer)
+        {
+            *pp_item        = p_timer->p_next;
+            p_timer->p_next = NULL;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void nrf_802154_timer_coord_init(void)
+{
+    m_hp_running = false;
+}
+
+void nrf_802154_timer_coord_uninit(void)
+{
+    m_hp_running = false;
+}
+
+void nrf_802154_timer_coord_start(void)
+{
+    // Both simulated timers count the same clock, so the synchronization is exact.
+    nrf_802154_hp_timer_start();
+    m_hp_base    = nrf_802154_lp_timer_time_get();
+    m_hp_running = true;
+}
+
+void nrf_802154_timer_coord_stop(void)
+{
+    nrf_802154_hp_timer_stop();
+    m_hp_running = false;
+}
+
+void nrf_802154_timer_coord_timestamp_prepare(uint32_t event_addr)
+{
+    (void)event_addr;
+}
+
+bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
+{
+    assert(p_timestamp != NULL);
+
+    if (!m_hp_running)
+    {
+        return false;
+    }
+
+    *p_timestamp = m_hp_base + nrf_802154_hp_timer_timestamp_get();
+
+    return true;
+}
+
+void nrf_802154_timer_sched_init(void)
+{
+    mp_head = NULL;
+}
+
+void nrf_802154_timer_sched_deinit(void)
+{
+    mp_head = NULL;
+    nrf_802154_lp_timer_stop();
+}
+
+uint32_t nrf_802154_timer_sched_time_get(void)
+{
+    return nrf_802154_lp_timer_time_get();
+}
+
+uint32_t nrf_802154_timer_sched_granularity_get(void)
+{
+    return nrf_802154_lp_timer_granularity_get();
+}
+
+bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_t dt)
+{
+    return (int32_t)(t0 + dt - now) > 0;
+}
+
+uint32_t nrf_802154_timer_sched_remaining_time_get(const nrf_802154_timer_t * p_timer)
+{
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    if (!nrf_802154_timer_sched_time_is_in_future(now, p_timer->t0, p_timer->dt))
+    {
+        return 0;
+    }
+
+    return timer_target_get(p_timer) - now;
+}
+
+void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
+{
+    nrf_802154_timer_t ** pp_item;
+
+    (void)round_up;
+    assert(p_timer->callback != NULL);
+
+    nrf_802154_lp_timer_critical_section_enter();
+
+    (void)timer_unlink(p_timer);
+
+    for (pp_item = &mp_head; *pp_item != NULL; pp_item = &(*pp_item)->p_next)
+    {
+        if (timer_expires_before(p_timer, *pp_item))
+        {
+            break;
+        }
+    }
+
+    p_timer->p_next = *pp_item;
+    *pp_item        = p_timer;
+
+    if (mp_head == p_timer)
+    {
+        lp_timer_update();
+    }
+
+    nrf_802154_lp_timer_critical_section_exit();
+}
+
+void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
+{
+    bool was_running;
+    bool was_head;
+
+    nrf_802154_lp_timer_critical_section_enter();
+
+    was_head    = (mp_head == p_timer);
+    was_running = timer_unlink(p_timer);
+
+    if (was_head)
+    {
+        lp_timer_update();
+    }
+
+    nrf_802154_lp_timer_critical_section_exit();
+
+    if (p_was_running != NULL)
+    {
+        *p_was_running = was_running;
+    }
+}
+
+bool nrf_802154_timer_sched_is_running(nrf_802154_timer_t * p_timer)
+{
+    for (nrf_802154_timer_t * p_item = mp_head; p_item != NULL; p_item = p_item->p_next)
+    {
+        if (p_item == p_timer)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void nrf_802154_lp_timer_fired(void)
+{
+    while ((mp_head != NULL) &&
+           !nrf_802154_timer_sched_time_is_in_future(nrf_802154_timer_sched_time_get(),
+                                                     mp_head->t0,
+                                                     mp_head->dt))
+    {
+        nrf_802154_timer_t * p_timer = mp_head;
+
+        mp_head         = p_timer->p_next;
+        p_timer->p_next = NULL;
+
+        // The callback may add or remove timers, so the list is consistent before the call.
+        p_timer->callback(p_timer->p_context);
+    }
+
+    lp_timer_update();
+}
+
+void nrf_802154_lp_timer_synchronized(void)
+{
+    // Intentionally empty: the simulated timers are synchronized by design.
+}
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file test_random_xoshiro.c
+ * @brief Tests and benchmark of the xoshiro128** random backend.
+ *
+ * The RNG peripheral is emulated by stubs/nrf.h and returns a byte set by the test, so the state
+ * of the generator is known and its output can be compared with a reference implementation.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES_GET() __rdtsc()
+#endif
+
+#include "nrf.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_random.h"
+
+#include "nrf_802154_test.h"
+
+#define STATE_WORDS   4
+#define POOL_SIZE     (STATE_WORDS * sizeof(uint32_t))
+#define STAT_NUMBERS  (1UL << 20)
+#define BENCH_NUMBERS 10000000UL
+#define BOUND         7
+#define BOUND_LARGE   0xC0000000UL
+
+/* Upper limits of the chi-squared statistics, for the significance level of 0.001. */
+#define CHI2_LIMIT_DF2   13.82
+#define CHI2_LIMIT_DF6   22.46
+#define CHI2_LIMIT_DF255 310.46
+
+static NRF_RNG_Type m_rng;       ///< Emulated RNG registers.
+static uint8_t      m_rng_value; ///< Value returned by the emulated RNG.
+
+/// Initial state of the generator, the same as in nrf_802154_random_xoshiro.c.
+static const uint32_t m_initial_state[STATE_WORDS] =
+{
+    0x6457827dUL, 0xe220a839UL, 0x3ab7b1ffUL, 0x910a2decUL,
+};
+
+NRF_RNG_Type * test_rng_regs_get(void)
+{
+    m_rng.EVENTS_VALRDY = 1;
+    m_rng.VALUE         = m_rng_value;
+
+    return &m_rng;
+}
+
+static uint32_t ref_rotl(uint32_t value, uint32_t shift)
+{
+    return (value << shift) | (value >> (32U - shift));
+}
+
+/**
+ * @brief Reference xoshiro128** from the authors' public domain implementation.
+ */
+static uint32_t ref_next(uint32_t * p_state)
+{
+    const uint32_t result = ref_rotl(p_state[1] * 5, 7) * 9;
+    const uint32_t t      = p_state[1] << 9;
+
+    p_state[2] ^= p_state[0];
+    p_state[3] ^= p_state[1];
+    p_state[1] ^= p_state[2];
+    p_state[0] ^= p_state[3];
+    p_state[2] ^= t;
+    p_state[3]  = ref_rotl(p_state[3], 11);
+
+    return result;
+}
+
+/**
+ * @brief Mixes entropy made of @p value bytes into the reference state.
+ */
+static void ref_mix(uint32_t * p_state, uint8_t value)
+{
+    for (uint32_t i = 0; i < STATE_WORDS; i++)
+    {
+        p_state[i] ^= value * 0x01010101UL;
+    }
+}
+
+static void random_init(uint8_t entropy, uint32_t * p_ref_state)
+{
+    m_rng_value = entropy;
+    nrf_802154_random_init();
+
+    memcpy(p_ref_state, m_initial_state, sizeof(m_initial_state));
+    ref_mix(p_ref_state, entropy);
+}
+
+static void test_matches_reference(void)
+{
+    uint32_t state[STATE_WORDS];
+
+    random_init(0xA5, state);
+
+    for (uint32_t i = 0; i < NRF_802154_RANDOM_RESEED_INTERVAL; i++)
+    {
+        TEST_ASSERT(nrf_802154_random_get() == ref_next(state));
+    }
+
+    nrf_802154_random_deinit();
+}
+
+static void test_seeded_at_init(void)
+{
+    uint32_t first;
+
+    m_rng_value = 0x00;
+    nrf_802154_random_init();
+    first = nrf_802154_random_get();
+    nrf_802154_random_deinit();
+
+    m_rng_value = 0x01;
+    nrf_802154_random_init();
+    TEST_ASSERT(nrf_802154_random_get() != first);
+    nrf_802154_random_deinit();
+}
+
+static void test_reseed(void)
+{
+    uint32_t state[STATE_WORDS];
+
+    random_init(0x00, state);
+
+    for (uint32_t i = 0; i < NRF_802154_RANDOM_RESEED_INTERVAL; i++)
+    {
+        TEST_ASSERT(nrf_802154_random_get() == ref_next(state));
+    }
+
+    // Collection of entropy has been started in the background.
+    TEST_ASSERT(m_rng.INTENSET == RNG_INTENSET_VALRDY_Msk);
+    TEST_ASSERT(m_rng.TASKS_START == 1);
+    m_rng.INTENCLR = 0;
+
+    // Numbers are generated without waiting for the entropy.
+    m_rng_value = 0x3C;
+
+    for (uint32_t i = 0; i < POOL_SIZE; i++)
+    {
+        TEST_ASSERT(nrf_802154_random_get() == ref_next(state));
+        nrf_802154_random_irq_handler();
+    }
+
+    TEST_ASSERT(m_rng.INTENCLR == RNG_INTENCLR_VALRDY_Msk);
+
+    // Interrupts after the pool is full do not change the entropy.
+    m_rng_value = 0xFF;
+    nrf_802154_random_irq_handler();
+
+    ref_mix(state, 0x3C);
+
+    for (uint32_t i = 0; i < NRF_802154_RANDOM_RESEED_INTERVAL; i++)
+    {
+        TEST_ASSERT(nrf_802154_random_get() == ref_next(state));
+    }
+
+    nrf_802154_random_deinit();
+}
+
+static double chi2_get(const uint32_t * p_counts, uint32_t bins, uint32_t total)
+{
+    double expected = (double)total / bins;
+    double chi2     = 0.0;
+
+    for (uint32_t i = 0; i < bins; i++)
+    {
+        double diff = (double)p_counts[i] - expected;
+
+        chi2 += diff * diff / expected;
+    }
+
+    return chi2;
+}
+
+static void test_statistics(void)
+{
+    static uint32_t bytes[256];
+    static uint32_t pairs[256];
+    uint64_t        ones     = 0;
+    uint32_t        previous = 0;
+    double          bits     = 32.0 * STAT_NUMBERS;
+    double          chi2_bytes;
+    double          chi2_pairs;
+    uint32_t        state[STATE_WORDS];
+
+    random_init(0x5A, state);
+
+    for (uint32_t i = 0; i < STAT_NUMBERS; i++)
+    {
+        uint32_t value = nrf_802154_random_get();
+
+        ones += (uint64_t)__builtin_popcount(value);
+
+        for (uint32_t j = 0; j < 4; j++)
+        {
+            bytes[(value >> (8 * j)) & 0xFF]++;
+        }
+
+        // Upper nibbles of consecutive numbers.
+        pairs[((previous >> 24) & 0xF0) | (value >> 28)]++;
+        previous = value;
+    }
+
+    nrf_802154_random_deinit();
+
+    chi2_bytes = chi2_get(bytes, 256, 4 * STAT_NUMBERS);
+    chi2_pairs = chi2_get(pairs, 256, STAT_NUMBERS);
+
+    printf("\tones %.5f, bytes chi2 %.1f, pairs chi2 %.1f\n",
+           (double)ones / bits,
+           chi2_bytes,
+           chi2_pairs);
+
+    // Monobit test: within 4 standard deviations of the expected count.
+    TEST_ASSERT((double)ones > bits / 2 - 2 * sqrt(bits));
+    TEST_ASSERT((double)ones < bits / 2 + 2 * sqrt(bits));
+    TEST_ASSERT(chi2_bytes < CHI2_LIMIT_DF255);
+    TEST_ASSERT(chi2_pairs < CHI2_LIMIT_DF255);
+}
+
+static void test_bounded(void)
+{
+    uint32_t counts[BOUND] = {0};
+    uint32_t residues[3]   = {0};
+    uint32_t state[STATE_WORDS];
+    double   chi2;
+    double   chi2_large;
+
+    random_init(0x5A, state);
+
+    for (uint32_t i = 0; i < STAT_NUMBERS; i++)
+    {
+        uint32_t value = nrf_802154_random_bounded_get(BOUND);
+
+        TEST_ASSERT(value < BOUND);
+        counts[value]++;
+    }
+
+    // Without the rejection of biased products, multiples of 3 would be twice as likely as other
+    // numbers lower than this bound.
+    for (uint32_t i = 0; i < STAT_NUMBERS; i++)
+    {
+        uint32_t value = nrf_802154_random_bounded_get(BOUND_LARGE);
+
+        TEST_ASSERT(value < BOUND_LARGE);
+        residues[value % 3]++;
+    }
+
+    TEST_ASSERT(nrf_802154_random_bounded_get(1) == 0);
+
+    nrf_802154_random_deinit();
+
+    chi2       = chi2_get(counts, BOUND, STAT_NUMBERS);
+    chi2_large = chi2_get(residues, 3, STAT_NUMBERS);
+
+    printf("\tbound %u chi2 %.1f, bound 0x%lx residues chi2 %.1f\n",
+           BOUND,
+           chi2,
+           BOUND_LARGE,
+           chi2_large);
+
+    TEST_ASSERT(chi2 < CHI2_LIMIT_DF6);
+    TEST_ASSERT(chi2_large < CHI2_LIMIT_DF2);
+}
+
+static void bench_get(void)
+{
+    volatile uint32_t sink = 0;
+    uint32_t          state[STATE_WORDS];
+    uint64_t          start;
+    uint64_t          get_ns;
+    uint64_t          bounded_ns;
+#ifdef CYCLES_GET
+    uint64_t          cycles;
+#endif
+
+    random_init(0x5A, state);
+
+#ifdef CYCLES_GET
+    cycles = CYCLES_GET();
+
+    for (uint32_t i = 0; i < BENCH_NUMBERS; i++)
+    {
+        sink += nrf_802154_random_get();
+    }
+
+    cycles = CYCLES_GET() - cycles;
+
+    printf("	get %.2f TSC cycles per number\n", (double)cycles / BENCH_NUMBERS);
+#endif
+
+    start = test_time_ns();
+
+    for (uint32_t i = 0; i < BENCH_NUMBERS; i++)
+    {
+        sink += nrf_802154_random_get();
+    }
+
+    get_ns = test_time_ns() - start;
+    start  = test_time_ns();
+
+    for (uint32_t i = 0; i < BENCH_NUMBERS; i++)
+    {
+        sink += nrf_802154_random_bounded_get(BOUND);
+    }
+
+    bounded_ns = test_time_ns() - start;
+
+    nrf_802154_random_deinit();
+
+    printf("\t%lu numbers: get %.2f ns, bounded get %.2f ns per number\n",
+           BENCH_NUMBERS,
+           (double)get_ns / BENCH_NUMBERS,
+           (double)bounded_ns / BENCH_NUMBERS);
+}
+
+int main(void)
+{
+    TEST_RUN(test_matches_reference);
+    TEST_RUN(test_seeded_at_init);
+    TEST_RUN(test_reseed);
+    TEST_RUN(test_statistics);
+    TEST_RUN(test_bounded);
+    TEST_RUN(bench_get);
+
+    return 0;
+}
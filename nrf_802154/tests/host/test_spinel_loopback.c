@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file test_spinel_loopback.c
+ * @brief Tests of the spinel send path over the loopback backend.
+ *
+ * The test is built with NRF_802154_SER_ZERO_COPY_TX_ENABLED set to 1 and to 0. The decoder is
+ * replaced by a stub that records the received frames.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_backend.h"
+#include "nrf_802154_spinel_backend_loopback.h"
+#include "nrf_802154_spinel_dec.h"
+#include "nrf_802154_spinel_response_notifier.h"
+#include "nrf_802154_serialization_config.h"
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_serialization_error.h"
+
+#include "nrf_802154_test.h"
+
+#define SLOTS           NRF_802154_SPINEL_BACKEND_LOOPBACK_SLOTS
+#define FRAME_FORMAT    SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_DATA_WLEN_S
+#define PAYLOAD_MAX_LEN 200
+#define RESPONSE_SEQ    0xFFFFFFFFUL
+#define BENCH_FRAMES    200000
+#define BENCH_LEN       100
+
+static uint8_t  m_received[SLOTS][NRF_802154_SPINEL_FRAME_BUFFER_SIZE];    ///< Received frames.
+static size_t   m_received_len[SLOTS];                                     ///< Lengths of the received frames.
+static uint32_t m_received_count;                                          ///< Number of received frames.
+static bool     m_respond;                                                 ///< Send a frame from the decoder.
+static bool     m_record = true;                                           ///< Record the received frames.
+
+nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
+                                                  size_t       packet_data_len)
+{
+    uint8_t payload = 0;
+
+    // The frame is recorded after the response is sent, so that it is checked after the send.
+    if (m_respond)
+    {
+        m_respond = false;
+        TEST_ASSERT(nrf_802154_spinel_send(FRAME_FORMAT, RESPONSE_SEQ, &payload, 1) > 0);
+    }
+
+    if (m_record)
+    {
+        TEST_ASSERT(m_received_count < SLOTS);
+        TEST_ASSERT(packet_data_len <= sizeof(m_received[0]));
+
+        memcpy(m_received[m_received_count], p_packet_data, packet_data_len);
+        m_received_len[m_received_count] = packet_data_len;
+    }
+
+    m_received_count++;
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+void nrf_802154_spinel_response_notifier_init(void)
+{
+    // Responses are not awaited by this test.
+}
+
+void nrf_802154_serialization_crit_sect_enter(uint32_t * p_critical_section)
+{
+    // The test is single threaded.
+    *p_critical_section = 0;
+}
+
+void nrf_802154_serialization_crit_sect_exit(uint32_t critical_section)
+{
+    (void)critical_section;
+}
+
+void nrf_802154_serialization_error(const nrf_802154_ser_err_data_t * p_err)
+{
+    fprintf(stderr, "serialization error %d\n", (int)p_err->reason);
+    exit(1);
+}
+
+static size_t payload_len(uint32_t seq)
+{
+    return 1 + (seq * 53) % PAYLOAD_MAX_LEN;
+}
+
+static nrf_802154_ser_err_t frame_send(uint32_t seq)
+{
+    uint8_t payload[PAYLOAD_MAX_LEN];
+    size_t  len = payload_len(seq);
+
+    for (size_t i = 0; i < len; i++)
+    {
+        payload[i] = (uint8_t)(seq + i);
+    }
+
+    return nrf_802154_spinel_send(FRAME_FORMAT, seq, payload, len);
+}
+
+static void frame_check(uint32_t index, uint32_t seq)
+{
+    uint32_t        received_seq;
+    const uint8_t * p_payload;
+    size_t          len = 0; // Spinel stores an unsigned int here.
+    spinel_ssize_t  siz;
+
+    siz = spinel_datatype_unpack(m_received[index],
+                                 m_received_len[index],
+                                 FRAME_FORMAT,
+                                 &received_seq,
+                                 &p_payload,
+                                 &len);
+
+    TEST_ASSERT(siz == (spinel_ssize_t)m_received_len[index]);
+    TEST_ASSERT(received_seq == seq);
+
+    if (seq == RESPONSE_SEQ)
+    {
+        TEST_ASSERT(len == 1);
+        return;
+    }
+
+    TEST_ASSERT(len == payload_len(seq));
+
+    for (size_t i = 0; i < len; i++)
+    {
+        TEST_ASSERT(p_payload[i] == (uint8_t)(seq + i));
+    }
+}
+
+static void setup(void)
+{
+    // nrf_802154_serialization_init is not called, because the buffer managers it initializes
+    // require 32-bit pointers. The send path does not use them.
+    TEST_ASSERT(nrf_802154_backend_init() == NRF_802154_SERIALIZATION_ERROR_OK);
+    nrf_802154_spinel_backend_loopback_stats_reset();
+
+    m_received_count = 0;
+    m_respond        = false;
+    m_record         = true;
+}
+
+static void test_frames_delivered_in_order(void)
+{
+    nrf_802154_spinel_backend_loopback_stats_t stats;
+    uint32_t                                   bytes = 0;
+
+    setup();
+
+    for (uint32_t seq = 0; seq < SLOTS; seq++)
+    {
+        nrf_802154_ser_err_t res = frame_send(seq);
+
+        TEST_ASSERT(res > 0);
+        bytes += (uint32_t)res;
+    }
+
+    TEST_ASSERT(m_received_count == 0);
+    TEST_ASSERT(nrf_802154_spinel_backend_loopback_process() == SLOTS);
+    TEST_ASSERT(m_received_count == SLOTS);
+
+    for (uint32_t seq = 0; seq < SLOTS; seq++)
+    {
+        frame_check(seq, seq);
+    }
+
+    nrf_802154_spinel_backend_loopback_stats_get(&stats);
+    TEST_ASSERT(stats.frames == SLOTS);
+    TEST_ASSERT(stats.bytes == bytes);
+    TEST_ASSERT(stats.copies == (NRF_802154_SER_ZERO_COPY_TX_ENABLED ? 0 : SLOTS));
+    TEST_ASSERT(stats.alloc_failures == 0);
+}
+
+static void test_pool_exhausted(void)
+{
+    nrf_802154_spinel_backend_loopback_stats_t stats;
+
+    setup();
+
+    for (uint32_t seq = 0; seq < SLOTS; seq++)
+    {
+        TEST_ASSERT(frame_send(seq) > 0);
+    }
+
+    TEST_ASSERT(frame_send(SLOTS) == NRF_802154_SERIALIZATION_ERROR_NO_MEMORY);
+
+    nrf_802154_spinel_backend_loopback_stats_get(&stats);
+    TEST_ASSERT(stats.alloc_failures == 1);
+
+    TEST_ASSERT(nrf_802154_spinel_backend_loopback_process() == SLOTS);
+    m_received_count = 0;
+
+    TEST_ASSERT(frame_send(SLOTS) > 0);
+    TEST_ASSERT(nrf_802154_spinel_backend_loopback_process() == 1);
+    frame_check(0, SLOTS);
+}
+
+static void test_encoding_failure_releases_buffer(void)
+{
+    static uint8_t                             too_long[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
+    nrf_802154_spinel_backend_loopback_stats_t stats;
+
+    setup();
+
+    for (uint32_t i = 0; i < SLOTS; i++)
+    {
+        TEST_ASSERT(nrf_802154_spinel_send(FRAME_FORMAT, i, too_long, sizeof(too_long)) ==
+                    NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE);
+    }
+
+    // All buffers must still be available.
+    for (uint32_t seq = 0; seq < SLOTS; seq++)
+    {
+        TEST_ASSERT(frame_send(seq) > 0);
+    }
+
+    nrf_802154_spinel_backend_loopback_stats_get(&stats);
+    TEST_ASSERT(stats.frames == SLOTS);
+    TEST_ASSERT(stats.alloc_failures == 0);
+
+    TEST_ASSERT(nrf_802154_spinel_backend_loopback_process() == SLOTS);
+}
+
+static void test_send_from_receive_handler(void)
+{
+    setup();
+
+    // Only one slot is free when the first frame is decoded. The response must not take the slot
+    // of the frame being decoded.
+    for (uint32_t seq = 0; seq < SLOTS - 1; seq++)
+    {
+        TEST_ASSERT(frame_send(seq) > 0);
+    }
+
+    m_respond = true;
+
+    TEST_ASSERT(nrf_802154_spinel_backend_loopback_process() == SLOTS);
+
+    for (uint32_t seq = 0; seq < SLOTS - 1; seq++)
+    {
+        frame_check(seq, seq);
+    }
+
+    frame_check(SLOTS - 1, RESPONSE_SEQ);
+}
+
+static void bench_send(void)
+{
+    uint8_t  payload[BENCH_LEN] = {0};
+    uint64_t start;
+    uint64_t elapsed;
+
+    setup();
+    m_record = false;
+
+    start = test_time_ns();
+
+    for (uint32_t i = 0; i < BENCH_FRAMES; i++)
+    {
+        TEST_ASSERT(nrf_802154_spinel_send(FRAME_FORMAT, i, payload, sizeof(payload)) > 0);
+        TEST_ASSERT(nrf_802154_spinel_backend_loopback_process() == 1);
+    }
+
+    elapsed = test_time_ns() - start;
+
+    printf("\tzero copy %d: %u frames of %u bytes, %u ns per frame\n",
+           NRF_802154_SER_ZERO_COPY_TX_ENABLED,
+           BENCH_FRAMES,
+           BENCH_LEN,
+           (unsigned)(elapsed / BENCH_FRAMES));
+}
+
+int main(void)
+{
+    TEST_RUN(test_frames_delivered_in_order);
+    TEST_RUN(test_pool_exhausted);
+    TEST_RUN(test_encoding_failure_releases_buffer);
+    TEST_RUN(test_send_from_receive_handler);
+    TEST_RUN(bench_send);
+
+    return 0;
+}
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2021, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @file test_tx_power_ctrl_sim.c
+ * @brief Link-budget simulation of the adaptive transmit power.
+ *
+ * A coordinator exchanges frames with children placed at random distances. The path loss
+ * follows a log-distance model with Gaussian fading drawn independently for every frame.
+ * Children send frames to the coordinator at full power, which feeds the controller, and the
+ * coordinator answers each of them with a frame that is retried until it is acknowledged. The
+ * simulation is run with the controller and with the fixed power, and compares the delivery
+ * and the mean radiated power per frame.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "mac_features/nrf_802154_tx_power_ctrl.h"
+
+#include "nrf_802154_test.h"
+
+#define TX_POWER        8     ///< Transmit power of all devices [dBm].
+#define SENSITIVITY     (-95) ///< Sensitivity of all devices [dBm].
+#define PATH_LOSS_1M    40.0  ///< Path loss at 1 m [dB].
+#define PATH_LOSS_EXP   2.7   ///< Path loss exponent.
+#define FADING_SIGMA    4.0   ///< Standard deviation of the fading [dB].
+#define CHILDREN        20    ///< Number of children of the coordinator.
+#define ROUNDS          500   ///< Number of frames exchanged with each child.
+#define MAX_RETRIES     3     ///< Number of retransmissions of an unacknowledged frame.
+#define DELIVERY_MARGIN 0.005 ///< Allowed decrease of the delivery ratio with the controller.
+
+#define COORD_ADDR      0x0000U ///< Short address of the coordinator.
+#define PAN_ID          0xabcdU ///< PAN ID of the network.
+
+/** Results of a simulation run. */
+typedef struct
+{
+    double delivery; ///< Ratio of frames acknowledged within the allowed retries.
+    double power_mw; ///< Mean radiated power per frame, including retries [mW].
+} sim_result_t;
+
+static uint64_t m_rng_state; ///< State of the generator of the simulation.
+
+/** Gets a uniformly distributed number in the range (0, 1). */
+static double uniform_get(void)
+{
+    // splitmix64, independent from the random backend of the driver.
+    uint64_t z = (m_rng_state += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+
+    return ((double)(z >> 11) + 0.5) / (double)(1ULL << 53);
+}
+
+/** Gets a normally distributed number with the given standard deviation. */
+static double gaussian_get(double sigma)
+{
+    return sigma * sqrt(-2.0 * log(uniform_get())) * cos(2.0 * M_PI * uniform_get());
+}
+
+/** Gets the RSSI of a frame sent with the given power over the given distance. */
+static int8_t rssi_get(double tx_power, double distance)
+{
+    double rssi = tx_power - PATH_LOSS_1M - 10.0 * PATH_LOSS_EXP * log10(distance) +
+                  gaussian_get(FADING_SIGMA);
+
+    return (rssi < INT8_MIN) ? INT8_MIN : (int8_t)lround(rssi);
+}
+
+/** Gets the LQI reported for a frame received with the given RSSI. */
+static uint8_t lqi_get(int8_t rssi)
+{
+    int32_t lqi = ((int32_t)rssi - SENSITIVITY) * 255 / 40;
+
+    return (lqi < 0) ? 0 : (lqi > 255) ? 255 : (uint8_t)lqi;
+}
+
+/** Builds a data frame with short addresses and the PAN ID compression. */
+static void frame_build(uint8_t * p_frame, uint16_t dst, uint16_t src, uint8_t seq)
+{
+    p_frame[0]  = 11;   // PHR: MHR and FCS.
+    p_frame[1]  = 0x61; // Data frame, AR, PAN ID compression.
+    p_frame[2]  = 0x88; // Short destination and source addresses.
+    p_frame[3]  = seq;
+    p_frame[4]  = (uint8_t)PAN_ID;
+    p_frame[5]  = (uint8_t)(PAN_ID >> 8);
+    p_frame[6]  = (uint8_t)dst;
+    p_frame[7]  = (uint8_t)(dst >> 8);
+    p_frame[8]  = (uint8_t)src;
+    p_frame[9]  = (uint8_t)(src >> 8);
+    p_frame[10] = 0;
+    p_frame[11] = 0;
+}
+
+/**
+ * @brief Runs the simulation.
+ *
+ * @param[in]  max_distance  Maximum distance of a child from the coordinator [m].
+ * @param[in]  first_addr    Short address of the first child. Each run uses new addresses, so
+ *                           that it does not inherit the link estimates of the previous ones.
+ * @param[in]  desense       Loss of sensitivity of the children to interference around them [dB].
+ *                           The coordinator cannot see it in the frames it receives from them.
+ * @param[in]  adaptive      Whether the coordinator uses the controller.
+ */
+static sim_result_t sim_run(double   max_distance,
+                            uint16_t first_addr,
+                            double   desense,
+                            bool     adaptive)
+{
+    double   distance[CHILDREN];
+    uint32_t delivered = 0;
+    double   energy    = 0.0;
+    uint8_t  uplink[12];
+    uint8_t  downlink[12];
+
+    // The same seed places the children at the same distances and draws the same fading
+    // sequence up to the first difference in the number of attempts.
+    m_rng_state = 0x802154;
+
+    for (uint32_t i = 0; i < CHILDREN; i++)
+    {
+        distance[i] = 1.0 + (max_distance - 1.0) * uniform_get();
+    }
+
+    for (uint32_t round = 0; round < ROUNDS; round++)
+    {
+        for (uint32_t i = 0; i < CHILDREN; i++)
+        {
+            uint16_t addr = (uint16_t)(first_addr + i);
+            int8_t   rssi = rssi_get(TX_POWER, distance[i]);
+
+            frame_build(uplink, COORD_ADDR, addr, (uint8_t)round);
+            frame_build(downlink, addr, COORD_ADDR, (uint8_t)round);
+
+            if (adaptive && (rssi >= SENSITIVITY))
+            {
+                nrf_802154_tx_power_ctrl_rx_frame_update(uplink, rssi, lqi_get(rssi));
+            }
+
+            for (uint32_t attempt = 0; attempt <= MAX_RETRIES; attempt++)
+            {
+                uint8_t attenuation = adaptive ?
+                                      nrf_802154_tx_power_ctrl_attenuation_get(downlink) : 0;
+                double  power       = TX_POWER - attenuation;
+                int8_t  ack_rssi;
+
+                energy += pow(10.0, power / 10.0);
+
+                if ((rssi_get(power, distance[i]) >= SENSITIVITY + desense) &&
+                    ((ack_rssi = rssi_get(TX_POWER, distance[i])) >= SENSITIVITY))
+                {
+                    if (adaptive)
+                    {
+                        nrf_802154_tx_power_ctrl_ack_update(downlink, ack_rssi, lqi_get(ack_rssi));
+                    }
+
+                    delivered++;
+                    break;
+                }
+
+                if (adaptive)
+                {
+                    nrf_802154_tx_power_ctrl_tx_failed_hook(downlink, NRF_802154_TX_ERROR_NO_ACK);
+                }
+            }
+        }
+    }
+
+    return (sim_result_t){
+        .delivery = (double)delivered / (CHILDREN * ROUNDS),
+        .power_mw = energy / (CHILDREN * ROUNDS),
+    };
+}
+
+/** Compares the adaptive and the fixed power with children up to the given distance. */
+static void sim_compare(double   max_distance,
+                        uint16_t first_addr,
+                        double   desense,
+                        double   min_saving)
+{
+    sim_result_t fixed    = sim_run(max_distance, first_addr, desense, false);
+    sim_result_t adaptive = sim_run(max_distance, first_addr, desense, true);
+
+    printf("  up to %.0f m, desense %.0f dB: delivery %.4f -> %.4f, mean power per frame %.1f -> %.1f mW\n",
+           max_distance, desense, fixed.delivery, adaptive.delivery, fixed.power_mw, adaptive.power_mw);
+
+    TEST_ASSERT(adaptive.delivery >= fixed.delivery - DELIVERY_MARGIN);
+    TEST_ASSERT(adaptive.power_mw <= fixed.power_mw * (1.0 - min_saving));
+}
+
+/** Children close to the coordinator are reached with a fraction of the power. */
+static void test_sim_short_range(void)
+{
+    sim_compare(60.0, 0x0100, 0.0, 0.5);
+}
+
+/** Children near the range limit keep most of the power and are still reached. */
+static void test_sim_long_range(void)
+{
+    sim_compare(150.0, 0x0200, 0.0, 0.0);
+}
+
+/**
+ * Children that hear worse than they are heard make the controller overestimate their margin,
+ * here by more than @ref NRF_802154_TX_POWER_CTRL_MARGIN.
+ * Only the power increase after missing ACKs keeps them reachable.
+ */
+static void test_sim_asymmetric(void)
+{
+    sim_compare(60.0, 0x0300, 16.0, 0.0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_sim_short_range);
+    TEST_RUN(test_sim_long_range);
+    TEST_RUN(test_sim_asymmetric);
+
+    return 0;
+}
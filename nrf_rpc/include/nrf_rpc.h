@@ -31,6 +31,20 @@ extern "C" {
 /** @brief Special value to indicate that ID is unknown or irrelevant. */
 #define NRF_RPC_ID_UNKNOWN 0xFF
 
+/** @brief Number of priority lanes.
+ *
+ * Commands and events of each group are dispatched in the lane selected by
+ * the group priority. Lane 0 has the highest priority.
+ */
+#ifdef CONFIG_NRF_RPC_PRIO_LANES
+#define NRF_RPC_PRIO_LANES CONFIG_NRF_RPC_PRIO_LANES
+#else
+#define NRF_RPC_PRIO_LANES 1
+#endif
+
+/** @brief Priority of the groups defined with @ref NRF_RPC_GROUP_DEFINE. */
+#define NRF_RPC_PRIO_DEFAULT 0
+
 /* Forward declaration. */
 struct nrf_rpc_err_report;
 
@@ -39,12 +53,13 @@ struct nrf_rpc_err_report;
  * Used by @ref nrf_rpc_err_report to indicate which packet caused the problem.
  */
 enum nrf_rpc_packet_type {
-	NRF_RPC_PACKET_TYPE_EVT  = 0x00, /**< @brief Event */
-	NRF_RPC_PACKET_TYPE_RSP  = 0x01, /**< @brief Response */
-	NRF_RPC_PACKET_TYPE_ACK  = 0x02, /**< @brief Event acknowledge */
-	NRF_RPC_PACKET_TYPE_ERR  = 0x03, /**< @brief Error report from remote */
-	NRF_RPC_PACKET_TYPE_INIT = 0x04, /**< @brief Initialization packet */
-	NRF_RPC_PACKET_TYPE_CMD  = 0x80, /**< @brief Command */
+	NRF_RPC_PACKET_TYPE_EVT   = 0x00, /**< @brief Event */
+	NRF_RPC_PACKET_TYPE_RSP   = 0x01, /**< @brief Response */
+	NRF_RPC_PACKET_TYPE_ACK   = 0x02, /**< @brief Event acknowledge */
+	NRF_RPC_PACKET_TYPE_ERR   = 0x03, /**< @brief Error report from remote */
+	NRF_RPC_PACKET_TYPE_INIT  = 0x04, /**< @brief Initialization packet */
+	NRF_RPC_PACKET_TYPE_BATCH = 0x05, /**< @brief Several packets */
+	NRF_RPC_PACKET_TYPE_CMD   = 0x80, /**< @brief Command */
 };
 
 /** @brief Error source.
@@ -113,6 +128,38 @@ struct nrf_rpc_group {
 	void *ack_handler_data;
 	const char *strid;
 	nrf_rpc_err_handler_t err_handler;
+	uint8_t priority;
+};
+
+/** @brief Statistics of a priority lane.
+ *
+ * Queueing delay is the time between receiving a command or an event and
+ * starting its execution in the thread pool.
+ */
+struct nrf_rpc_lane_stats {
+
+	/** @brief Number of packets dispatched in the lane. */
+	uint32_t count;
+
+	/** @brief Maximum number of packets waiting in the lane. */
+	uint32_t max_depth;
+
+	/** @brief Sum of queueing delays in microseconds. */
+	uint64_t delay_total_us;
+
+	/** @brief Maximum queueing delay in microseconds. */
+	uint32_t delay_max_us;
+};
+
+/** @brief Handle of a command sent with @ref nrf_rpc_cmd_async.
+ *
+ * Fields of this structure are used internally by nRF RPC and not intended to
+ * be used by the user.
+ */
+struct nrf_rpc_future {
+	const struct nrf_rpc_group *group;
+	uint8_t ctx_id;
+	uint8_t cmd;
 };
 
 /** @brief Error report.
@@ -153,6 +200,32 @@ struct nrf_rpc_err_report {
  */
 #define NRF_RPC_GROUP_DEFINE(_name, _strid, _ack_handler, _ack_data,	       \
 			     _err_handler)				       \
+	NRF_RPC_GROUP_DEFINE_PRIO(_name, _strid, NRF_RPC_PRIO_DEFAULT,	       \
+				  _ack_handler, _ack_data, _err_handler)
+
+/** @brief Define a group of commands and events with a priority.
+ *
+ * Commands and events received in the group are dispatched to the thread pool
+ * in the lane selected by `_prio`, so bulk traffic in low priority groups does
+ * not delay latency-sensitive groups. Groups with a priority other than
+ * the highest cannot reserve the last
+ * @option{CONFIG_NRF_RPC_PRIO_RESERVED_REMOTE_THREADS} remote threads.
+ *
+ * Priority values above @ref NRF_RPC_PRIO_LANES - 1 are mapped to the lowest
+ * priority lane.
+ *
+ * @param _name        Symbol name of the group.
+ * @param _strid       String containing unique identifier of the group.
+ * @param _prio        Priority of the group, 0 is the highest.
+ * @param _ack_handler Handler called when ACK was received or NULL.
+ * @param _ack_data    Opaque pointer for the `_ack_handler`.
+ * @param _err_handler Handler called when error occurred in context of this
+ *                     group or NULL.
+ *
+ * @see NRF_RPC_GROUP_DEFINE
+ */
+#define NRF_RPC_GROUP_DEFINE_PRIO(_name, _strid, _prio, _ack_handler,	       \
+				  _ack_data, _err_handler)		       \
 	NRF_RPC_AUTO_ARR(NRF_RPC_CONCAT(_name, _cmd_array),		       \
 			 "cmd_" NRF_RPC_STRINGIFY(_name));		       \
 	NRF_RPC_AUTO_ARR(NRF_RPC_CONCAT(_name, _evt_array),		       \
@@ -167,6 +240,7 @@ struct nrf_rpc_err_report {
 		.ack_handler_data = _ack_data,				       \
 		.strid = _strid,					       \
 		.err_handler = _err_handler,				       \
+		.priority = _prio,					       \
 	}
 
 /** @brief Extern declaration of a group.
@@ -335,6 +409,47 @@ static inline void nrf_rpc_cmd_rsp_no_err(const struct nrf_rpc_group *group,
 					  const uint8_t **rsp_packet,
 					  size_t *rsp_len);
 
+/** @brief Send a command without waiting for the response.
+ *
+ * Each command sent with this function uses its own command context, so
+ * a thread can have many commands in progress. The context is released by
+ * @ref nrf_rpc_future_wait, which must be called for every command sent
+ * successfully. If there is no free context, this function waits for it, so
+ * the number of futures that are not waited yet must be lower than
+ * @option{CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE}.
+ *
+ * The response is passed to `handler`. Depending on the transport, it is
+ * called from the thread that waits for the future or from the transport
+ * receive thread as soon as the response arrives, so it must not block.
+ * Commands that the remote side sends back in context of this command are
+ * executed by the thread that waits for the future.
+ *
+ * @param      group        Group that command belongs to.
+ * @param      cmd          Command id.
+ * @param      packet       Packet allocated by @ref NRF_RPC_ALLOC and filled
+ *                          with an encoded data.
+ * @param      len          Length of the packet. Can be smaller than
+ *                          allocated.
+ * @param      handler      Callback that handles the response.
+ * @param      handler_data Opaque pointer that will be passed to `handler`.
+ * @param[out] future       Handle of the command.
+ *
+ * @return 0 on success or negative error code if a transport layer reported
+ *         a sending error. The future must not be waited on error.
+ */
+int nrf_rpc_cmd_async(const struct nrf_rpc_group *group, uint8_t cmd,
+		      uint8_t *packet, size_t len, nrf_rpc_handler_t handler,
+		      void *handler_data, struct nrf_rpc_future *future);
+
+/** @brief Wait for completion of a command sent with @ref nrf_rpc_cmd_async.
+ *
+ * Returns after the response handler of the command has completed. Futures
+ * can be waited in any order.
+ *
+ * @param future Handle of the command.
+ */
+void nrf_rpc_future_wait(struct nrf_rpc_future *future);
+
 /** @brief Send an event.
  *
  * @param group  Group that event belongs to.
@@ -415,6 +530,22 @@ void nrf_rpc_err(int code, enum nrf_rpc_err_src src,
 		 const struct nrf_rpc_group *group, uint8_t id,
 		 uint8_t packet_type);
 
+/** @brief Get queueing statistics of a priority lane.
+ *
+ * Statistics are collected only if @ref NRF_RPC_PRIO_LANES is greater than 1.
+ *
+ * @param      lane  Lane number, 0 is the highest priority.
+ * @param[out] stats Statistics of the lane.
+ *
+ * @return 0 on success, -NRF_EINVAL if the lane does not exist or
+ *         -NRF_EOPNOTSUPP if priority lanes are disabled.
+ */
+int nrf_rpc_lane_stats_get(uint8_t lane, struct nrf_rpc_lane_stats *stats);
+
+/** @brief Reset queueing statistics of all priority lanes.
+ */
+void nrf_rpc_lane_stats_reset(void);
+
 /* Inline definitions. */
 
 static inline int nrf_rpc_cmd(const struct nrf_rpc_group *group, uint8_t cmd,
@@ -17,6 +17,21 @@
 /* A pointer value to pass information that response */
 #define RESPONSE_HANDLED_PTR ((uint8_t *)1)
 
+/* Flag in the initialization packet indicating that the sender can receive
+ * batch packets.
+ */
+#define INIT_FLAG_BATCH 0x01
+
+/* Size of the length field preceding each packet in a batch packet. */
+#define BATCH_LEN_SIZE 2
+
+/* Number of batch packets that may have packets not decoded yet. Each of them
+ * holds at least one packet, which is decoded by a command context or
+ * a thread from the thread pool.
+ */
+#define BATCH_RX_SLOTS (CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE +		       \
+			CONFIG_NRF_RPC_THREAD_POOL_SIZE + 1)
+
 /* Context holding state of the command execution.
  * Context contains data required to receive response to the command and
  * receive recursice commands. When a thread is waiting for a response
@@ -34,6 +49,12 @@ struct nrf_rpc_cmd_ctx {
 	uint8_t use_count;	   /* Context usage counter. It increases
 				    * each time context is reused.
 				    */
+	uint8_t lane;		   /* Priority lane of the remote thread
+				    * reserved for this context.
+				    */
+	bool async;		   /* Context is used by a command sent with
+				    * nrf_rpc_cmd_async.
+				    */
 	nrf_rpc_handler_t handler; /* Response handler provided be the user. */
 	void *handler_data;	   /* Pointer for the response handler. */
 	struct nrf_rpc_os_msg recv_msg;
@@ -70,9 +91,82 @@ static nrf_rpc_err_handler_t global_err_handler;
 /* Array with all defiend groups */
 NRF_RPC_AUTO_ARR(nrf_rpc_groups_array, "grp");
 
+#if defined(CONFIG_NRF_RPC_BATCH)
+
+/* Received batch packet with packets that were not decoded yet. */
+struct batch_rx_slot {
+	const uint8_t *start;
+	const uint8_t *end;
+	uint32_t ref_count;
+};
+
+/* Events used as locks of the batching state. */
+static struct nrf_rpc_os_event batch_tx_lock;
+static struct nrf_rpc_os_event batch_rx_lock;
+
+/* Remote side announced that it can receive batch packets. */
+static bool batch_remote_supported;
+
+/* A thread is sending a packet. Other threads append their packets to
+ * the pending batch packet and the sending thread sends it when done.
+ */
+static bool batch_tx_busy;
+
+/* Pending batch packet without the header. */
+static uint8_t batch_tx_buf[CONFIG_NRF_RPC_BATCH_SIZE -
+			    _NRF_RPC_HEADER_SIZE];
+static size_t batch_tx_len;
+static uint8_t batch_tx_count;
+
+static struct batch_rx_slot batch_rx_slots[BATCH_RX_SLOTS];
+
+#endif /* CONFIG_NRF_RPC_BATCH */
+
 /* ======================== Common utilities ======================== */
 
-static struct nrf_rpc_cmd_ctx *cmd_ctx_alloc(void)
+/* Priority lane of the group. */
+static inline uint8_t group_lane(const struct nrf_rpc_group *group)
+{
+	if (group->priority >= NRF_RPC_PRIO_LANES) {
+		return NRF_RPC_PRIO_LANES - 1;
+	}
+
+	return group->priority;
+}
+
+static inline void remote_reserve(uint8_t lane)
+{
+#if NRF_RPC_PRIO_LANES > 1
+	nrf_rpc_os_remote_reserve_prio(lane);
+#else
+	(void)lane;
+	nrf_rpc_os_remote_reserve();
+#endif
+}
+
+static inline void remote_release(uint8_t lane)
+{
+#if NRF_RPC_PRIO_LANES > 1
+	nrf_rpc_os_remote_release_prio(lane);
+#else
+	(void)lane;
+	nrf_rpc_os_remote_release();
+#endif
+}
+
+static inline void thread_pool_send(const uint8_t *packet, size_t len,
+				    uint8_t lane)
+{
+#if NRF_RPC_PRIO_LANES > 1
+	nrf_rpc_os_thread_pool_send_prio(packet, len, lane);
+#else
+	(void)lane;
+	nrf_rpc_os_thread_pool_send(packet, len);
+#endif
+}
+
+/* Allocate a context without associating it with the current thread. */
+static struct nrf_rpc_cmd_ctx *cmd_ctx_pool_alloc(void)
 {
 	struct nrf_rpc_cmd_ctx *ctx;
 	uint32_t index;
@@ -85,27 +179,37 @@ static struct nrf_rpc_cmd_ctx *cmd_ctx_alloc(void)
 	ctx->handler = NULL;
 	ctx->remote_id = NRF_RPC_ID_UNKNOWN;
 	ctx->use_count = 1;
-
-	nrf_rpc_os_tls_set(ctx);
+	ctx->async = false;
 
 	NRF_RPC_DBG("Command context %d allocated", ctx->id);
 
 	return ctx;
 }
 
+static struct nrf_rpc_cmd_ctx *cmd_ctx_alloc(void)
+{
+	struct nrf_rpc_cmd_ctx *ctx = cmd_ctx_pool_alloc();
+
+	nrf_rpc_os_tls_set(ctx);
+
+	return ctx;
+}
+
 static void cmd_ctx_free(struct nrf_rpc_cmd_ctx *ctx)
 {
 	nrf_rpc_os_tls_set(NULL);
 	nrf_rpc_os_ctx_pool_release(ctx->id);
 }
 
-static struct nrf_rpc_cmd_ctx *cmd_ctx_reserve(void)
+static struct nrf_rpc_cmd_ctx *cmd_ctx_reserve(uint8_t lane)
 {
 	struct nrf_rpc_cmd_ctx *ctx = nrf_rpc_os_tls_get();
 
 	if (ctx == NULL) {
-		nrf_rpc_os_remote_reserve();
-		return cmd_ctx_alloc();
+		remote_reserve(lane);
+		ctx = cmd_ctx_alloc();
+		ctx->lane = lane;
+		return ctx;
 	}
 
 	ctx->use_count++;
@@ -115,10 +219,12 @@ static struct nrf_rpc_cmd_ctx *cmd_ctx_reserve(void)
 
 static void cmd_ctx_release(struct nrf_rpc_cmd_ctx *ctx)
 {
+	uint8_t lane = ctx->lane;
+
 	ctx->use_count--;
 	if (ctx->use_count == 0) {
 		cmd_ctx_free(ctx);
-		nrf_rpc_os_remote_release();
+		remote_release(lane);
 	}
 }
 
@@ -182,6 +288,277 @@ static inline void header_cmd_encode(uint8_t *packet, struct header *hdr)
 	packet[3] = hdr->group_id;
 }
 
+/* ======================== Batching ======================== */
+
+#if defined(CONFIG_NRF_RPC_BATCH)
+
+/* Send the pending batch packet. Must be called with batch_tx_lock taken,
+ * which is released before sending.
+ */
+static int batch_tx_flush(void)
+{
+	struct header hdr;
+	uint8_t *tx_buf;
+	size_t len = batch_tx_len;
+
+	hdr.dst = NRF_RPC_ID_UNKNOWN;
+	hdr.type = NRF_RPC_PACKET_TYPE_BATCH;
+	hdr.id = batch_tx_count;
+	hdr.group_id = NRF_RPC_ID_UNKNOWN;
+
+	nrf_rpc_tr_alloc_tx_buf(&tx_buf, _NRF_RPC_HEADER_SIZE + len);
+
+	header_encode(tx_buf, &hdr);
+	memcpy(&tx_buf[_NRF_RPC_HEADER_SIZE], batch_tx_buf, len);
+
+	NRF_RPC_DBG("Sending batch of %d packets", batch_tx_count);
+
+	batch_tx_len = 0;
+	batch_tx_count = 0;
+
+	nrf_rpc_os_event_set(&batch_tx_lock);
+
+	return nrf_rpc_tr_send(tx_buf, _NRF_RPC_HEADER_SIZE + len);
+}
+
+/* Send packets that were batched while this thread was sending. */
+static void batch_tx_complete(void)
+{
+	int err;
+
+	while (true) {
+		nrf_rpc_os_event_wait(&batch_tx_lock);
+
+		if (batch_tx_count == 0) {
+			batch_tx_busy = false;
+			nrf_rpc_os_event_set(&batch_tx_lock);
+			return;
+		}
+
+		err = batch_tx_flush();
+		if (err < 0) {
+			NRF_RPC_ERR("Batch send error");
+			nrf_rpc_err(err, NRF_RPC_ERR_SRC_SEND, NULL,
+				    NRF_RPC_ID_UNKNOWN,
+				    NRF_RPC_PACKET_TYPE_BATCH);
+		}
+	}
+}
+
+static int batch_send(uint8_t *packet, size_t len)
+{
+	int err;
+
+	nrf_rpc_os_event_wait(&batch_tx_lock);
+
+	if (!batch_remote_supported) {
+		nrf_rpc_os_event_set(&batch_tx_lock);
+		return nrf_rpc_tr_send(packet, len);
+	}
+
+	if (!batch_tx_busy) {
+
+		/* Nothing is being sent, so send the packet without delay.
+		 * Packets sent by other threads meanwhile are batched.
+		 */
+		batch_tx_busy = true;
+		nrf_rpc_os_event_set(&batch_tx_lock);
+
+		err = nrf_rpc_tr_send(packet, len);
+		batch_tx_complete();
+
+		return err;
+	}
+
+	if (len <= CONFIG_NRF_RPC_BATCH_MAX_PACKET_SIZE &&
+	    batch_tx_len + BATCH_LEN_SIZE + len <= sizeof(batch_tx_buf) &&
+	    batch_tx_count < NRF_RPC_ID_UNKNOWN) {
+
+		batch_tx_buf[batch_tx_len] = (uint8_t)len;
+		batch_tx_buf[batch_tx_len + 1] = (uint8_t)(len >> 8);
+		memcpy(&batch_tx_buf[batch_tx_len + BATCH_LEN_SIZE], packet,
+		       len);
+		batch_tx_len += BATCH_LEN_SIZE + len;
+		batch_tx_count++;
+
+		nrf_rpc_os_event_set(&batch_tx_lock);
+
+		nrf_rpc_tr_free_tx_buf(packet);
+
+		return 0;
+	}
+
+	/* The packet is too big to be batched. Packets batched before must be
+	 * sent first to keep the order.
+	 */
+	if (batch_tx_count > 0) {
+		err = batch_tx_flush();
+		if (err < 0) {
+			nrf_rpc_tr_free_tx_buf(packet);
+			return err;
+		}
+	} else {
+		nrf_rpc_os_event_set(&batch_tx_lock);
+	}
+
+	return nrf_rpc_tr_send(packet, len);
+}
+
+/* Free a received packet that may be a part of a batch packet. */
+static void batch_rx_free(const uint8_t *packet)
+{
+	struct batch_rx_slot *slot;
+	const uint8_t *batch = NULL;
+	uint32_t i;
+
+	nrf_rpc_os_event_wait(&batch_rx_lock);
+
+	for (i = 0; i < BATCH_RX_SLOTS; i++) {
+		slot = &batch_rx_slots[i];
+		if (slot->start != NULL && packet >= slot->start &&
+		    packet < slot->end) {
+			slot->ref_count--;
+			if (slot->ref_count == 0) {
+				batch = slot->start;
+				slot->start = NULL;
+			} else {
+				packet = NULL;
+			}
+			break;
+		}
+	}
+
+	nrf_rpc_os_event_set(&batch_rx_lock);
+
+	if (batch != NULL) {
+		nrf_rpc_tr_free_rx_buf(batch);
+	} else if (packet != NULL) {
+		nrf_rpc_tr_free_rx_buf(packet);
+	}
+}
+
+static void receive_handler(const uint8_t *packet, size_t len);
+
+/* Pass each packet from a batch packet to the receive handler. */
+static int batch_receive(const uint8_t *packet, size_t len)
+{
+	struct batch_rx_slot *slot = NULL;
+	const uint8_t *end = &packet[len];
+	const uint8_t *item = &packet[_NRF_RPC_HEADER_SIZE];
+	size_t item_len;
+	uint32_t i;
+	int err = 0;
+
+	if (!NRF_RPC_TR_AUTO_FREE_RX_BUF) {
+		/* Packets are freed in any order, so the batch packet is freed
+		 * after the last of them. One reference is held until all of
+		 * them are passed to the receive handler.
+		 */
+		nrf_rpc_os_event_wait(&batch_rx_lock);
+		for (i = 0; i < BATCH_RX_SLOTS; i++) {
+			if (batch_rx_slots[i].start == NULL) {
+				slot = &batch_rx_slots[i];
+				slot->start = packet;
+				slot->end = end;
+				slot->ref_count = 1;
+				break;
+			}
+		}
+		nrf_rpc_os_event_set(&batch_rx_lock);
+
+		if (slot == NULL) {
+			NRF_RPC_ERR("No free slot for batch packet");
+			nrf_rpc_tr_free_rx_buf(packet);
+			return -NRF_ENOMEM;
+		}
+	}
+
+	while (item < end) {
+		if (end - item < BATCH_LEN_SIZE) {
+			err = -NRF_EBADMSG;
+			break;
+		}
+
+		item_len = item[0] | ((size_t)item[1] << 8);
+		item += BATCH_LEN_SIZE;
+
+		if (item_len > (size_t)(end - item)) {
+			err = -NRF_EBADMSG;
+			break;
+		}
+
+		if (slot != NULL) {
+			nrf_rpc_os_event_wait(&batch_rx_lock);
+			slot->ref_count++;
+			nrf_rpc_os_event_set(&batch_rx_lock);
+		}
+
+		receive_handler(item, item_len);
+		item += item_len;
+	}
+
+	if (slot != NULL) {
+		batch_rx_free(packet);
+	}
+
+	return err;
+}
+
+static void batch_init_received(const uint8_t *packet, size_t len)
+{
+	uint8_t flags = 0;
+
+	if (len >= _NRF_RPC_HEADER_SIZE + sizeof(uint32_t) + 1) {
+		flags = packet[_NRF_RPC_HEADER_SIZE + sizeof(uint32_t)];
+	}
+
+	nrf_rpc_os_event_wait(&batch_tx_lock);
+	batch_remote_supported = (flags & INIT_FLAG_BATCH) != 0;
+	nrf_rpc_os_event_set(&batch_tx_lock);
+}
+
+static int batch_init(void)
+{
+	int err;
+
+	err = nrf_rpc_os_event_init(&batch_tx_lock);
+	if (err < 0) {
+		return err;
+	}
+
+	err = nrf_rpc_os_event_init(&batch_rx_lock);
+	if (err < 0) {
+		return err;
+	}
+
+	nrf_rpc_os_event_set(&batch_tx_lock);
+	nrf_rpc_os_event_set(&batch_rx_lock);
+
+	return 0;
+}
+
+#endif /* CONFIG_NRF_RPC_BATCH */
+
+/* Pass a packet to the transport. */
+static inline int packet_send(uint8_t *packet, size_t len)
+{
+#if defined(CONFIG_NRF_RPC_BATCH)
+	return batch_send(packet, len);
+#else
+	return nrf_rpc_tr_send(packet, len);
+#endif
+}
+
+/* Free a received packet. */
+static inline void packet_free(const uint8_t *packet)
+{
+#if defined(CONFIG_NRF_RPC_BATCH)
+	batch_rx_free(packet);
+#else
+	nrf_rpc_tr_free_rx_buf(packet);
+#endif
+}
+
 /* Function simplifying sending a short packets */
 static int simple_send(uint8_t dst, uint8_t type, uint8_t id, uint8_t group_id,
 			const uint8_t *packet, size_t len)
@@ -202,7 +579,7 @@ static int simple_send(uint8_t dst, uint8_t type, uint8_t id, uint8_t group_id,
 		memcpy(&tx_buf[_NRF_RPC_HEADER_SIZE], packet, len);
 	}
 
-	return nrf_rpc_tr_send(tx_buf, _NRF_RPC_HEADER_SIZE + len);
+	return packet_send(tx_buf, _NRF_RPC_HEADER_SIZE + len);
 }
 
 static inline bool packet_validate(const uint8_t *packet)
@@ -366,7 +743,7 @@ static void receive_handler(const uint8_t *packet, size_t len)
 	}
 
 	NRF_RPC_DBG("Received %d bytes packet from %d to %d, type 0x%02X, "
-		    "cmd/evt/cnt 0x%02X, grp %d (%s)", len, hdr.src, hdr.dst,
+		    "cmd/evt/cnt 0x%02X, grp %d (%s)", (int)len, hdr.src, hdr.dst,
 		    hdr.type, hdr.id, hdr.group_id,
 		    (group != NULL) ? group->strid : "unknown");
 
@@ -392,6 +769,13 @@ static void receive_handler(const uint8_t *packet, size_t len)
 			goto cleanup_and_exit;
 		}
 
+		if (cmd_ctx->async && hdr.type == NRF_RPC_PACKET_TYPE_RSP) {
+			/* The remote thread is free before the future is
+			 * waited, so more commands can be sent meanwhile.
+			 */
+			remote_release(cmd_ctx->lane);
+		}
+
 		if (cmd_ctx->handler != NULL &&
 		    hdr.type == NRF_RPC_PACKET_TYPE_RSP &&
 		    NRF_RPC_TR_AUTO_FREE_RX_BUF) {
@@ -415,14 +799,14 @@ static void receive_handler(const uint8_t *packet, size_t len)
 
 	case NRF_RPC_PACKET_TYPE_EVT:
 		/* or NRF_RPC_PACKET_TYPE_CMD with unknown destination. */
-		nrf_rpc_os_thread_pool_send(packet, len);
+		thread_pool_send(packet, len, group_lane(group));
 		if (NRF_RPC_TR_AUTO_FREE_RX_BUF) {
 			nrf_rpc_os_event_wait(&decode_done_event);
 		}
 		return;
 
 	case NRF_RPC_PACKET_TYPE_ACK:
-		nrf_rpc_os_remote_release();
+		remote_release(group_lane(group));
 		if (group->ack_handler != NULL) {
 			group->ack_handler(hdr.id, group->ack_handler_data);
 		}
@@ -439,6 +823,9 @@ static void receive_handler(const uint8_t *packet, size_t len)
 
 	case NRF_RPC_PACKET_TYPE_INIT:
 		nrf_rpc_os_remote_count(hdr.id);
+#if defined(CONFIG_NRF_RPC_BATCH)
+		batch_init_received(packet, len);
+#endif
 
 		if (len >= _NRF_RPC_HEADER_SIZE + sizeof(uint32_t) &&
 		    (*(uint32_t *)(&packet[_NRF_RPC_HEADER_SIZE]) !=
@@ -455,6 +842,17 @@ static void receive_handler(const uint8_t *packet, size_t len)
 		}
 		break;
 
+#if defined(CONFIG_NRF_RPC_BATCH)
+	case NRF_RPC_PACKET_TYPE_BATCH:
+		err = batch_receive(packet, len);
+		if (err < 0) {
+			NRF_RPC_ERR("Malformed batch packet");
+			nrf_rpc_err(err, NRF_RPC_ERR_SRC_RECV, NULL, hdr.id,
+				    hdr.type);
+		}
+		return;
+#endif
+
 	default:
 		NRF_RPC_ERR("Invalid type of packet received");
 		err = -NRF_EBADMSG;
@@ -463,7 +861,7 @@ static void receive_handler(const uint8_t *packet, size_t len)
 
 cleanup_and_exit:
 	if (!NRF_RPC_TR_AUTO_FREE_RX_BUF) {
-		nrf_rpc_tr_free_rx_buf(packet);
+		packet_free(packet);
 	}
 
 	if (err < 0) {
@@ -480,7 +878,7 @@ void nrf_rpc_decoding_done(const uint8_t *packet)
 		if (NRF_RPC_TR_AUTO_FREE_RX_BUF) {
 			nrf_rpc_os_event_set(&decode_done_event);
 		} else {
-			nrf_rpc_tr_free_rx_buf(full_packet);
+			packet_free(full_packet);
 		}
 	}
 }
@@ -567,7 +965,7 @@ int nrf_rpc_cmd_common(const struct nrf_rpc_group *group, uint32_t cmd,
 		handler_data = ptr2;
 	}
 
-	cmd_ctx = cmd_ctx_reserve();
+	cmd_ctx = cmd_ctx_reserve(group_lane(group));
 
 	hdr.dst = cmd_ctx->remote_id;
 	hdr.src = cmd_ctx->id;
@@ -583,7 +981,7 @@ int nrf_rpc_cmd_common(const struct nrf_rpc_group *group, uint32_t cmd,
 	NRF_RPC_DBG("Sending command 0x%02X from group 0x%02X", cmd,
 		    *group->group_id);
 
-	err = nrf_rpc_tr_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
+	err = packet_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
 
 	if (err >= 0) {
 		wait_for_response(cmd_ctx, rsp_packet, rsp_len);
@@ -612,6 +1010,91 @@ void nrf_rpc_cmd_common_no_err(const struct nrf_rpc_group *group, uint32_t cmd,
 }
 
 
+/* ======================== Asynchronous commands ======================== */
+
+int nrf_rpc_cmd_async(const struct nrf_rpc_group *group, uint8_t cmd,
+		      uint8_t *packet, size_t len, nrf_rpc_handler_t handler,
+		      void *handler_data, struct nrf_rpc_future *future)
+{
+	int err;
+	struct header hdr;
+	uint8_t lane;
+	uint8_t *full_packet = &packet[-_NRF_RPC_HEADER_SIZE];
+	struct nrf_rpc_cmd_ctx *cmd_ctx;
+
+	NRF_RPC_ASSERT(group != NULL);
+	NRF_RPC_ASSERT(cmd != NRF_RPC_ID_UNKNOWN);
+	NRF_RPC_ASSERT(packet_validate(packet));
+	NRF_RPC_ASSERT(handler != NULL);
+	NRF_RPC_ASSERT(future != NULL);
+
+	/* The command is always executed by a new remote thread, because
+	 * the remote thread associated with the current context may be
+	 * needed by other commands before this one completes.
+	 */
+	lane = group_lane(group);
+	remote_reserve(lane);
+	cmd_ctx = cmd_ctx_pool_alloc();
+	cmd_ctx->lane = lane;
+	cmd_ctx->async = true;
+	cmd_ctx->handler = handler;
+	cmd_ctx->handler_data = handler_data;
+
+	hdr.dst = NRF_RPC_ID_UNKNOWN;
+	hdr.src = cmd_ctx->id;
+	hdr.id = cmd;
+	hdr.group_id = *group->group_id;
+	header_cmd_encode(full_packet, &hdr);
+
+	NRF_RPC_DBG("Sending asynchronous command 0x%02X from group 0x%02X "
+		    "in context %d", cmd, *group->group_id, cmd_ctx->id);
+
+	err = packet_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
+
+	if (err < 0) {
+		nrf_rpc_os_ctx_pool_release(cmd_ctx->id);
+		remote_release(lane);
+		return err;
+	}
+
+	future->group = group;
+	future->ctx_id = cmd_ctx->id;
+	future->cmd = cmd;
+
+	return 0;
+}
+
+void nrf_rpc_future_wait(struct nrf_rpc_future *future)
+{
+	struct nrf_rpc_cmd_ctx *cmd_ctx;
+	struct nrf_rpc_cmd_ctx *prev_ctx;
+
+	NRF_RPC_ASSERT(future != NULL);
+
+	cmd_ctx = cmd_ctx_get_by_id(future->ctx_id);
+
+	NRF_RPC_ASSERT(cmd_ctx != NULL);
+
+	NRF_RPC_DBG("Waiting for command 0x%02X from group 0x%02X",
+		    future->cmd, *future->group->group_id);
+
+	/* Associate the context with this thread while waiting, so nested
+	 * commands from the remote side are executed and responded in it.
+	 */
+	prev_ctx = nrf_rpc_os_tls_get();
+	nrf_rpc_os_tls_set(cmd_ctx);
+
+	wait_for_response(cmd_ctx, NULL, NULL);
+
+	/* The remote thread was released when the response arrived. */
+	cmd_ctx->handler = NULL;
+	cmd_ctx_free(cmd_ctx);
+
+	nrf_rpc_os_tls_set(prev_ctx);
+
+	future->ctx_id = NRF_RPC_ID_UNKNOWN;
+}
+
 /* ======================== Event sending ======================== */
 
 int nrf_rpc_evt(const struct nrf_rpc_group *group, uint8_t evt, uint8_t *packet,
@@ -634,12 +1117,12 @@ int nrf_rpc_evt(const struct nrf_rpc_group *group, uint8_t evt, uint8_t *packet,
 	NRF_RPC_DBG("Sending event 0x%02X from group 0x%02X", evt,
 		    *group->group_id);
 
-	nrf_rpc_os_remote_reserve();
+	remote_reserve(group_lane(group));
 
-	err = nrf_rpc_tr_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
+	err = packet_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
 
 	if (err < 0) {
-		nrf_rpc_os_remote_release();
+		remote_release(group_lane(group));
 	}
 
 	return err;
@@ -679,7 +1162,7 @@ int nrf_rpc_rsp(uint8_t *packet, size_t len)
 
 	NRF_RPC_DBG("Sending response");
 
-	err = nrf_rpc_tr_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
+	err = packet_send(full_packet, len + _NRF_RPC_HEADER_SIZE);
 
 	return err;
 }
@@ -706,6 +1189,8 @@ int nrf_rpc_init(nrf_rpc_err_handler_t err_handler)
 	const struct nrf_rpc_group *group;
 	uint8_t group_id = 0;
 	const char *strid_ptr;
+	uint8_t init_data[sizeof(groups_check_sum) + 1];
+	uint8_t init_flags = 0;
 
 	NRF_RPC_DBG("Initializing nRF RPC module");
 
@@ -752,21 +1237,59 @@ int nrf_rpc_init(nrf_rpc_err_handler_t err_handler)
 		}
 	}
 
+#if defined(CONFIG_NRF_RPC_BATCH)
+	err = batch_init();
+	if (err < 0) {
+		return err;
+	}
+
+	init_flags |= INIT_FLAG_BATCH;
+#endif
+
 	err = nrf_rpc_tr_init(receive_handler);
 	if (err < 0) {
 		return err;
 	}
 
+	/* Flags are appended after the checksum. Older versions ignore them. */
+	memcpy(init_data, &groups_check_sum, sizeof(groups_check_sum));
+	init_data[sizeof(groups_check_sum)] = init_flags;
+
 	err = simple_send(NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_INIT,
 			  CONFIG_NRF_RPC_THREAD_POOL_SIZE, NRF_RPC_ID_UNKNOWN,
-			  (uint8_t *)(&groups_check_sum),
-			  sizeof(groups_check_sum));
+			  init_data, sizeof(init_data));
 
 	NRF_RPC_DBG("Done initializing nRF RPC module");
 
 	return err;
 }
 
+int nrf_rpc_lane_stats_get(uint8_t lane, struct nrf_rpc_lane_stats *stats)
+{
+	NRF_RPC_ASSERT(stats != NULL);
+
+#if NRF_RPC_PRIO_LANES > 1
+	if (lane >= NRF_RPC_PRIO_LANES) {
+		return -NRF_EINVAL;
+	}
+
+	nrf_rpc_os_lane_stats_get(lane, stats);
+
+	return 0;
+#else
+	(void)lane;
+
+	return -NRF_EOPNOTSUPP;
+#endif
+}
+
+void nrf_rpc_lane_stats_reset(void)
+{
+#if NRF_RPC_PRIO_LANES > 1
+	nrf_rpc_os_lane_stats_reset();
+#endif
+}
+
 /** Report an error that cannot be reported as a function return value */
 void nrf_rpc_err(int code, enum nrf_rpc_err_src src,
 		 const struct nrf_rpc_group *group, uint8_t id,
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_LOG_H_
+#define NRF_RPC_LOG_H_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @defgroup nrf_rpc_log_posix Logging for the POSIX port of nRF RPC
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief Logging to the standard error stream.
+ *
+ * Messages up to the severity level set by
+ * @option{CONFIG_NRF_RPC_POSIX_LOG_LEVEL} are printed: 0 - none, 1 - ERR,
+ * 2 - WRN, 3 - INF, 4 - DBG.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CONFIG_NRF_RPC_POSIX_LOG_LEVEL
+#define CONFIG_NRF_RPC_POSIX_LOG_LEVEL 1
+#endif
+
+#define _NRF_RPC_POSIX_LOG(_level, _prefix, ...)			       \
+	do {								       \
+		if (CONFIG_NRF_RPC_POSIX_LOG_LEVEL >= (_level)) {	       \
+			fprintf(stderr, "nrf_rpc " _prefix ": " __VA_ARGS__);  \
+			fputc('\n', stderr);				       \
+		}							       \
+	} while (0)
+
+static inline void _nrf_rpc_posix_dump(int level, const void *memory,
+				       size_t length, const char *text)
+{
+	const uint8_t *bytes = memory;
+
+	if (CONFIG_NRF_RPC_POSIX_LOG_LEVEL < level) {
+		return;
+	}
+
+	fprintf(stderr, "nrf_rpc %s:", text);
+	for (size_t i = 0; i < length; i++) {
+		fprintf(stderr, " %02x", bytes[i]);
+	}
+	fputc('\n', stderr);
+}
+
+#define NRF_RPC_ERR(...) _NRF_RPC_POSIX_LOG(1, "ERR", __VA_ARGS__)
+#define NRF_RPC_WRN(...) _NRF_RPC_POSIX_LOG(2, "WRN", __VA_ARGS__)
+#define NRF_RPC_INF(...) _NRF_RPC_POSIX_LOG(3, "INF", __VA_ARGS__)
+#define NRF_RPC_DBG(...) _NRF_RPC_POSIX_LOG(4, "DBG", __VA_ARGS__)
+
+#define NRF_RPC_DUMP_ERR(memory, length, text)				       \
+	_nrf_rpc_posix_dump(1, memory, length, text)
+#define NRF_RPC_DUMP_WRN(memory, length, text)				       \
+	_nrf_rpc_posix_dump(2, memory, length, text)
+#define NRF_RPC_DUMP_INF(memory, length, text)				       \
+	_nrf_rpc_posix_dump(3, memory, length, text)
+#define NRF_RPC_DUMP_DBG(memory, length, text)				       \
+	_nrf_rpc_posix_dump(4, memory, length, text)
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ *@}
+ */
+
+#endif /* NRF_RPC_LOG_H_ */
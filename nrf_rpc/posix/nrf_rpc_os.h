@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_OS_H_
+#define NRF_RPC_OS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+/**
+ * @defgroup nrf_rpc_os_posix POSIX threads port of OS-dependent functionality
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief Implementation of the nRF RPC OS abstraction on top of POSIX threads.
+ *
+ * The port allows running nRF RPC in a Linux process, for example against
+ * a simulated remote core. The API is documented in
+ * template/nrf_rpc_os_tmpl.h.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct nrf_rpc_os_event {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	bool set;
+};
+
+struct nrf_rpc_os_msg {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	const uint8_t *data;
+	size_t len;
+	bool set;
+};
+
+typedef void (*nrf_rpc_os_work_t)(const uint8_t *data, size_t len);
+
+int nrf_rpc_os_init(nrf_rpc_os_work_t callback);
+
+void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len);
+
+void nrf_rpc_os_thread_pool_send_prio(const uint8_t *data, size_t len,
+				      uint8_t lane);
+
+struct nrf_rpc_lane_stats;
+
+void nrf_rpc_os_lane_stats_get(uint8_t lane, struct nrf_rpc_lane_stats *stats);
+
+void nrf_rpc_os_lane_stats_reset(void);
+
+int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event);
+
+void nrf_rpc_os_event_set(struct nrf_rpc_os_event *event);
+
+void nrf_rpc_os_event_wait(struct nrf_rpc_os_event *event);
+
+int nrf_rpc_os_msg_init(struct nrf_rpc_os_msg *msg);
+
+void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
+			size_t len);
+
+void nrf_rpc_os_msg_get(struct nrf_rpc_os_msg *msg, const uint8_t **data,
+			size_t *len);
+
+void *nrf_rpc_os_tls_get(void);
+
+void nrf_rpc_os_tls_set(void *data);
+
+uint32_t nrf_rpc_os_ctx_pool_reserve(void);
+
+void nrf_rpc_os_ctx_pool_release(uint32_t index);
+
+void nrf_rpc_os_remote_count(int count);
+
+void nrf_rpc_os_remote_reserve(void);
+
+void nrf_rpc_os_remote_release(void);
+
+void nrf_rpc_os_remote_reserve_prio(uint8_t lane);
+
+void nrf_rpc_os_remote_release_prio(uint8_t lane);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ *@}
+ */
+
+#endif /* NRF_RPC_OS_H_ */
@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#define NRF_RPC_LOG_MODULE NRF_RPC_OS
+#include <nrf_rpc_log.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_errno.h"
+#include "nrf_rpc.h"
+#include "nrf_rpc_os.h"
+
+#if CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE > 32
+#error CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE must not exceed 32
+#endif
+
+#ifndef CONFIG_NRF_RPC_PRIO_RESERVED_REMOTE_THREADS
+#define CONFIG_NRF_RPC_PRIO_RESERVED_REMOTE_THREADS 1
+#endif
+
+#ifndef CONFIG_NRF_RPC_PRIO_BURST
+#define CONFIG_NRF_RPC_PRIO_BURST 4
+#endif
+
+/* Item waiting in the thread pool queue. */
+struct pool_item {
+	const uint8_t *data;
+	size_t len;
+	uint64_t queued_us;
+};
+
+/* Queue of one priority lane. */
+struct pool_lane {
+	struct pool_item items[CONFIG_NRF_RPC_THREAD_POOL_SIZE];
+	uint32_t head;
+	uint32_t count;
+	/* Number of works taken from higher priority lanes while this lane
+	 * was waiting.
+	 */
+	uint32_t bypassed;
+	/* Number of free items in the queue. */
+	sem_t space_sem;
+	struct nrf_rpc_lane_stats stats;
+};
+
+static nrf_rpc_os_work_t work_callback;
+
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_cond = PTHREAD_COND_INITIALIZER;
+static struct pool_lane pool_lanes[NRF_RPC_PRIO_LANES];
+static uint32_t pool_count;
+
+static pthread_key_t tls_key;
+
+static sem_t ctx_sem;
+static pthread_mutex_t ctx_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t ctx_reserved_mask;
+
+/* Free remote threads, and free remote threads that lanes other than
+ * the highest priority one may reserve.
+ */
+static sem_t remote_sem;
+static sem_t remote_low_sem;
+
+/* Wait on a semaphore, restarting the wait if it was interrupted by a signal.
+ */
+static void sem_take(sem_t *sem)
+{
+	while (sem_wait(sem) != 0) {
+		NRF_RPC_ASSERT(errno == EINTR);
+	}
+}
+
+static uint64_t time_us_get(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/* Select the lane to serve next. Must be called with pool_mutex locked and
+ * at least one work queued.
+ */
+static struct pool_lane *lane_pick(void)
+{
+	struct pool_lane *picked = NULL;
+	struct pool_lane *lane;
+	uint32_t i;
+
+	for (i = 0; i < NRF_RPC_PRIO_LANES; i++) {
+		lane = &pool_lanes[i];
+		if (lane->count == 0) {
+			continue;
+		}
+		if (picked == NULL) {
+			picked = lane;
+		} else if (lane->bypassed >= CONFIG_NRF_RPC_PRIO_BURST) {
+			/* Starving lane is served before higher ones. */
+			picked = lane;
+			break;
+		}
+	}
+
+	for (lane = picked + 1; lane < &pool_lanes[NRF_RPC_PRIO_LANES];
+	     lane++) {
+		if (lane->count > 0) {
+			lane->bypassed++;
+		}
+	}
+
+	picked->bypassed = 0;
+
+	return picked;
+}
+
+static void *pool_thread(void *arg)
+{
+	struct pool_lane *lane;
+	struct pool_item item;
+	uint64_t delay;
+
+	(void)arg;
+
+	while (true) {
+		pthread_mutex_lock(&pool_mutex);
+		while (pool_count == 0) {
+			pthread_cond_wait(&pool_cond, &pool_mutex);
+		}
+
+		lane = lane_pick();
+		item = lane->items[lane->head];
+		lane->head = (lane->head + 1) % CONFIG_NRF_RPC_THREAD_POOL_SIZE;
+		lane->count--;
+		pool_count--;
+
+		delay = time_us_get() - item.queued_us;
+		lane->stats.count++;
+		lane->stats.delay_total_us += delay;
+		if (delay > lane->stats.delay_max_us) {
+			lane->stats.delay_max_us = (uint32_t)delay;
+		}
+		pthread_mutex_unlock(&pool_mutex);
+
+		sem_post(&lane->space_sem);
+
+		work_callback(item.data, item.len);
+	}
+
+	return NULL;
+}
+
+int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
+{
+	pthread_t thread;
+	int err;
+	int i;
+
+	NRF_RPC_ASSERT(callback != NULL);
+
+	work_callback = callback;
+
+	if (pthread_key_create(&tls_key, NULL) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	if (sem_init(&ctx_sem, 0, CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE) != 0 ||
+	    sem_init(&remote_sem, 0, 0) != 0 ||
+	    sem_init(&remote_low_sem, 0, 0) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	for (i = 0; i < NRF_RPC_PRIO_LANES; i++) {
+		if (sem_init(&pool_lanes[i].space_sem, 0,
+			     CONFIG_NRF_RPC_THREAD_POOL_SIZE) != 0) {
+			return -NRF_ENOMEM;
+		}
+	}
+
+	for (i = 0; i < CONFIG_NRF_RPC_THREAD_POOL_SIZE; i++) {
+		err = pthread_create(&thread, NULL, pool_thread, NULL);
+		if (err != 0) {
+			NRF_RPC_ERR("Cannot create pool thread: %d", err);
+			return -NRF_ENOMEM;
+		}
+		pthread_detach(thread);
+	}
+
+	return 0;
+}
+
+void nrf_rpc_os_thread_pool_send_prio(const uint8_t *data, size_t len,
+				      uint8_t lane_num)
+{
+	struct pool_lane *lane;
+	struct pool_item *item;
+
+	NRF_RPC_ASSERT(lane_num < NRF_RPC_PRIO_LANES);
+
+	lane = &pool_lanes[lane_num];
+
+	/* The remote side does not send more works than the number of pool
+	 * threads, so this normally does not wait.
+	 */
+	sem_take(&lane->space_sem);
+
+	pthread_mutex_lock(&pool_mutex);
+	item = &lane->items[(lane->head + lane->count) %
+			    CONFIG_NRF_RPC_THREAD_POOL_SIZE];
+	item->data = data;
+	item->len = len;
+	item->queued_us = time_us_get();
+	lane->count++;
+	pool_count++;
+	if (lane->count > lane->stats.max_depth) {
+		lane->stats.max_depth = lane->count;
+	}
+	pthread_cond_signal(&pool_cond);
+	pthread_mutex_unlock(&pool_mutex);
+}
+
+void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
+{
+	nrf_rpc_os_thread_pool_send_prio(data, len, 0);
+}
+
+void nrf_rpc_os_lane_stats_get(uint8_t lane, struct nrf_rpc_lane_stats *stats)
+{
+	NRF_RPC_ASSERT(lane < NRF_RPC_PRIO_LANES);
+
+	pthread_mutex_lock(&pool_mutex);
+	*stats = pool_lanes[lane].stats;
+	pthread_mutex_unlock(&pool_mutex);
+}
+
+void nrf_rpc_os_lane_stats_reset(void)
+{
+	uint32_t i;
+
+	pthread_mutex_lock(&pool_mutex);
+	for (i = 0; i < NRF_RPC_PRIO_LANES; i++) {
+		memset(&pool_lanes[i].stats, 0, sizeof(pool_lanes[i].stats));
+	}
+	pthread_mutex_unlock(&pool_mutex);
+}
+
+int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event)
+{
+	if (pthread_mutex_init(&event->mutex, NULL) != 0 ||
+	    pthread_cond_init(&event->cond, NULL) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	event->set = false;
+
+	return 0;
+}
+
+void nrf_rpc_os_event_set(struct nrf_rpc_os_event *event)
+{
+	pthread_mutex_lock(&event->mutex);
+	event->set = true;
+	pthread_cond_signal(&event->cond);
+	pthread_mutex_unlock(&event->mutex);
+}
+
+void nrf_rpc_os_event_wait(struct nrf_rpc_os_event *event)
+{
+	pthread_mutex_lock(&event->mutex);
+	while (!event->set) {
+		pthread_cond_wait(&event->cond, &event->mutex);
+	}
+	event->set = false;
+	pthread_mutex_unlock(&event->mutex);
+}
+
+int nrf_rpc_os_msg_init(struct nrf_rpc_os_msg *msg)
+{
+	if (pthread_mutex_init(&msg->mutex, NULL) != 0 ||
+	    pthread_cond_init(&msg->cond, NULL) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	msg->data = NULL;
+	msg->len = 0;
+	msg->set = false;
+
+	return 0;
+}
+
+void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
+			size_t len)
+{
+	pthread_mutex_lock(&msg->mutex);
+	msg->data = data;
+	msg->len = len;
+	msg->set = true;
+	pthread_cond_signal(&msg->cond);
+	pthread_mutex_unlock(&msg->mutex);
+}
+
+void nrf_rpc_os_msg_get(struct nrf_rpc_os_msg *msg, const uint8_t **data,
+			size_t *len)
+{
+	pthread_mutex_lock(&msg->mutex);
+	while (!msg->set) {
+		pthread_cond_wait(&msg->cond, &msg->mutex);
+	}
+	*data = msg->data;
+	*len = msg->len;
+	msg->set = false;
+	pthread_mutex_unlock(&msg->mutex);
+}
+
+void *nrf_rpc_os_tls_get(void)
+{
+	return pthread_getspecific(tls_key);
+}
+
+void nrf_rpc_os_tls_set(void *data)
+{
+	pthread_setspecific(tls_key, data);
+}
+
+uint32_t nrf_rpc_os_ctx_pool_reserve(void)
+{
+	uint32_t index;
+
+	sem_take(&ctx_sem);
+
+	pthread_mutex_lock(&ctx_mutex);
+	index = __builtin_ctz(~ctx_reserved_mask);
+	ctx_reserved_mask |= 1U << index;
+	pthread_mutex_unlock(&ctx_mutex);
+
+	return index;
+}
+
+void nrf_rpc_os_ctx_pool_release(uint32_t index)
+{
+	NRF_RPC_ASSERT(index < CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE);
+
+	pthread_mutex_lock(&ctx_mutex);
+	ctx_reserved_mask &= ~(1U << index);
+	pthread_mutex_unlock(&ctx_mutex);
+
+	sem_post(&ctx_sem);
+}
+
+void nrf_rpc_os_remote_count(int count)
+{
+	int low_count = count - CONFIG_NRF_RPC_PRIO_RESERVED_REMOTE_THREADS;
+
+	NRF_RPC_ASSERT(count > 0);
+
+	NRF_RPC_DBG("Remote thread count changed to %d", count);
+
+	if (low_count < 1) {
+		low_count = 1;
+	}
+
+	while (count-- > 0) {
+		sem_post(&remote_sem);
+	}
+
+	while (low_count-- > 0) {
+		sem_post(&remote_low_sem);
+	}
+}
+
+void nrf_rpc_os_remote_reserve(void)
+{
+	sem_take(&remote_sem);
+}
+
+void nrf_rpc_os_remote_release(void)
+{
+	sem_post(&remote_sem);
+}
+
+void nrf_rpc_os_remote_reserve_prio(uint8_t lane)
+{
+	if (lane > 0) {
+		sem_take(&remote_low_sem);
+	}
+	sem_take(&remote_sem);
+}
+
+void nrf_rpc_os_remote_release_prio(uint8_t lane)
+{
+	sem_post(&remote_sem);
+	if (lane > 0) {
+		sem_post(&remote_low_sem);
+	}
+}
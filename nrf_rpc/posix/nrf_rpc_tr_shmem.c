@@ -0,0 +1,573 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#define NRF_RPC_LOG_MODULE NRF_RPC_TR
+#include <nrf_rpc_log.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "nrf_errno.h"
+#include "nrf_rpc_common.h"
+#include "nrf_rpc_tr_shmem.h"
+
+#define RING_SIZE CONFIG_NRF_RPC_TR_SHMEM_RING_SIZE
+#define RING_MASK (RING_SIZE - 1)
+
+NRF_RPC_STATIC_ASSERT((RING_SIZE & RING_MASK) == 0,
+		      "Ring size must be a power of two");
+
+/* Value set by the primary side when the shared memory is initialized. */
+#define SHMEM_MAGIC 0x4352504E
+
+/* Entries are aligned to the header size, so that the space left at the end
+ * of a ring always fits at least a padding entry header.
+ */
+#define ENTRY_ALIGN NRF_RPC_TR_MAX_HEADER_SIZE
+
+/* Entry was sent and can be consumed by the remote side. */
+#define ENTRY_FLAG_COMMITTED 0x01
+/* Entry does not carry a packet and is skipped by the remote side. */
+#define ENTRY_FLAG_SKIP      0x02
+/* Entry was passed to nRF RPC by the remote side. */
+#define ENTRY_FLAG_CONSUMED  0x04
+/* Entry was freed and its space can be reused. */
+#define ENTRY_FLAG_RELEASED  0x08
+
+#define ATTACH_POLL_PERIOD_MS 1
+
+/* Header of each entry in a ring. */
+struct entry {
+	uint32_t size;	/* Size of the entry including this header. */
+	uint32_t len;	/* Length of the packet. */
+	_Atomic uint32_t flags;
+	uint32_t reserved;
+	uint8_t data[];
+};
+
+NRF_RPC_STATIC_ASSERT(sizeof(struct entry) == NRF_RPC_TR_MAX_HEADER_SIZE,
+		      "Invalid entry header size");
+
+/* Single-producer, single-consumer ring. The indexes are free-running byte
+ * counters, so the ring is empty when they are equal.
+ *
+ * Entries become visible to the consumer when they are allocated, and are
+ * consumed as soon as they are committed, even if an older entry is still
+ * being filled by another thread. Otherwise a thread that allocated a buffer
+ * and waits for a remote thread before sending it would block the packets
+ * that release remote threads.
+ */
+struct ring {
+	/* Index after the last allocated entry, written by the producer. */
+	_Atomic uint32_t head;
+	/* Number of commits, written by the producer. */
+	_Atomic uint32_t commit_count;
+	/* Set by the consumer before it waits for data. */
+	_Atomic uint32_t data_waiting;
+	uint8_t pad0[52];
+	/* Index of the oldest entry not released yet, written by
+	 * the consumer.
+	 */
+	_Atomic uint32_t tail;
+	/* Set by the producer before it waits for free space. */
+	_Atomic uint32_t space_waiting;
+	uint8_t pad1[56];
+	sem_t data_sem;
+	sem_t space_sem;
+	uint8_t data[RING_SIZE] __attribute__((aligned(ENTRY_ALIGN)));
+};
+
+/* Layout of the shared memory object. */
+struct shmem {
+	_Atomic uint32_t magic;
+	uint32_t ring_size;
+	/* Process that created the object. */
+	_Atomic pid_t primary_pid;
+	/* Process attached as the secondary side, 0 if there is none. */
+	_Atomic pid_t secondary_pid;
+	/* Ring 0 is written by the primary side, ring 1 by the secondary
+	 * side.
+	 */
+	struct ring rings[2];
+};
+
+static const char *shmem_name = CONFIG_NRF_RPC_TR_SHMEM_NAME;
+static enum nrf_rpc_tr_shmem_role shmem_role = NRF_RPC_TR_SHMEM_PRIMARY;
+static struct shmem *shmem;
+
+static nrf_rpc_tr_receive_handler_t receive_callback;
+static pthread_t rx_thread;
+static atomic_bool rx_stop;
+
+static struct ring *tx_ring;
+static pthread_mutex_t tx_mutex = PTHREAD_MUTEX_INITIALIZER;
+/* Index after the last allocated entry. */
+static uint32_t tx_reserved;
+
+static struct ring *rx_ring;
+static pthread_mutex_t rx_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static inline struct entry *entry_get(struct ring *ring, uint32_t index)
+{
+	return (struct entry *)&ring->data[index & RING_MASK];
+}
+
+/* Find the entry holding a pointer. The pointer may be shifted into
+ * the packet, as nRF RPC passes packets without their header in some cases.
+ */
+static inline struct entry *entry_by_ptr_get(struct ring *ring,
+					     const uint8_t *ptr)
+{
+	uintptr_t offset = (uintptr_t)(ptr - ring->data);
+
+	NRF_RPC_ASSERT(offset >= sizeof(struct entry) && offset < RING_SIZE);
+
+	offset = (offset - sizeof(struct entry)) & ~(uintptr_t)(ENTRY_ALIGN - 1);
+
+	return (struct entry *)&ring->data[offset];
+}
+
+static void sem_take(sem_t *sem)
+{
+	while (sem_wait(sem) != 0) {
+		NRF_RPC_ASSERT(errno == EINTR);
+	}
+}
+
+/* Wake up the other side if it announced that it waits on the semaphore. */
+static void wake_up(_Atomic uint32_t *waiting, sem_t *sem)
+{
+	if (atomic_exchange(waiting, 0) != 0) {
+		sem_post(sem);
+	}
+}
+
+/* Wait on the semaphore unless the index changed after the wait was
+ * announced. The announcement and the check are both sequentially
+ * consistent, so a wake up from the other side cannot be lost.
+ */
+static void wait_for_change(_Atomic uint32_t *waiting, sem_t *sem,
+			    _Atomic uint32_t *index, uint32_t value)
+{
+	atomic_store(waiting, 1);
+
+	if (atomic_load(index) != value) {
+		if (atomic_exchange(waiting, 0) == 0) {
+			/* The other side already posted, consume it. */
+			sem_take(sem);
+		}
+		return;
+	}
+
+	sem_take(sem);
+}
+
+/* Make a filled entry available to the remote side. */
+static void tx_commit(struct entry *entry, uint32_t flags)
+{
+	atomic_store_explicit(&entry->flags, flags, memory_order_release);
+	atomic_fetch_add(&tx_ring->commit_count, 1);
+	wake_up(&tx_ring->data_waiting, &tx_ring->data_sem);
+}
+
+void nrf_rpc_tr_alloc_tx_buf(uint8_t **buf, size_t len)
+{
+	uint32_t size = (sizeof(struct entry) + len + ENTRY_ALIGN - 1) &
+			~(uint32_t)(ENTRY_ALIGN - 1);
+	uint32_t contiguous;
+	uint32_t needed;
+	uint32_t tail;
+	struct entry *entry;
+
+	NRF_RPC_ASSERT(size <= RING_SIZE / 2);
+
+	pthread_mutex_lock(&tx_mutex);
+
+	while (true) {
+		contiguous = RING_SIZE - (tx_reserved & RING_MASK);
+		needed = (contiguous < size) ? (contiguous + size) : size;
+		tail = atomic_load_explicit(&tx_ring->tail,
+					    memory_order_acquire);
+
+		if (tx_reserved + needed - tail <= RING_SIZE) {
+			break;
+		}
+
+		/* Wait with tx_mutex locked, so that there is only one
+		 * waiter for the space at a time and a single wake up from
+		 * the remote side cannot be lost by other waiters. Other
+		 * senders queue on the mutex. Committing entries does not
+		 * need the mutex, so this cannot block the remote side.
+		 */
+		wait_for_change(&tx_ring->space_waiting, &tx_ring->space_sem,
+				&tx_ring->tail, tail);
+	}
+
+	if (contiguous < size) {
+		/* Fill the end of the ring, the entry starts from
+		 * the beginning.
+		 */
+		entry = entry_get(tx_ring, tx_reserved);
+		entry->size = contiguous;
+		entry->len = 0;
+		atomic_store_explicit(&entry->flags,
+				      ENTRY_FLAG_COMMITTED | ENTRY_FLAG_SKIP,
+				      memory_order_relaxed);
+		tx_reserved += contiguous;
+	}
+
+	entry = entry_get(tx_ring, tx_reserved);
+	entry->size = size;
+	entry->len = 0;
+	atomic_store_explicit(&entry->flags, 0, memory_order_relaxed);
+	tx_reserved += size;
+
+	atomic_store_explicit(&tx_ring->head, tx_reserved,
+			      memory_order_release);
+
+	pthread_mutex_unlock(&tx_mutex);
+
+	*buf = entry->data;
+}
+
+void nrf_rpc_tr_free_tx_buf(uint8_t *buf)
+{
+	tx_commit(entry_by_ptr_get(tx_ring, buf),
+		  ENTRY_FLAG_COMMITTED | ENTRY_FLAG_SKIP);
+}
+
+int nrf_rpc_tr_send(uint8_t *buf, size_t len)
+{
+	struct entry *entry = entry_by_ptr_get(tx_ring, buf);
+
+	NRF_RPC_ASSERT(sizeof(struct entry) + len <= entry->size);
+
+	NRF_RPC_DUMP_DBG(buf, len, "Sending packet");
+
+	entry->len = len;
+	tx_commit(entry, ENTRY_FLAG_COMMITTED);
+
+	return 0;
+}
+
+/* Release an entry and return consecutive released entries to the remote
+ * side.
+ */
+static void rx_release(struct entry *entry)
+{
+	uint32_t tail;
+	uint32_t head;
+	struct entry *oldest;
+
+	pthread_mutex_lock(&rx_mutex);
+
+	atomic_fetch_or_explicit(&entry->flags, ENTRY_FLAG_RELEASED,
+				 memory_order_relaxed);
+
+	tail = atomic_load_explicit(&rx_ring->tail, memory_order_relaxed);
+	head = atomic_load_explicit(&rx_ring->head, memory_order_acquire);
+
+	while (tail != head) {
+		oldest = entry_get(rx_ring, tail);
+		if (!(atomic_load_explicit(&oldest->flags,
+					   memory_order_relaxed) &
+		      ENTRY_FLAG_RELEASED)) {
+			break;
+		}
+		tail += oldest->size;
+	}
+
+	atomic_store_explicit(&rx_ring->tail, tail, memory_order_release);
+
+	pthread_mutex_unlock(&rx_mutex);
+
+	wake_up(&rx_ring->space_waiting, &rx_ring->space_sem);
+}
+
+void nrf_rpc_tr_free_rx_buf(const uint8_t *packet)
+{
+	rx_release(entry_by_ptr_get(rx_ring, packet));
+}
+
+/* Pass committed entries between the index and head to nRF RPC.
+ * Returns index of the oldest entry that was not consumed yet.
+ */
+static uint32_t rx_consume(uint32_t index, uint32_t head)
+{
+	uint32_t oldest = index;
+	bool consumed_all = true;
+	struct entry *entry;
+	uint32_t flags;
+
+	while (index != head) {
+		entry = entry_get(rx_ring, index);
+		index += entry->size;
+
+		flags = atomic_load_explicit(&entry->flags,
+					     memory_order_acquire);
+
+		if (!(flags & ENTRY_FLAG_COMMITTED)) {
+			/* Still being filled, consumed in a next pass. */
+			consumed_all = false;
+			continue;
+		}
+
+		if (!(flags & ENTRY_FLAG_CONSUMED)) {
+			atomic_fetch_or_explicit(&entry->flags,
+						 ENTRY_FLAG_CONSUMED,
+						 memory_order_relaxed);
+			if (flags & ENTRY_FLAG_SKIP) {
+				rx_release(entry);
+			} else {
+				NRF_RPC_DUMP_DBG(entry->data, entry->len,
+						 "Received packet");
+				receive_callback(entry->data, entry->len);
+			}
+		}
+
+		if (consumed_all) {
+			oldest = index;
+		}
+	}
+
+	return oldest;
+}
+
+static void *rx_thread_fn(void *arg)
+{
+	uint32_t oldest = atomic_load(&rx_ring->tail);
+	uint32_t commit_count;
+	uint32_t head;
+
+	(void)arg;
+
+	while (!atomic_load(&rx_stop)) {
+		commit_count = atomic_load(&rx_ring->commit_count);
+		head = atomic_load_explicit(&rx_ring->head,
+					    memory_order_acquire);
+
+		oldest = rx_consume(oldest, head);
+
+		wait_for_change(&rx_ring->data_waiting, &rx_ring->data_sem,
+				&rx_ring->commit_count, commit_count);
+	}
+
+	return NULL;
+}
+
+static int shmem_create(void)
+{
+	int fd;
+	int i;
+
+	shm_unlink(shmem_name);
+
+	fd = shm_open(shmem_name, O_CREAT | O_EXCL | O_RDWR, 0600);
+	if (fd < 0) {
+		NRF_RPC_ERR("Cannot create shared memory %s: %d", shmem_name,
+			    errno);
+		return -NRF_EIO;
+	}
+
+	if (ftruncate(fd, sizeof(struct shmem)) != 0) {
+		close(fd);
+		return -NRF_ENOMEM;
+	}
+
+	shmem = mmap(NULL, sizeof(struct shmem), PROT_READ | PROT_WRITE,
+		     MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (shmem == MAP_FAILED) {
+		shmem = NULL;
+		return -NRF_ENOMEM;
+	}
+
+	memset(shmem, 0, sizeof(struct shmem));
+	shmem->ring_size = RING_SIZE;
+	atomic_store(&shmem->primary_pid, getpid());
+
+	for (i = 0; i < 2; i++) {
+		if (sem_init(&shmem->rings[i].data_sem, 1, 0) != 0 ||
+		    sem_init(&shmem->rings[i].space_sem, 1, 0) != 0) {
+			return -NRF_ENOMEM;
+		}
+	}
+
+	atomic_store_explicit(&shmem->magic, SHMEM_MAGIC, memory_order_release);
+
+	return 0;
+}
+
+static bool process_is_alive(pid_t pid)
+{
+	return (pid > 0) && ((kill(pid, 0) == 0) || (errno == EPERM));
+}
+
+/* Claim the secondary side of an initialized object. An object left behind
+ * by a primary side that does not run anymore is stale, and so is an object
+ * that another secondary side attached to, as the state of its rings is
+ * unknown. The primary side replaces a stale object when it starts.
+ */
+static bool shmem_claim(void)
+{
+	pid_t expected = 0;
+
+	if (!process_is_alive(atomic_load(&shmem->primary_pid))) {
+		return false;
+	}
+
+	return atomic_compare_exchange_strong(&shmem->secondary_pid, &expected,
+					      getpid());
+}
+
+static int shmem_attach(void)
+{
+	const struct timespec period = {
+		.tv_nsec = ATTACH_POLL_PERIOD_MS * 1000000L,
+	};
+	struct stat st;
+	uint32_t waited = 0;
+	int fd = -1;
+
+	/* Wait for the primary side to create and initialize the object. */
+	while (true) {
+		if (fd < 0) {
+			fd = shm_open(shmem_name, O_RDWR, 0600);
+		}
+
+		if (fd >= 0 && fstat(fd, &st) == 0 &&
+		    st.st_size >= (off_t)sizeof(struct shmem)) {
+			if (shmem == NULL) {
+				shmem = mmap(NULL, sizeof(struct shmem),
+					     PROT_READ | PROT_WRITE,
+					     MAP_SHARED, fd, 0);
+				if (shmem == MAP_FAILED) {
+					shmem = NULL;
+					close(fd);
+					return -NRF_ENOMEM;
+				}
+			}
+
+			if (atomic_load_explicit(&shmem->magic,
+						 memory_order_acquire) ==
+			    SHMEM_MAGIC) {
+				if (shmem_claim()) {
+					break;
+				}
+
+				/* Reopen the object, as the primary side
+				 * creates a new one in its place.
+				 */
+				munmap(shmem, sizeof(struct shmem));
+				shmem = NULL;
+				close(fd);
+				fd = -1;
+			}
+		}
+
+		if (waited >= CONFIG_NRF_RPC_TR_SHMEM_ATTACH_TIMEOUT_MS) {
+			NRF_RPC_ERR("Shared memory %s not available",
+				    shmem_name);
+			if (fd >= 0) {
+				close(fd);
+			}
+			return -NRF_ETIMEDOUT;
+		}
+
+		nanosleep(&period, NULL);
+		waited += ATTACH_POLL_PERIOD_MS;
+	}
+
+	close(fd);
+
+	if (shmem->ring_size != RING_SIZE) {
+		NRF_RPC_ERR("Ring size does not match the primary side");
+		atomic_store(&shmem->secondary_pid, 0);
+		munmap(shmem, sizeof(struct shmem));
+		shmem = NULL;
+		return -NRF_EINVAL;
+	}
+
+	return 0;
+}
+
+void nrf_rpc_tr_shmem_configure(const char *name,
+				enum nrf_rpc_tr_shmem_role role)
+{
+	shmem_name = name;
+	shmem_role = role;
+}
+
+int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback)
+{
+	int err;
+
+	NRF_RPC_ASSERT(callback != NULL);
+
+	receive_callback = callback;
+
+	if (shmem_role == NRF_RPC_TR_SHMEM_PRIMARY) {
+		err = shmem_create();
+	} else {
+		err = shmem_attach();
+	}
+
+	if (err < 0) {
+		return err;
+	}
+
+	if (shmem_role == NRF_RPC_TR_SHMEM_PRIMARY) {
+		tx_ring = &shmem->rings[0];
+		rx_ring = &shmem->rings[1];
+	} else {
+		tx_ring = &shmem->rings[1];
+		rx_ring = &shmem->rings[0];
+	}
+
+	tx_reserved = atomic_load(&tx_ring->head);
+
+	atomic_store(&rx_stop, false);
+
+	if (pthread_create(&rx_thread, NULL, rx_thread_fn, NULL) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	return 0;
+}
+
+void nrf_rpc_tr_shmem_uninit(void)
+{
+	if (shmem == NULL) {
+		return;
+	}
+
+	atomic_store(&rx_stop, true);
+	sem_post(&rx_ring->data_sem);
+	pthread_join(rx_thread, NULL);
+
+	if (shmem_role == NRF_RPC_TR_SHMEM_SECONDARY) {
+		atomic_store(&shmem->secondary_pid, 0);
+	}
+
+	munmap(shmem, sizeof(struct shmem));
+	shmem = NULL;
+
+	if (shmem_role == NRF_RPC_TR_SHMEM_PRIMARY) {
+		shm_unlink(shmem_name);
+	}
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_TR_SHMEM_H_
+#define NRF_RPC_TR_SHMEM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @defgroup nrf_rpc_tr_shmem nRF RPC shared memory transport
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief nRF RPC transport over POSIX shared memory.
+ *
+ * The transport connects two processes through a pair of single-producer,
+ * single-consumer rings placed in a POSIX shared memory object. Transmit
+ * buffers are allocated directly inside the outgoing ring, and received
+ * packets are passed to nRF RPC in place, so no packet is copied by
+ * the transport. The API is documented in template/nrf_rpc_tr_tmpl.h.
+ *
+ * The transport is selected with @option{CONFIG_NRF_RPC_TR_CUSTOM} and
+ * @option{CONFIG_NRF_RPC_TR_CUSTOM_INCLUDE} set to "nrf_rpc_tr_shmem.h".
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Size of each of the two rings in bytes. Must be a power of two. */
+#ifndef CONFIG_NRF_RPC_TR_SHMEM_RING_SIZE
+#define CONFIG_NRF_RPC_TR_SHMEM_RING_SIZE 16384
+#endif
+
+/** @brief Default name of the shared memory object. */
+#ifndef CONFIG_NRF_RPC_TR_SHMEM_NAME
+#define CONFIG_NRF_RPC_TR_SHMEM_NAME "/nrf_rpc"
+#endif
+
+/** @brief Time the secondary side waits for the primary side to create
+ *  the shared memory object, in milliseconds.
+ */
+#ifndef CONFIG_NRF_RPC_TR_SHMEM_ATTACH_TIMEOUT_MS
+#define CONFIG_NRF_RPC_TR_SHMEM_ATTACH_TIMEOUT_MS 5000
+#endif
+
+/* Every packet in a ring is preceded by a 16-byte entry header. */
+#define NRF_RPC_TR_MAX_HEADER_SIZE 16
+
+#define NRF_RPC_TR_AUTO_FREE_RX_BUF 0
+
+/** @brief Role of the process in the shared memory connection. */
+enum nrf_rpc_tr_shmem_role {
+	/** Creates and initializes the shared memory object. */
+	NRF_RPC_TR_SHMEM_PRIMARY,
+	/** Attaches to the object created by the primary side. An object
+	 *  left behind by a process that does not run anymore is ignored
+	 *  until the primary side replaces it.
+	 */
+	NRF_RPC_TR_SHMEM_SECONDARY,
+};
+
+typedef void (*nrf_rpc_tr_receive_handler_t)(const uint8_t *packet, size_t len);
+
+/** @brief Configures the shared memory connection.
+ *
+ * Must be called before @ref nrf_rpc_init. If it is not called, the process
+ * is the primary side of @option{CONFIG_NRF_RPC_TR_SHMEM_NAME}.
+ *
+ * @param name Name of the shared memory object, starting with a slash.
+ * @param role Role of this process.
+ */
+void nrf_rpc_tr_shmem_configure(const char *name,
+				enum nrf_rpc_tr_shmem_role role);
+
+/** @brief Stops the receive thread and unmaps the shared memory.
+ *
+ * The primary side also removes the shared memory object.
+ */
+void nrf_rpc_tr_shmem_uninit(void);
+
+int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback);
+
+void nrf_rpc_tr_free_rx_buf(const uint8_t *packet);
+
+void nrf_rpc_tr_alloc_tx_buf(uint8_t **buf, size_t len);
+
+void nrf_rpc_tr_free_tx_buf(uint8_t *buf);
+
+int nrf_rpc_tr_send(uint8_t *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* NRF_RPC_TR_SHMEM_H_ */
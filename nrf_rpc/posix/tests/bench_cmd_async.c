@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Time of a fan-out of commands sent one by one with nrf_rpc_cmd, and sent
+ * with nrf_rpc_cmd_async and waited afterwards.
+ *
+ * Usage: bench_cmd_async [commands [work_us]]
+ */
+
+#include <string.h>
+
+#include "bench_common.h"
+
+#define WORK_CMD 0x01
+
+#define DEFAULT_COMMANDS 16
+
+/* Time a command blocks its server thread, in microseconds. */
+#define DEFAULT_WORK_US 20000
+
+#define ROUNDS 5
+
+/* Commands in progress at a time. A future holds a command context until it
+ * is waited, and one context is left for the waiting thread.
+ */
+#define WINDOW (CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE - 1)
+
+NRF_RPC_GROUP_DEFINE(bench_group, "bench_async", NULL, NULL, NULL);
+
+static uint32_t work_us = DEFAULT_WORK_US;
+
+static void work_cmd_handler(const uint8_t *packet, size_t len,
+			     void *handler_data)
+{
+	struct timespec work;
+	uint32_t us;
+	uint8_t *rsp;
+
+	(void)handler_data;
+
+	CHECK(len == sizeof(us));
+	memcpy(&us, packet, sizeof(us));
+	nrf_rpc_decoding_done(packet);
+
+	work.tv_sec = us / 1000000;
+	work.tv_nsec = (long)(us % 1000000) * 1000L;
+	nanosleep(&work, NULL);
+
+	NRF_RPC_ALLOC(rsp, 0);
+	CHECK(nrf_rpc_rsp(rsp, 0) == 0);
+}
+
+NRF_RPC_CMD_DECODER(bench_group, work_cmd, WORK_CMD, work_cmd_handler, NULL);
+
+static void rsp_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	(void)packet;
+	(void)len;
+
+	(*(uint32_t *)handler_data)++;
+}
+
+static uint8_t *work_cmd_alloc(void)
+{
+	uint8_t *packet;
+
+	NRF_RPC_ALLOC(packet, sizeof(work_us));
+	memcpy(packet, &work_us, sizeof(work_us));
+
+	return packet;
+}
+
+static uint64_t sequential_run(uint32_t commands)
+{
+	uint64_t start = test_time_us();
+	uint32_t done = 0;
+	uint32_t i;
+
+	for (i = 0; i < commands; i++) {
+		CHECK(nrf_rpc_cmd(&bench_group, WORK_CMD, work_cmd_alloc(),
+				  sizeof(work_us), rsp_handler, &done) == 0);
+	}
+
+	CHECK(done == commands);
+
+	return test_time_us() - start;
+}
+
+static uint64_t async_run(uint32_t commands)
+{
+	struct nrf_rpc_future futures[WINDOW];
+	uint64_t start = test_time_us();
+	uint32_t done = 0;
+	uint32_t i;
+
+	for (i = 0; i < commands; i++) {
+		if (i >= WINDOW) {
+			nrf_rpc_future_wait(&futures[i % WINDOW]);
+		}
+		CHECK(nrf_rpc_cmd_async(&bench_group, WORK_CMD,
+					work_cmd_alloc(), sizeof(work_us),
+					rsp_handler, &done,
+					&futures[i % WINDOW]) == 0);
+	}
+
+	for (i = (commands > WINDOW) ? commands - WINDOW : 0; i < commands;
+	     i++) {
+		nrf_rpc_future_wait(&futures[i % WINDOW]);
+	}
+
+	CHECK(done == commands);
+
+	return test_time_us() - start;
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t sequential[ROUNDS];
+	uint32_t async[ROUNDS];
+	uint32_t commands = DEFAULT_COMMANDS;
+	pid_t server;
+	uint32_t i;
+
+	if (argc > 1) {
+		commands = (uint32_t)strtoul(argv[1], NULL, 0);
+	}
+
+	if (argc > 2) {
+		work_us = (uint32_t)strtoul(argv[2], NULL, 0);
+	}
+
+	CHECK(commands > 0);
+
+	server = bench_connect("async");
+
+	for (i = 0; i < ROUNDS; i++) {
+		sequential[i] = (uint32_t)sequential_run(commands);
+		async[i] = (uint32_t)async_run(commands);
+	}
+
+	bench_disconnect(server);
+
+	printf("%u commands of %u us, %d remote threads: "
+	       "sequential %u us, async %u us (median of %d)\n",
+	       commands, work_us, CONFIG_NRF_RPC_THREAD_POOL_SIZE,
+	       bench_percentile(sequential, ROUNDS, 50),
+	       bench_percentile(async, ROUNDS, 50), ROUNDS);
+
+	return 0;
+}
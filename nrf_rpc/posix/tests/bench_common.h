@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BENCH_COMMON_H_
+#define BENCH_COMMON_H_
+
+#include <stdlib.h>
+
+#include "nrf_rpc.h"
+#include "nrf_rpc_tr_shmem.h"
+
+#include "test_common.h"
+
+/* Helpers of the benchmarks. A benchmark is a client process connected over
+ * the shared memory transport to a server process forked from it. Both run
+ * the same binary, so they have the same groups.
+ */
+
+/* Time after which a server left by a failed client exits, in seconds. */
+#define BENCH_TIMEOUT_S 300
+
+static char bench_shmem_name[64];
+
+static inline void bench_server_run(void *arg)
+{
+	(void)arg;
+
+	/* The client kills the server when it is done. */
+	alarm(BENCH_TIMEOUT_S);
+
+	nrf_rpc_tr_shmem_configure(bench_shmem_name,
+				   NRF_RPC_TR_SHMEM_SECONDARY);
+	CHECK(nrf_rpc_init(NULL) == 0);
+
+	while (true) {
+		pause();
+	}
+}
+
+/* Start the server and connect to it. Returns the server process ID. */
+static inline pid_t bench_connect(const char *name)
+{
+	pid_t server;
+
+	test_shmem_name(bench_shmem_name, sizeof(bench_shmem_name), name);
+
+	server = test_spawn(bench_server_run, NULL);
+
+	nrf_rpc_tr_shmem_configure(bench_shmem_name, NRF_RPC_TR_SHMEM_PRIMARY);
+	CHECK(nrf_rpc_init(NULL) == 0);
+
+	return server;
+}
+
+static inline void bench_disconnect(pid_t server)
+{
+	int status;
+
+	kill(server, SIGKILL);
+	CHECK(waitpid(server, &status, 0) == server);
+
+	nrf_rpc_tr_shmem_uninit();
+}
+
+static inline int bench_u32_compare(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* Sort the samples and return the percentile. */
+static inline uint32_t bench_percentile(uint32_t *samples, size_t count,
+					uint32_t percent)
+{
+	size_t index = (count * percent + 99) / 100;
+
+	qsort(samples, count, sizeof(samples[0]), bench_u32_compare);
+
+	return samples[(index > 0) ? index - 1 : 0];
+}
+
+#endif /* BENCH_COMMON_H_ */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Latency of commands in a high priority group while a low priority group
+ * floods the remote side with events.
+ *
+ * Usage: bench_prio_lanes [commands]
+ *
+ * Build the project with -DNRF_RPC_PRIO_LANES=1 and with
+ * -DNRF_RPC_PRIO_LANES=3 to compare the latency without and with lanes.
+ */
+
+#include <stdatomic.h>
+#include <string.h>
+
+#include "bench_common.h"
+
+#define CTRL_CMD 0x01
+#define BULK_EVT 0x01
+
+/* Time a bulk event blocks its server thread, in microseconds. The handler
+ * sleeps rather than spins, so that the result does not depend on the number
+ * of CPUs.
+ */
+#define BULK_WORK_US 500
+
+#define BULK_LEN 8
+#define FLOOD_THREADS 4
+
+/* Period of the measured commands, in microseconds. */
+#define CMD_PERIOD_US 1000
+
+#define DEFAULT_COMMANDS 2000
+
+NRF_RPC_GROUP_DEFINE_PRIO(ctrl_group, "bench_ctrl", 0, NULL, NULL, NULL);
+NRF_RPC_GROUP_DEFINE_PRIO(bulk_group, "bench_bulk", 2, NULL, NULL, NULL);
+
+static atomic_bool flood_stop;
+
+static void ctrl_cmd_handler(const uint8_t *packet, size_t len,
+			     void *handler_data)
+{
+	uint8_t *rsp;
+
+	(void)len;
+	(void)handler_data;
+
+	nrf_rpc_decoding_done(packet);
+
+	NRF_RPC_ALLOC(rsp, 0);
+	CHECK(nrf_rpc_rsp(rsp, 0) == 0);
+}
+
+NRF_RPC_CMD_DECODER(ctrl_group, ctrl_cmd, CTRL_CMD, ctrl_cmd_handler, NULL);
+
+static void bulk_evt_handler(const uint8_t *packet, size_t len,
+			     void *handler_data)
+{
+	const struct timespec work = {
+		.tv_nsec = BULK_WORK_US * 1000L,
+	};
+
+	(void)len;
+	(void)handler_data;
+
+	nrf_rpc_decoding_done(packet);
+
+	nanosleep(&work, NULL);
+}
+
+NRF_RPC_EVT_DECODER(bulk_group, bulk_evt, BULK_EVT, bulk_evt_handler, NULL);
+
+static void rsp_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	(void)packet;
+	(void)len;
+	(void)handler_data;
+}
+
+static void *flood_thread(void *arg)
+{
+	uint8_t *packet;
+
+	(void)arg;
+
+	while (!atomic_load(&flood_stop)) {
+		NRF_RPC_ALLOC(packet, BULK_LEN);
+		memset(packet, 0, BULK_LEN);
+		CHECK(nrf_rpc_evt(&bulk_group, BULK_EVT, packet,
+				  BULK_LEN) == 0);
+	}
+
+	return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+	pthread_t threads[FLOOD_THREADS];
+	uint32_t commands = DEFAULT_COMMANDS;
+	uint32_t *latency;
+	uint64_t start;
+	uint8_t *packet;
+	pid_t server;
+	uint32_t i;
+
+	if (argc > 1) {
+		commands = (uint32_t)strtoul(argv[1], NULL, 0);
+	}
+
+	CHECK(commands > 0);
+	latency = calloc(commands, sizeof(latency[0]));
+	CHECK(latency != NULL);
+
+	server = bench_connect("lanes");
+
+	for (i = 0; i < FLOOD_THREADS; i++) {
+		CHECK(pthread_create(&threads[i], NULL, flood_thread,
+				     NULL) == 0);
+	}
+
+	for (i = 0; i < commands; i++) {
+		start = test_time_us();
+
+		NRF_RPC_ALLOC(packet, 0);
+		CHECK(nrf_rpc_cmd(&ctrl_group, CTRL_CMD, packet, 0,
+				  rsp_handler, NULL) == 0);
+
+		latency[i] = (uint32_t)(test_time_us() - start);
+
+		while (test_time_us() < start + CMD_PERIOD_US) {
+			test_sleep_ms(0);
+		}
+	}
+
+	atomic_store(&flood_stop, true);
+	for (i = 0; i < FLOOD_THREADS; i++) {
+		CHECK(pthread_join(threads[i], NULL) == 0);
+	}
+
+	bench_disconnect(server);
+
+	printf("lanes %d, %u commands during an event flood: "
+	       "p50 %u us, p99 %u us, max %u us\n",
+	       NRF_RPC_PRIO_LANES, commands,
+	       bench_percentile(latency, commands, 50),
+	       bench_percentile(latency, commands, 99),
+	       bench_percentile(latency, commands, 100));
+
+	free(latency);
+
+	return 0;
+}
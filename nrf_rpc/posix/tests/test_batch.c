@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Tests of batch packets, run against the mock transport. The test plays
+ * the remote side by injecting received packets and inspecting sent ones.
+ */
+
+#include <string.h>
+
+#include "nrf_rpc.h"
+#include "tr_mock.h"
+
+#include "test_common.h"
+
+#define TEST_EVT 0x01
+
+/* Number of threads the remote side announces. */
+#define REMOTE_THREADS 8
+
+/* Same as BATCH_RX_SLOTS in nrf_rpc.c. */
+#define BATCH_RX_SLOTS (CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE +		       \
+			CONFIG_NRF_RPC_THREAD_POOL_SIZE + 1)
+
+#define WAIT_MS 5000
+
+/* Batch packet built by the test. */
+struct batch {
+	uint8_t data[CONFIG_NRF_RPC_BATCH_SIZE];
+	size_t len;
+};
+
+NRF_RPC_GROUP_DEFINE(test_group, "test", NULL, NULL, NULL);
+
+static struct test_counter decoded = TEST_COUNTER_INITIALIZER;
+static struct test_counter errors = TEST_COUNTER_INITIALIZER;
+
+/* Events that were decoded and not freed yet, by their tag. */
+static const uint8_t *held[256];
+
+static void evt_handler(const uint8_t *packet, size_t len, void *handler_data)
+{
+	(void)handler_data;
+
+	CHECK(len == 1);
+	held[packet[0]] = packet;
+	test_counter_inc(&decoded);
+}
+
+NRF_RPC_EVT_DECODER(test_group, test_evt, TEST_EVT, evt_handler, NULL);
+
+static void err_handler(const struct nrf_rpc_err_report *report)
+{
+	(void)report;
+
+	test_counter_inc(&errors);
+}
+
+static void header_put(uint8_t *buf, uint8_t type, uint8_t id, uint8_t dst,
+		       uint8_t group_id)
+{
+	buf[0] = type;
+	buf[1] = id;
+	buf[2] = dst;
+	buf[3] = group_id;
+}
+
+static void batch_start(struct batch *batch)
+{
+	header_put(batch->data, NRF_RPC_PACKET_TYPE_BATCH, 0,
+		   NRF_RPC_ID_UNKNOWN, NRF_RPC_ID_UNKNOWN);
+	batch->len = _NRF_RPC_HEADER_SIZE;
+}
+
+static void batch_add(struct batch *batch, const uint8_t *packet, size_t len)
+{
+	CHECK(batch->len + 2 + len <= sizeof(batch->data));
+
+	batch->data[batch->len] = (uint8_t)len;
+	batch->data[batch->len + 1] = (uint8_t)(len >> 8);
+	memcpy(&batch->data[batch->len + 2], packet, len);
+	batch->len += 2 + len;
+	batch->data[1]++;
+}
+
+static void batch_add_evt(struct batch *batch, uint8_t tag)
+{
+	uint8_t packet[_NRF_RPC_HEADER_SIZE + 1];
+
+	header_put(packet, NRF_RPC_PACKET_TYPE_EVT, TEST_EVT,
+		   NRF_RPC_ID_UNKNOWN, *test_group.group_id);
+	packet[_NRF_RPC_HEADER_SIZE] = tag;
+	batch_add(batch, packet, sizeof(packet));
+}
+
+static void batch_add_ack(struct batch *batch)
+{
+	uint8_t packet[_NRF_RPC_HEADER_SIZE];
+
+	header_put(packet, NRF_RPC_PACKET_TYPE_ACK, TEST_EVT,
+		   NRF_RPC_ID_UNKNOWN, *test_group.group_id);
+	batch_add(batch, packet, sizeof(packet));
+}
+
+/* Initialize nRF RPC and announce a remote side that supports batching. */
+static void rpc_init(void)
+{
+	uint8_t init[_NRF_RPC_HEADER_SIZE + sizeof(uint32_t) + 1];
+	uint32_t check_sum = 0;
+	const char *c;
+
+	CHECK(nrf_rpc_init(err_handler) == 0);
+
+	for (c = test_group.strid; *c != 0; c++) {
+		check_sum += (uint8_t)*c;
+	}
+	check_sum |= (uint32_t)1 << 24;
+
+	header_put(init, NRF_RPC_PACKET_TYPE_INIT, REMOTE_THREADS,
+		   NRF_RPC_ID_UNKNOWN, NRF_RPC_ID_UNKNOWN);
+	memcpy(&init[_NRF_RPC_HEADER_SIZE], &check_sum, sizeof(check_sum));
+	init[sizeof(init) - 1] = 0x01;
+
+	tr_mock_receive(init, sizeof(init));
+	CHECK(tr_mock_rx_free_total() == 1);
+}
+
+/* The batch packet is freed once, after the last of its packets. */
+static void test_rx_out_of_order(void *arg)
+{
+	struct batch batch;
+	const uint8_t *rx;
+
+	(void)arg;
+
+	rpc_init();
+
+	batch_start(&batch);
+	batch_add_evt(&batch, 0);
+	batch_add_evt(&batch, 1);
+	batch_add_evt(&batch, 2);
+
+	rx = tr_mock_receive(batch.data, batch.len);
+	CHECK(test_counter_wait(&decoded, 3, WAIT_MS));
+
+	nrf_rpc_decoding_done(held[2]);
+	nrf_rpc_decoding_done(held[0]);
+	CHECK(tr_mock_rx_free_count(rx) == 0);
+
+	nrf_rpc_decoding_done(held[1]);
+	CHECK(tr_mock_rx_free_count(rx) == 1);
+	CHECK(tr_mock_rx_free_total() == 2);
+}
+
+/* Packets handled in the receive thread release their reference too. */
+static void test_rx_mixed(void *arg)
+{
+	struct batch batch;
+	const uint8_t *rx;
+
+	(void)arg;
+
+	rpc_init();
+
+	batch_start(&batch);
+	batch_add_evt(&batch, 0);
+	batch_add_ack(&batch);
+	batch_add_evt(&batch, 1);
+
+	rx = tr_mock_receive(batch.data, batch.len);
+	CHECK(test_counter_wait(&decoded, 2, WAIT_MS));
+	CHECK(tr_mock_rx_free_count(rx) == 0);
+
+	nrf_rpc_decoding_done(held[1]);
+	CHECK(tr_mock_rx_free_count(rx) == 0);
+
+	nrf_rpc_decoding_done(held[0]);
+	CHECK(tr_mock_rx_free_count(rx) == 1);
+	CHECK(tr_mock_rx_free_total() == 2);
+}
+
+/* Packets before a malformed one are decoded and the batch is still freed
+ * once.
+ */
+static void test_rx_malformed(void *arg)
+{
+	struct batch batch;
+	const uint8_t *rx;
+
+	(void)arg;
+
+	rpc_init();
+
+	batch_start(&batch);
+	batch_add_evt(&batch, 0);
+
+	/* Length of the last packet exceeds the batch. */
+	batch.data[batch.len] = 0xFF;
+	batch.data[batch.len + 1] = 0;
+	batch.len += 2;
+
+	rx = tr_mock_receive(batch.data, batch.len);
+	CHECK(test_counter_wait(&errors, 1, WAIT_MS));
+	CHECK(test_counter_wait(&decoded, 1, WAIT_MS));
+	CHECK(tr_mock_rx_free_count(rx) == 0);
+
+	nrf_rpc_decoding_done(held[0]);
+	CHECK(tr_mock_rx_free_count(rx) == 1);
+	CHECK(tr_mock_rx_free_total() == 2);
+}
+
+/* Slots of freed batch packets are reused. */
+static void test_rx_slots_reused(void *arg)
+{
+	struct batch batch;
+	const uint8_t *rx;
+	uint32_t i;
+
+	(void)arg;
+
+	rpc_init();
+
+	for (i = 0; i < 4 * BATCH_RX_SLOTS; i++) {
+		batch_start(&batch);
+		batch_add_evt(&batch, 0);
+		batch_add_evt(&batch, 1);
+
+		rx = tr_mock_receive(batch.data, batch.len);
+		CHECK(test_counter_wait(&decoded, 2 * (i + 1), WAIT_MS));
+		CHECK(tr_mock_rx_free_count(rx) == 0);
+
+		nrf_rpc_decoding_done(held[0]);
+		nrf_rpc_decoding_done(held[1]);
+		CHECK(tr_mock_rx_free_count(rx) == 1);
+	}
+
+	CHECK(test_counter_get(&errors) == 0);
+}
+
+static void *evt_send_thread(void *arg)
+{
+	uint8_t *packet;
+
+	NRF_RPC_ALLOC(packet, 1);
+	packet[0] = (uint8_t)(uintptr_t)arg;
+	CHECK(nrf_rpc_evt(&test_group, TEST_EVT, packet, 1) == 0);
+
+	return NULL;
+}
+
+/* Packets sent while another thread is in the transport are batched and
+ * sent in order after it.
+ */
+static void test_tx_batching(void *arg)
+{
+	pthread_t threads[3];
+	const uint8_t *packet;
+	size_t len;
+	uint32_t sent;
+	uint32_t tx_freed;
+	uint32_t i;
+
+	(void)arg;
+
+	rpc_init();
+
+	CHECK(tr_mock_sent_wait(1, WAIT_MS));
+	sent = 1;
+	tx_freed = tr_mock_tx_free_total();
+
+	tr_mock_tx_hold(true);
+
+	CHECK(pthread_create(&threads[0], NULL, evt_send_thread,
+			     (void *)0) == 0);
+	CHECK(tr_mock_sent_wait(sent + 1, WAIT_MS));
+
+	/* Batched packets are copied and their buffers freed. */
+	for (i = 1; i < 3; i++) {
+		CHECK(pthread_create(&threads[i], NULL, evt_send_thread,
+				     (void *)(uintptr_t)i) == 0);
+		while (tr_mock_tx_free_total() < tx_freed + i) {
+			test_sleep_ms(1);
+		}
+	}
+
+	CHECK(tr_mock_tx_held() == 1);
+	tr_mock_tx_hold(false);
+
+	for (i = 0; i < 3; i++) {
+		CHECK(pthread_join(threads[i], NULL) == 0);
+	}
+
+	CHECK(tr_mock_sent_wait(sent + 2, WAIT_MS));
+
+	len = tr_mock_sent_get(sent, &packet);
+	CHECK(len == _NRF_RPC_HEADER_SIZE + 1);
+	CHECK(packet[0] == NRF_RPC_PACKET_TYPE_EVT);
+	CHECK(packet[_NRF_RPC_HEADER_SIZE] == 0);
+
+	len = tr_mock_sent_get(sent + 1, &packet);
+	CHECK(len == _NRF_RPC_HEADER_SIZE + 2 * (2 + _NRF_RPC_HEADER_SIZE + 1));
+	CHECK(packet[0] == NRF_RPC_PACKET_TYPE_BATCH);
+	CHECK(packet[1] == 2);
+
+	for (i = 0; i < 2; i++) {
+		const uint8_t *item = &packet[_NRF_RPC_HEADER_SIZE +
+					      i * (2 + _NRF_RPC_HEADER_SIZE + 1)];
+
+		CHECK(item[0] == _NRF_RPC_HEADER_SIZE + 1 && item[1] == 0);
+		CHECK(item[2] == NRF_RPC_PACKET_TYPE_EVT);
+		CHECK(item[3] == TEST_EVT);
+		CHECK(item[2 + _NRF_RPC_HEADER_SIZE] == i + 1);
+	}
+}
+
+int main(void)
+{
+	bool passed = true;
+
+	passed &= test_run("rx_out_of_order", test_rx_out_of_order);
+	passed &= test_run("rx_mixed", test_rx_mixed);
+	passed &= test_run("rx_malformed", test_rx_malformed);
+	passed &= test_run("rx_slots_reused", test_rx_slots_reused);
+	passed &= test_run("tx_batching", test_tx_batching);
+
+	return passed ? 0 : 1;
+}
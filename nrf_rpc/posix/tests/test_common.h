@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TEST_COMMON_H_
+#define TEST_COMMON_H_
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Helpers shared by the host tests and benchmarks of the POSIX port.
+ *
+ * nRF RPC and the shared memory transport keep their state in globals, so
+ * each test runs in its own process, and the remote side of a connection is
+ * another forked process.
+ */
+
+/* Time after which a hanging test process is killed, in seconds. */
+#define TEST_TIMEOUT_S 20
+
+#define CHECK(_expr)							       \
+	do {								       \
+		if (!(_expr)) {						       \
+			fprintf(stderr, "%s:%d: check failed: %s\n",	       \
+				__FILE__, __LINE__, #_expr);		       \
+			exit(1);					       \
+		}							       \
+	} while (0)
+
+/* Counter that the receiving threads increment and the test thread waits
+ * on.
+ */
+struct test_counter {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	uint32_t value;
+};
+
+#define TEST_COUNTER_INITIALIZER					       \
+	{ PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0 }
+
+static inline void test_counter_inc(struct test_counter *counter)
+{
+	pthread_mutex_lock(&counter->mutex);
+	counter->value++;
+	pthread_cond_broadcast(&counter->cond);
+	pthread_mutex_unlock(&counter->mutex);
+}
+
+static inline uint32_t test_counter_get(struct test_counter *counter)
+{
+	uint32_t value;
+
+	pthread_mutex_lock(&counter->mutex);
+	value = counter->value;
+	pthread_mutex_unlock(&counter->mutex);
+
+	return value;
+}
+
+/* Wait until the counter reaches the value. Returns false on timeout. */
+static inline bool test_counter_wait(struct test_counter *counter,
+				     uint32_t value, uint32_t timeout_ms)
+{
+	struct timespec deadline;
+	bool reached;
+
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	deadline.tv_sec += timeout_ms / 1000;
+	deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L) {
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	pthread_mutex_lock(&counter->mutex);
+	while (counter->value < value &&
+	       pthread_cond_timedwait(&counter->cond, &counter->mutex,
+				      &deadline) == 0) {
+	}
+	reached = counter->value >= value;
+	pthread_mutex_unlock(&counter->mutex);
+
+	return reached;
+}
+
+static inline uint64_t test_time_us(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
+
+static inline void test_sleep_ms(uint32_t ms)
+{
+	struct timespec period = {
+		.tv_sec = ms / 1000,
+		.tv_nsec = (long)(ms % 1000) * 1000000L,
+	};
+
+	nanosleep(&period, NULL);
+}
+
+/* Run the function in a new process. Returns the process ID. */
+static inline pid_t test_spawn(void (*fn)(void *arg), void *arg)
+{
+	pid_t pid;
+
+	fflush(stdout);
+	fflush(stderr);
+
+	pid = fork();
+	CHECK(pid >= 0);
+
+	if (pid == 0) {
+		alarm(TEST_TIMEOUT_S);
+		fn(arg);
+		exit(0);
+	}
+
+	return pid;
+}
+
+/* Wait for a process started with test_spawn. Returns true if it
+ * succeeded.
+ */
+static inline bool test_join(pid_t pid)
+{
+	int status;
+
+	CHECK(waitpid(pid, &status, 0) == pid);
+
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/* Run a test in its own process and print the result. Returns true if the
+ * test passed.
+ */
+static inline bool test_run(const char *name, void (*fn)(void *arg))
+{
+	bool passed = test_join(test_spawn(fn, NULL));
+
+	printf("%s: %s\n", name, passed ? "PASS" : "FAIL");
+	fflush(stdout);
+
+	return passed;
+}
+
+/* Name of a shared memory object unique to the test process. */
+static inline void test_shmem_name(char *name, size_t size, const char *test)
+{
+	snprintf(name, size, "/nrf_rpc_test_%s_%d", test, (int)getpid());
+}
+
+#endif /* TEST_COMMON_H_ */
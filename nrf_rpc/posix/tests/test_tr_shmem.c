@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Tests of the shared memory transport. The transport is built with a small
+ * ring, so that the tests wrap it many times.
+ */
+
+#include <string.h>
+#include <sys/mman.h>
+
+#include "nrf_errno.h"
+#include "nrf_rpc_tr_shmem.h"
+
+#include "test_common.h"
+
+#define RING_SIZE CONFIG_NRF_RPC_TR_SHMEM_RING_SIZE
+
+/* Number of packets sent through the ring in the wrap test. */
+#define WRAP_PACKETS 5000
+
+/* Longest packet of the wrap test. Its entry is below half of the ring. */
+#define WRAP_MAX_LEN (RING_SIZE / 2 - 2 * NRF_RPC_TR_MAX_HEADER_SIZE)
+
+/* Packet length of the release test, chosen so that entries fill the ring
+ * without padding.
+ */
+#define RELEASE_LEN (RING_SIZE / 8 - NRF_RPC_TR_MAX_HEADER_SIZE)
+#define RELEASE_FIT (RING_SIZE / (RELEASE_LEN + NRF_RPC_TR_MAX_HEADER_SIZE))
+#define RELEASE_PACKETS (3 * RELEASE_FIT)
+
+#define WAIT_MS 5000
+
+static char shmem_name[64];
+
+static struct test_counter received = TEST_COUNTER_INITIALIZER;
+static uint32_t expected_seq;
+static const uint8_t *held_packet;
+
+static size_t wrap_len(uint32_t seq)
+{
+	return sizeof(uint32_t) + (seq * 37) % (WRAP_MAX_LEN - sizeof(uint32_t));
+}
+
+static void packet_fill(uint8_t *buf, size_t len, uint32_t seq)
+{
+	size_t i;
+
+	memcpy(buf, &seq, sizeof(seq));
+	for (i = sizeof(seq); i < len; i++) {
+		buf[i] = (uint8_t)(seq + i);
+	}
+}
+
+static bool packet_valid(const uint8_t *buf, size_t len, uint32_t seq)
+{
+	uint32_t packet_seq;
+	size_t i;
+
+	if (len < sizeof(packet_seq)) {
+		return false;
+	}
+
+	memcpy(&packet_seq, buf, sizeof(packet_seq));
+	if (packet_seq != seq) {
+		return false;
+	}
+
+	for (i = sizeof(seq); i < len; i++) {
+		if (buf[i] != (uint8_t)(seq + i)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void unexpected_receive(const uint8_t *packet, size_t len)
+{
+	(void)packet;
+	(void)len;
+
+	CHECK(false);
+}
+
+static void send_packet(size_t len, uint32_t seq)
+{
+	uint8_t *buf;
+
+	nrf_rpc_tr_alloc_tx_buf(&buf, len);
+	packet_fill(buf, len, seq);
+	CHECK(nrf_rpc_tr_send(buf, len) == 0);
+}
+
+static void secondary_init(nrf_rpc_tr_receive_handler_t callback)
+{
+	nrf_rpc_tr_shmem_configure(shmem_name, NRF_RPC_TR_SHMEM_SECONDARY);
+	CHECK(nrf_rpc_tr_init(callback) == 0);
+}
+
+static void primary_init(nrf_rpc_tr_receive_handler_t callback)
+{
+	nrf_rpc_tr_shmem_configure(shmem_name, NRF_RPC_TR_SHMEM_PRIMARY);
+	CHECK(nrf_rpc_tr_init(callback) == 0);
+}
+
+/* Sends packets of varying length, so that padding entries are placed at
+ * different offsets when the ring wraps. Every tenth buffer is freed without
+ * sending to check that skipped entries are released too.
+ */
+static void wrap_sender(void *arg)
+{
+	uint32_t seq;
+	uint8_t *buf;
+
+	(void)arg;
+
+	secondary_init(unexpected_receive);
+
+	for (seq = 0; seq < WRAP_PACKETS; seq++) {
+		if (seq % 10 == 0) {
+			nrf_rpc_tr_alloc_tx_buf(&buf, wrap_len(seq));
+			nrf_rpc_tr_free_tx_buf(buf);
+		}
+		send_packet(wrap_len(seq), seq);
+	}
+
+	nrf_rpc_tr_shmem_uninit();
+}
+
+static void wrap_receive(const uint8_t *packet, size_t len)
+{
+	CHECK(len == wrap_len(expected_seq));
+	CHECK(packet_valid(packet, len, expected_seq));
+	expected_seq++;
+
+	nrf_rpc_tr_free_rx_buf(packet);
+	test_counter_inc(&received);
+}
+
+static void test_wrap(void *arg)
+{
+	pid_t sender;
+
+	(void)arg;
+
+	test_shmem_name(shmem_name, sizeof(shmem_name), "wrap");
+	primary_init(wrap_receive);
+
+	sender = test_spawn(wrap_sender, NULL);
+
+	CHECK(test_counter_wait(&received, WRAP_PACKETS, WAIT_MS));
+	CHECK(test_join(sender));
+
+	nrf_rpc_tr_shmem_uninit();
+}
+
+static void release_sender(void *arg)
+{
+	uint32_t seq;
+
+	(void)arg;
+
+	secondary_init(unexpected_receive);
+
+	for (seq = 0; seq < RELEASE_PACKETS; seq++) {
+		send_packet(RELEASE_LEN, seq);
+	}
+
+	nrf_rpc_tr_shmem_uninit();
+}
+
+/* Holds the first packet and frees the others, so they are released out of
+ * order.
+ */
+static void release_receive(const uint8_t *packet, size_t len)
+{
+	CHECK(len == RELEASE_LEN);
+	CHECK(packet_valid(packet, len, expected_seq));
+
+	if (expected_seq == 0) {
+		held_packet = packet;
+	} else {
+		nrf_rpc_tr_free_rx_buf(packet);
+	}
+
+	expected_seq++;
+	test_counter_inc(&received);
+}
+
+static void test_release_order(void *arg)
+{
+	pid_t sender;
+
+	(void)arg;
+
+	test_shmem_name(shmem_name, sizeof(shmem_name), "release");
+	primary_init(release_receive);
+
+	sender = test_spawn(release_sender, NULL);
+
+	/* The held entry must keep the ring full, even though the entries
+	 * after it were freed.
+	 */
+	CHECK(test_counter_wait(&received, RELEASE_FIT, WAIT_MS));
+	test_sleep_ms(100);
+	CHECK(test_counter_get(&received) == RELEASE_FIT);
+	CHECK(packet_valid(held_packet, RELEASE_LEN, 0));
+
+	nrf_rpc_tr_free_rx_buf(held_packet);
+
+	CHECK(test_counter_wait(&received, RELEASE_PACKETS, WAIT_MS));
+	CHECK(test_join(sender));
+
+	nrf_rpc_tr_shmem_uninit();
+}
+
+/* Creates the object and exits without removing it. */
+static void crashed_primary(void *arg)
+{
+	(void)arg;
+
+	primary_init(unexpected_receive);
+	_exit(0);
+}
+
+static void test_stale_object(void *arg)
+{
+	(void)arg;
+
+	test_shmem_name(shmem_name, sizeof(shmem_name), "stale");
+
+	CHECK(test_join(test_spawn(crashed_primary, NULL)));
+
+	nrf_rpc_tr_shmem_configure(shmem_name, NRF_RPC_TR_SHMEM_SECONDARY);
+	CHECK(nrf_rpc_tr_init(unexpected_receive) == -NRF_ETIMEDOUT);
+
+	shm_unlink(shmem_name);
+}
+
+static int exit_pipe[2];
+
+/* Keeps the connection until the test closes the pipe. */
+static void waiting_peer(void *arg)
+{
+	char c;
+
+	if (arg != NULL) {
+		secondary_init(unexpected_receive);
+	} else {
+		primary_init(unexpected_receive);
+	}
+
+	close(exit_pipe[1]);
+	CHECK(read(exit_pipe[0], &c, 1) == 0);
+
+	nrf_rpc_tr_shmem_uninit();
+}
+
+static void test_second_secondary(void *arg)
+{
+	pid_t primary;
+	pid_t secondary;
+
+	(void)arg;
+
+	test_shmem_name(shmem_name, sizeof(shmem_name), "second");
+	CHECK(pipe(exit_pipe) == 0);
+
+	primary = test_spawn(waiting_peer, NULL);
+	secondary = test_spawn(waiting_peer, (void *)1);
+
+	/* Give the first secondary side time to claim the object. */
+	test_sleep_ms(200);
+
+	nrf_rpc_tr_shmem_configure(shmem_name, NRF_RPC_TR_SHMEM_SECONDARY);
+	CHECK(nrf_rpc_tr_init(unexpected_receive) == -NRF_ETIMEDOUT);
+
+	close(exit_pipe[1]);
+
+	CHECK(test_join(secondary));
+	CHECK(test_join(primary));
+}
+
+int main(void)
+{
+	bool passed = true;
+
+	passed &= test_run("wrap", test_wrap);
+	passed &= test_run("release_order", test_release_order);
+	passed &= test_run("stale_object", test_stale_object);
+	passed &= test_run("second_secondary", test_second_secondary);
+
+	return passed ? 0 : 1;
+}
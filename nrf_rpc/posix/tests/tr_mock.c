@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tr_mock.h"
+#include "test_common.h"
+
+/* Maximum number of received packets tracked by the mock. */
+#define RX_MAX 256
+
+struct rx_packet {
+	const uint8_t *data;
+	uint32_t free_count;
+};
+
+struct sent_packet {
+	uint8_t data[TR_MOCK_SENT_LEN_MAX];
+	size_t len;
+};
+
+static nrf_rpc_tr_receive_handler_t receive_callback;
+
+static pthread_mutex_t mock_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t mock_cond = PTHREAD_COND_INITIALIZER;
+
+static struct rx_packet rx_packets[RX_MAX];
+static uint32_t rx_count;
+static uint32_t rx_free_total;
+
+static struct sent_packet sent_packets[TR_MOCK_SENT_MAX];
+static uint32_t sent_count;
+static uint32_t tx_free_total;
+static bool tx_hold;
+static uint32_t tx_held;
+
+int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback)
+{
+	receive_callback = callback;
+
+	return 0;
+}
+
+void nrf_rpc_tr_free_rx_buf(const uint8_t *packet)
+{
+	uint32_t i;
+
+	pthread_mutex_lock(&mock_mutex);
+
+	for (i = 0; i < rx_count; i++) {
+		if (rx_packets[i].data == packet) {
+			break;
+		}
+	}
+
+	/* Only whole received packets may be freed. */
+	CHECK(i < rx_count);
+
+	rx_packets[i].free_count++;
+	rx_free_total++;
+
+	pthread_mutex_unlock(&mock_mutex);
+}
+
+void nrf_rpc_tr_alloc_tx_buf(uint8_t **buf, size_t len)
+{
+	*buf = malloc(len);
+	CHECK(*buf != NULL);
+}
+
+void nrf_rpc_tr_free_tx_buf(uint8_t *buf)
+{
+	free(buf);
+
+	pthread_mutex_lock(&mock_mutex);
+	tx_free_total++;
+	pthread_cond_broadcast(&mock_cond);
+	pthread_mutex_unlock(&mock_mutex);
+}
+
+int nrf_rpc_tr_send(uint8_t *buf, size_t len)
+{
+	pthread_mutex_lock(&mock_mutex);
+
+	CHECK(sent_count < TR_MOCK_SENT_MAX);
+	CHECK(len <= TR_MOCK_SENT_LEN_MAX);
+
+	memcpy(sent_packets[sent_count].data, buf, len);
+	sent_packets[sent_count].len = len;
+	sent_count++;
+	pthread_cond_broadcast(&mock_cond);
+
+	tx_held++;
+	while (tx_hold) {
+		pthread_cond_wait(&mock_cond, &mock_mutex);
+	}
+	tx_held--;
+
+	pthread_mutex_unlock(&mock_mutex);
+
+	free(buf);
+
+	return 0;
+}
+
+const uint8_t *tr_mock_receive(const uint8_t *packet, size_t len)
+{
+	uint8_t *copy = malloc(len);
+
+	CHECK(copy != NULL);
+	memcpy(copy, packet, len);
+
+	pthread_mutex_lock(&mock_mutex);
+	CHECK(rx_count < RX_MAX);
+	rx_packets[rx_count].data = copy;
+	rx_packets[rx_count].free_count = 0;
+	rx_count++;
+	pthread_mutex_unlock(&mock_mutex);
+
+	receive_callback(copy, len);
+
+	return copy;
+}
+
+uint32_t tr_mock_rx_free_count(const uint8_t *packet)
+{
+	uint32_t count = 0;
+	uint32_t i;
+
+	pthread_mutex_lock(&mock_mutex);
+	for (i = 0; i < rx_count; i++) {
+		if (rx_packets[i].data == packet) {
+			count = rx_packets[i].free_count;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&mock_mutex);
+
+	return count;
+}
+
+uint32_t tr_mock_rx_free_total(void)
+{
+	uint32_t total;
+
+	pthread_mutex_lock(&mock_mutex);
+	total = rx_free_total;
+	pthread_mutex_unlock(&mock_mutex);
+
+	return total;
+}
+
+uint32_t tr_mock_tx_free_total(void)
+{
+	uint32_t total;
+
+	pthread_mutex_lock(&mock_mutex);
+	total = tx_free_total;
+	pthread_mutex_unlock(&mock_mutex);
+
+	return total;
+}
+
+bool tr_mock_sent_wait(uint32_t count, uint32_t timeout_ms)
+{
+	uint64_t deadline = test_time_us() + (uint64_t)timeout_ms * 1000;
+	bool reached;
+
+	while (true) {
+		pthread_mutex_lock(&mock_mutex);
+		reached = sent_count >= count;
+		pthread_mutex_unlock(&mock_mutex);
+
+		if (reached || test_time_us() >= deadline) {
+			return reached;
+		}
+
+		test_sleep_ms(1);
+	}
+}
+
+size_t tr_mock_sent_get(uint32_t index, const uint8_t **packet)
+{
+	size_t len;
+
+	pthread_mutex_lock(&mock_mutex);
+	CHECK(index < sent_count);
+	*packet = sent_packets[index].data;
+	len = sent_packets[index].len;
+	pthread_mutex_unlock(&mock_mutex);
+
+	return len;
+}
+
+void tr_mock_tx_hold(bool hold)
+{
+	pthread_mutex_lock(&mock_mutex);
+	tx_hold = hold;
+	pthread_cond_broadcast(&mock_cond);
+	pthread_mutex_unlock(&mock_mutex);
+}
+
+uint32_t tr_mock_tx_held(void)
+{
+	uint32_t held;
+
+	pthread_mutex_lock(&mock_mutex);
+	held = tx_held;
+	pthread_mutex_unlock(&mock_mutex);
+
+	return held;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TR_MOCK_H_
+#define TR_MOCK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/* Transport that records sent packets and lets the test inject received
+ * packets. Selected with CONFIG_NRF_RPC_TR_CUSTOM_INCLUDE="tr_mock.h".
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_RPC_TR_MAX_HEADER_SIZE 0
+
+#define NRF_RPC_TR_AUTO_FREE_RX_BUF 0
+
+/* Maximum number of sent packets kept by the mock. */
+#define TR_MOCK_SENT_MAX 256
+
+/* Maximum length of a sent packet kept by the mock. */
+#define TR_MOCK_SENT_LEN_MAX 256
+
+typedef void (*nrf_rpc_tr_receive_handler_t)(const uint8_t *packet, size_t len);
+
+int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback);
+
+void nrf_rpc_tr_free_rx_buf(const uint8_t *packet);
+
+void nrf_rpc_tr_alloc_tx_buf(uint8_t **buf, size_t len);
+
+void nrf_rpc_tr_free_tx_buf(uint8_t *buf);
+
+int nrf_rpc_tr_send(uint8_t *buf, size_t len);
+
+/** @brief Pass a copy of the packet to nRF RPC as a received packet.
+ *
+ * The copy is never reused, so it identifies the packet in
+ * @ref tr_mock_rx_free_count even after it was freed.
+ *
+ * @return Pointer to the copy.
+ */
+const uint8_t *tr_mock_receive(const uint8_t *packet, size_t len);
+
+/** @brief Number of times the received packet was freed. */
+uint32_t tr_mock_rx_free_count(const uint8_t *packet);
+
+/** @brief Number of received packets freed in total. */
+uint32_t tr_mock_rx_free_total(void);
+
+/** @brief Number of transmit buffers freed without sending. */
+uint32_t tr_mock_tx_free_total(void);
+
+/** @brief Wait until the number of sent packets reaches the count.
+ *
+ * @return true if the count was reached before the timeout.
+ */
+bool tr_mock_sent_wait(uint32_t count, uint32_t timeout_ms);
+
+/** @brief Get a copy of a sent packet.
+ *
+ * @return Length of the packet.
+ */
+size_t tr_mock_sent_get(uint32_t index, const uint8_t **packet);
+
+/** @brief Block senders in @ref nrf_rpc_tr_send until released.
+ *
+ * @param hold Block the senders if true, release them otherwise.
+ */
+void tr_mock_tx_hold(bool hold);
+
+/** @brief Number of senders blocked in @ref nrf_rpc_tr_send. */
+uint32_t tr_mock_tx_held(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TR_MOCK_H_ */
@@ -32,6 +32,9 @@ struct nrf_rpc_os_event;
 /** @brief Structure to pass messages between threads. */
 struct nrf_rpc_os_msg;
 
+/* Forward declaration. */
+struct nrf_rpc_lane_stats;
+
 /** @brief Work callback that will be called from thread pool.
  *
  * @param data Data passed from @ref nrf_rpc_os_thread_pool_send.
@@ -60,6 +63,38 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback);
  */
 void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len);
 
+/** @brief Send work to a priority lane of a thread pool.
+ *
+ * Used instead of @ref nrf_rpc_os_thread_pool_send when
+ * @option{CONFIG_NRF_RPC_PRIO_LANES} is greater than 1. Each lane has its own
+ * queue. When a thread becomes available it takes work from the highest
+ * priority lane that is not empty. To avoid starvation, a lower priority lane
+ * is served after @option{CONFIG_NRF_RPC_PRIO_BURST} consecutive works from
+ * higher priority lanes while it was waiting.
+ *
+ * @param data Data pointer to pass. Data is passed as a pointer, no copying is
+ *             done.
+ * @param len  Length of the `data`.
+ * @param lane Lane number, 0 is the highest priority.
+ */
+void nrf_rpc_os_thread_pool_send_prio(const uint8_t *data, size_t len,
+				      uint8_t lane);
+
+/** @brief Get queueing statistics of a thread pool lane.
+ *
+ * Required only when @option{CONFIG_NRF_RPC_PRIO_LANES} is greater than 1.
+ *
+ * @param      lane  Lane number.
+ * @param[out] stats Statistics of the lane.
+ */
+void nrf_rpc_os_lane_stats_get(uint8_t lane, struct nrf_rpc_lane_stats *stats);
+
+/** @brief Reset queueing statistics of all thread pool lanes.
+ *
+ * Required only when @option{CONFIG_NRF_RPC_PRIO_LANES} is greater than 1.
+ */
+void nrf_rpc_os_lane_stats_reset(void);
+
 /** @brief Initialize event passing structure.
  *
  * @param event Event structure to initialize.
@@ -171,6 +206,24 @@ void nrf_rpc_os_remote_reserve();
  */
 void nrf_rpc_os_remote_release();
 
+/** @brief Reserve one thread from a remote thread pool for a priority lane.
+ *
+ * Used instead of @ref nrf_rpc_os_remote_reserve when
+ * @option{CONFIG_NRF_RPC_PRIO_LANES} is greater than 1. Lanes other than 0
+ * cannot reserve the last @option{CONFIG_NRF_RPC_PRIO_RESERVED_REMOTE_THREADS}
+ * remote threads, so the highest priority lane always finds a free thread
+ * on the remote side.
+ *
+ * @param lane Lane number, 0 is the highest priority.
+ */
+void nrf_rpc_os_remote_reserve_prio(uint8_t lane);
+
+/** @brief Release one thread reserved by @ref nrf_rpc_os_remote_reserve_prio.
+ *
+ * @param lane Lane number used to reserve the thread.
+ */
+void nrf_rpc_os_remote_release_prio(uint8_t lane);
+
 #ifdef __cplusplus
 }
 #endif
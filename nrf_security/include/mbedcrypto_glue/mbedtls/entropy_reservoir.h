@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**@file
+ * @addtogroup mbedcrypto_glue_entropy_reservoir
+ * @{
+ */
+#ifndef MBEDTLS_ENTROPY_RESERVOIR_H
+#define MBEDTLS_ENTROPY_RESERVOIR_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ENTROPY_RESERVOIR)
+
+/** @brief Top up the hardware entropy reservoir.
+ *
+ * Reads the hardware entropy source until the reservoir of
+ * MBEDTLS_ENTROPY_RESERVOIR_SIZE bytes is full, so that later calls to
+ * mbedtls_entropy_func() can be served without waiting for the TRNG.
+ * The entropy accumulator falls back to reading the hardware directly when
+ * the reservoir is empty.
+ *
+ * Intended to be called from a low priority context, for example the idle
+ * hook or a work item. The hardware source may block, so the function must
+ * not be called from an interrupt. Concurrent calls return immediately.
+ *
+ * @note A failure of the hardware source, including a failed health test,
+ *       is reported to the next consumer of the reservoir, which then
+ *       discards all buffered entropy.
+ *
+ * @return 0 on success, or the error returned by the hardware entropy source.
+ */
+int mbedtls_entropy_reservoir_fill( void );
+
+#endif /* MBEDTLS_ENTROPY_RESERVOIR */
+
+#endif /* MBEDTLS_ENTROPY_RESERVOIR_H */
+
+/** @} */
@@ -60,8 +60,179 @@
 #include "mbedtls/havege.h"
 #endif
 
+#if defined(MBEDTLS_ENTROPY_RESERVOIR)
+#include "entropy_reservoir.h"
+#include <stdint.h>
+#endif
+
 #define ENTROPY_MAX_LOOP    256     /**< Maximum amount to loop before error */
 
+#if defined(MBEDTLS_ENTROPY_RESERVOIR)
+
+#if !defined(MBEDTLS_ENTROPY_HARDWARE_ALT)
+#error "MBEDTLS_ENTROPY_RESERVOIR requires MBEDTLS_ENTROPY_HARDWARE_ALT"
+#endif
+
+#if ( MBEDTLS_ENTROPY_RESERVOIR_SIZE & ( MBEDTLS_ENTROPY_RESERVOIR_SIZE - 1 ) ) != 0
+#error "MBEDTLS_ENTROPY_RESERVOIR_SIZE must be a power of two"
+#endif
+
+#define RESERVOIR_MASK      ( MBEDTLS_ENTROPY_RESERVOIR_SIZE - 1 )
+
+#define RESERVOIR_LOAD( x )         __atomic_load_n( &( x ), __ATOMIC_ACQUIRE )
+#define RESERVOIR_STORE( x, v )     __atomic_store_n( &( x ), ( v ), __ATOMIC_RELEASE )
+
+/*
+ * Reservoir of raw output from the hardware entropy source, filled ahead of
+ * time by mbedtls_entropy_reservoir_fill(). It is a single-producer,
+ * single-consumer ring with free-running indices: the filler is the only
+ * writer of reservoir_head and the consumer the only writer of
+ * reservoir_tail. Concurrent fillers or consumers are turned away by the
+ * busy flags instead of waiting for each other.
+ */
+static unsigned char reservoir[MBEDTLS_ENTROPY_RESERVOIR_SIZE];
+static uint32_t reservoir_head;
+static uint32_t reservoir_tail;
+static int reservoir_error;
+static unsigned char reservoir_filling;
+static unsigned char reservoir_draining;
+
+int mbedtls_entropy_reservoir_fill( void )
+{
+    uint32_t head, space;
+    size_t chunk, olen;
+    int ret = 0;
+
+    if( __atomic_test_and_set( &reservoir_filling, __ATOMIC_ACQUIRE ) )
+        return( 0 );
+
+    head = reservoir_head;
+    space = MBEDTLS_ENTROPY_RESERVOIR_SIZE -
+            ( head - RESERVOIR_LOAD( reservoir_tail ) );
+
+    while( space > 0 )
+    {
+        /*
+         * Read straight into the free part of the ring, in small chunks so
+         * that a consumer falling back to the hardware is not held up for
+         * long behind the filler.
+         */
+        chunk = MBEDTLS_ENTROPY_RESERVOIR_SIZE - ( head & RESERVOIR_MASK );
+        if( chunk > space )
+            chunk = space;
+        if( chunk > MBEDTLS_ENTROPY_BLOCK_SIZE )
+            chunk = MBEDTLS_ENTROPY_BLOCK_SIZE;
+
+        olen = 0;
+        ret = mbedtls_hardware_poll( NULL, &reservoir[head & RESERVOIR_MASK],
+                                     chunk, &olen );
+        if( ret != 0 )
+        {
+            /*
+             * Leave the error, e.g. a failed health test, for the consumer,
+             * which discards everything buffered so far.
+             */
+            mbedtls_platform_zeroize( &reservoir[head & RESERVOIR_MASK], chunk );
+            RESERVOIR_STORE( reservoir_error, ret );
+            break;
+        }
+
+        if( olen == 0 )
+            break;
+        if( olen > chunk )
+            olen = chunk;
+
+        head += olen;
+        space -= olen;
+
+        /* Publish the bytes only after they are written */
+        RESERVOIR_STORE( reservoir_head, head );
+    }
+
+    __atomic_clear( &reservoir_filling, __ATOMIC_RELEASE );
+
+    return( ret );
+}
+
+/*
+ * Copy out and wipe len bytes starting at the tail of the reservoir.
+ * output may be NULL to only discard them.
+ */
+static void entropy_reservoir_take( uint32_t tail, unsigned char *output,
+                                    size_t len )
+{
+    size_t offset = tail & RESERVOIR_MASK;
+    size_t first = MBEDTLS_ENTROPY_RESERVOIR_SIZE - offset;
+
+    if( first > len )
+        first = len;
+
+    if( output != NULL )
+    {
+        memcpy( output, &reservoir[offset], first );
+        memcpy( output + first, reservoir, len - first );
+    }
+
+    mbedtls_platform_zeroize( &reservoir[offset], first );
+    mbedtls_platform_zeroize( reservoir, len - first );
+}
+
+/*
+ * Entropy source serving the hardware entropy from the reservoir. Only when
+ * the reservoir is empty, or another context is draining it, is the
+ * hardware polled synchronously.
+ */
+static int entropy_reservoir_poll( void *data, unsigned char *output,
+                                   size_t len, size_t *olen )
+{
+    uint32_t head, tail;
+    size_t avail;
+    int ret;
+
+    if( __atomic_test_and_set( &reservoir_draining, __ATOMIC_ACQUIRE ) )
+        return( mbedtls_hardware_poll( data, output, len, olen ) );
+
+    /*
+     * Take the error before loading the head: the filler stores the error
+     * after publishing the last bytes of the failed fill, so the head loaded
+     * afterwards covers all of them and none is handed out later.
+     */
+    ret = __atomic_exchange_n( &reservoir_error, 0, __ATOMIC_ACQUIRE );
+
+    tail = reservoir_tail;
+    head = RESERVOIR_LOAD( reservoir_head );
+
+    if( ret != 0 )
+    {
+        /* Never hand out entropy buffered around a source failure */
+        entropy_reservoir_take( tail, NULL, head - tail );
+        RESERVOIR_STORE( reservoir_tail, head );
+        __atomic_clear( &reservoir_draining, __ATOMIC_RELEASE );
+        return( ret );
+    }
+
+    avail = head - tail;
+    if( avail > len )
+        avail = len;
+
+    if( avail > 0 )
+    {
+        entropy_reservoir_take( tail, output, avail );
+        RESERVOIR_STORE( reservoir_tail, tail + (uint32_t) avail );
+    }
+
+    __atomic_clear( &reservoir_draining, __ATOMIC_RELEASE );
+
+    if( avail == 0 )
+        return( mbedtls_hardware_poll( data, output, len, olen ) );
+
+    *olen += avail;
+
+    return( 0 );
+}
+
+#endif /* MBEDTLS_ENTROPY_RESERVOIR */
+
 void mbedtls_entropy_init( mbedtls_entropy_context *ctx )
 {
     ctx->source_count = 0;
@@ -107,10 +278,16 @@ void mbedtls_entropy_init( mbedtls_entropy_context *ctx )
 #endif
 #if defined(MBEDTLS_ENTROPY_HARDWARE_ALT)
     /* CC310: Adding ctx as third argument instead of NULL */
+#if defined(MBEDTLS_ENTROPY_RESERVOIR)
+    mbedtls_entropy_add_source( ctx, entropy_reservoir_poll, ctx,
+                                MBEDTLS_ENTROPY_MIN_HARDWARE,
+                                MBEDTLS_ENTROPY_SOURCE_STRONG );
+#else
     mbedtls_entropy_add_source( ctx, mbedtls_hardware_poll, ctx,
                                 MBEDTLS_ENTROPY_MIN_HARDWARE,
                                 MBEDTLS_ENTROPY_SOURCE_STRONG );
 #endif
+#endif
 #if defined(MBEDTLS_ENTROPY_NV_SEED)
     mbedtls_entropy_add_source( ctx, mbedtls_nv_seed_poll, NULL,
                                 MBEDTLS_ENTROPY_BLOCK_SIZE,
@@ -90,6 +90,28 @@ static void mbedtls_mpi_zeroize( mbedtls_mpi_uint *v, size_t n )
 }
 
 
+/* Load a limb from little endian bytes, without alignment requirements. */
+static mbedtls_mpi_uint mpi_uint_read_le( const unsigned char *buf )
+{
+    mbedtls_mpi_uint x = 0;
+    size_t i;
+
+    for( i = 0; i < ciL; i++ )
+        x |= ( (mbedtls_mpi_uint) buf[i] ) << ( i << 3 );
+
+    return( x );
+}
+
+/* Store a limb as little endian bytes, without alignment requirements. */
+static void mpi_uint_write_le( unsigned char *buf, mbedtls_mpi_uint x )
+{
+    size_t i;
+
+    for( i = 0; i < ciL; i++ )
+        buf[i] = (unsigned char)( x >> ( i << 3 ) );
+}
+
+
 /*
  * Import X from unsigned binary data, little endian
  */
@@ -100,17 +122,19 @@ int mbedtls_mpi_read_binary_le( mbedtls_mpi *X,
     size_t i;
     size_t const limbs = CHARS_TO_LIMBS( buflen );
 
-    /* Ensure that target MPI has exactly the necessary number of limbs */
-    if( X->n != limbs )
-    {
-        mbedtls_mpi_free( X );
-        mbedtls_mpi_init( X );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, limbs ) );
-    }
-
+    /*
+     * Reuse the limbs of X if there are enough of them. The backend converts
+     * fixed-size (e.g. 256-bit) values back and forth on every operation, so
+     * freeing and reallocating here would cost a heap round trip per call.
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, limbs ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
 
-    for( i = 0; i < buflen; i++ )
+    /* Whole limbs first, then the trailing bytes of a partial limb. */
+    for( i = 0; i + ciL <= buflen; i += ciL )
+        X->p[i / ciL] = mpi_uint_read_le( buf + i );
+
+    for( ; i < buflen; i++ )
         X->p[i / ciL] |= ((mbedtls_mpi_uint) buf[i]) << ((i % ciL) << 3);
 
 cleanup:
@@ -150,7 +174,10 @@ int mbedtls_mpi_write_binary_le( const mbedtls_mpi *X,
         }
     }
 
-    for( i = 0; i < bytes_to_copy; i++ )
+    for( i = 0; i + ciL <= bytes_to_copy; i += ciL )
+        mpi_uint_write_le( buf + i, X->p[i / ciL] );
+
+    for( ; i < bytes_to_copy; i++ )
         buf[i] = GET_BYTE( X, i );
 
     if( stored_bytes < buflen )
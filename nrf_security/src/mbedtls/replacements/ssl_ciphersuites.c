@@ -2225,6 +2225,44 @@ static const mbedtls_ssl_ciphersuite_t ciphersuite_definitions[] =
       0, 0, 0, 0, 0 }
 };
 
+/*
+ * Indices of ciphersuite_definitions sorted by ciphersuite ID, so that
+ * mbedtls_ssl_ciphersuite_from_id() is a binary search instead of a scan
+ * over the whole table. Built on first use, like the supported list below.
+ */
+#define NUM_CIPHERSUITE_DEFINITIONS ( sizeof( ciphersuite_definitions     ) / \
+                                      sizeof( ciphersuite_definitions[0]  ) - 1 )
+static uint16_t ciphersuite_index[NUM_CIPHERSUITE_DEFINITIONS + 1];
+static int ciphersuite_index_init = 0;
+
+static void ciphersuite_index_build( void )
+{
+    size_t i, j, rank;
+
+    /*
+     * Every entry is written straight to its final position, so a concurrent
+     * first call can only ever store the same values.
+     */
+    for( i = 0; i < NUM_CIPHERSUITE_DEFINITIONS; i++ )
+    {
+        rank = 0;
+
+        for( j = 0; j < NUM_CIPHERSUITE_DEFINITIONS; j++ )
+        {
+            if( ciphersuite_definitions[j].id < ciphersuite_definitions[i].id ||
+                ( ciphersuite_definitions[j].id == ciphersuite_definitions[i].id &&
+                  j < i ) )
+            {
+                rank++;
+            }
+        }
+
+        ciphersuite_index[rank] = (uint16_t) i;
+    }
+
+    ciphersuite_index_init = 1;
+}
+
 #if defined(MBEDTLS_SSL_CIPHERSUITES)
 const int *mbedtls_ssl_list_ciphersuites( void )
 {
@@ -2290,17 +2328,30 @@ const mbedtls_ssl_ciphersuite_t *mbedtls_ssl_ciphersuite_from_string(
 
 const mbedtls_ssl_ciphersuite_t *mbedtls_ssl_ciphersuite_from_id( int ciphersuite )
 {
-    const mbedtls_ssl_ciphersuite_t *cur = ciphersuite_definitions;
+    const mbedtls_ssl_ciphersuite_t *cur;
+    size_t low = 0;
+    size_t high = NUM_CIPHERSUITE_DEFINITIONS;
+    size_t mid;
 
-    while( cur->id != 0 )
+    if( ciphersuite_index_init == 0 )
+        ciphersuite_index_build();
+
+    while( low < high )
     {
-        if( cur->id == ciphersuite )
-            return( cur );
+        mid = low + ( high - low ) / 2;
 
-        cur++;
+        if( ciphersuite_definitions[ciphersuite_index[mid]].id < ciphersuite )
+            low = mid + 1;
+        else
+            high = mid;
     }
 
-    return( NULL );
+    if( low == NUM_CIPHERSUITE_DEFINITIONS )
+        return( NULL );
+
+    cur = &ciphersuite_definitions[ciphersuite_index[low]];
+
+    return( cur->id == ciphersuite ? cur : NULL );
 }
 
 const char *mbedtls_ssl_get_ciphersuite_name( const int ciphersuite_id )
@@ -9,6 +9,7 @@
 
 #include "zboss_api.h"
 
+#include "zcl/zb_zcl_attr_index_addons.h"
 #include "zcl/zb_zcl_basic_addons.h"
 #include "zcl/zb_zcl_color_control_addons.h"
 #include "zcl/zb_zcl_door_lock_addons.h"
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef ZB_ZCL_ATTR_INDEX_ADDONS_H__
+#define ZB_ZCL_ATTR_INDEX_ADDONS_H__
+
+#include "zboss_api.h"
+
+/*! \addtogroup zb_zcl_attr_index_addons */
+/*! @{ */
+
+#if defined(CONFIG_ZIGBEE_ZCL_ATTR_INDEX) || defined(DOXYGEN)
+
+/**@brief Build the attribute descriptor index for the registered device context.
+ *
+ * The index maps (endpoint, cluster ID, cluster role, attribute ID) to the attribute descriptor,
+ * so that @ref zb_zcl_attr_index_get_desc does not have to walk the endpoint, cluster and
+ * attribute lists. The index points into the lists of @p device_ctx, so it has to be rebuilt
+ * whenever another device context is registered.
+ *
+ * @param[IN]  device_ctx  Pointer to the device context passed to @ref ZB_AF_REGISTER_DEVICE_CTX.
+ *
+ * @retval RET_OK         Index was built.
+ * @retval RET_NO_MEMORY  Device context has more clusters or attributes than
+ *                        CONFIG_ZIGBEE_ZCL_ATTR_INDEX_CLUSTERS or CONFIG_ZIGBEE_ZCL_ATTR_INDEX_SIZE.
+ *                        The index is left empty and all lookups fall back to
+ *                        @ref zb_zcl_get_attr_desc_a.
+ */
+zb_ret_t zb_zcl_attr_index_build(zb_af_device_ctx_t *device_ctx);
+
+/**@brief Function equivalent to @ref zb_zcl_get_attr_desc_a, but resolved through the attribute
+ *        descriptor index in O(log n).
+ *
+ * Lookups not covered by the index, for example with @ref ZB_ZCL_CLUSTER_ANY_ROLE, fall back
+ * to @ref zb_zcl_get_attr_desc_a.
+ *
+ * @param[IN]  ep            Endpoint number.
+ * @param[IN]  cluster_id    Cluster ID.
+ * @param[IN]  cluster_role  Cluster role, see @ref zcl_cluster_role.
+ * @param[IN]  attr_id       Attribute ID.
+ *
+ * @return Pointer to the attribute descriptor or NULL if the attribute does not exist.
+ */
+zb_zcl_attr_t *zb_zcl_attr_index_get_desc(zb_uint8_t ep, zb_uint16_t cluster_id,
+                                          zb_uint8_t cluster_role, zb_uint16_t attr_id);
+
+#else
+
+#define zb_zcl_attr_index_build(device_ctx)  (ZVUNUSED(device_ctx), RET_OK)
+#define zb_zcl_attr_index_get_desc           zb_zcl_get_attr_desc_a
+
+#endif /* CONFIG_ZIGBEE_ZCL_ATTR_INDEX */
+
+/**@brief Macro equivalent to @ref ZB_AF_REGISTER_DEVICE_CTX, which also builds the attribute
+ *        descriptor index for the device context.
+ *
+ * @param[IN]  _device_ctx  Pointer to the device context.
+ */
+#define ZB_AF_REGISTER_DEVICE_CTX_INDEXED(_device_ctx)  \
+do                                                      \
+{                                                       \
+  ZB_AF_REGISTER_DEVICE_CTX(_device_ctx);               \
+  ZVUNUSED(zb_zcl_attr_index_build(_device_ctx));       \
+} while (0)
+
+/** @} */
+
+#endif /* ZB_ZCL_ATTR_INDEX_ADDONS_H__ */
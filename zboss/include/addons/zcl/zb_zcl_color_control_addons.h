@@ -8,6 +8,7 @@
 #define ZB_ZCL_COLOR_CONTROL_ADDONS_H__
 
 #include "zboss_api.h"
+#include "zb_zcl_attr_index_addons.h"
 
 /*! \addtogroup zb_zcl_color_control_addons */
 /*! @{ */
@@ -112,6 +113,27 @@ typedef struct
                                 dst_ep, ep, prfl_id, ZB_ZCL_CLUSTER_ID_COLOR_CONTROL, cb, 0);       \
 }
 
+/**@brief Macro equivalent to @ref ZB_ZCL_COLOR_CONTROL_COPY_ATTRIBUTE_16, but attribute
+ *        descriptors are resolved through the attribute descriptor index.
+ *
+ * @param[IN]  endpoint      Device endpoint.
+ * @param[IN]  attr_id_to    Destination attribute ID.
+ * @param[IN]  attr_id_from  Source attribute ID.
+ */
+#define ZB_ZCL_COLOR_CONTROL_COPY_ATTRIBUTE_16_INDEXED(endpoint, attr_id_to, attr_id_from)  \
+{                                                                                           \
+  zb_uint16_t value;                                                                        \
+  zb_zcl_attr_t * attr_desc = zb_zcl_attr_index_get_desc((endpoint),                        \
+      ZB_ZCL_CLUSTER_ID_COLOR_CONTROL, ZB_ZCL_CLUSTER_SERVER_ROLE, (attr_id_from));         \
+  ZB_ASSERT(attr_desc);                                                                     \
+  value = ZB_ZCL_GET_ATTRIBUTE_VAL_16(attr_desc);                                           \
+                                                                                            \
+  attr_desc = zb_zcl_attr_index_get_desc((endpoint),                                        \
+      ZB_ZCL_CLUSTER_ID_COLOR_CONTROL, ZB_ZCL_CLUSTER_SERVER_ROLE, (attr_id_to));           \
+  ZB_ASSERT(attr_desc);                                                                     \
+  ZB_ZCL_SET_DIRECTLY_ATTR_VAL16(attr_desc, value);                                         \
+}
+
 /** @} */
 
 #endif /* ZB_ZCL_COLOR_CONTROL_ADDONS_H__ */
@@ -89,6 +89,7 @@ void zb_macll_trans_set_rx_on_off(int rx_on);
  * @retval[1]  New packet copied to the buf.
  */
 #define zb_macll_get_next_packet      zb_trans_get_next_packet
+#define zb_macll_get_next_packets     zb_trans_get_next_packets
 
 int8_t zb_macll_metadata_get_power(zb_bufid_t bufid);
 void zb_macll_metadata_set_power(zb_bufid_t bufid, int8_t power);
@@ -212,7 +212,7 @@ do
   (entries_written) = ZB_RING_BUFFER_LINEAR_PORTION((rb), (size));                   \
   ZB_MEMCPY((rb)->ring_buf + (rb)->write_i, (data), (entries_written));              \
   (rb)->written += (entries_written);                                                \
-  (rb)->write_i = ((rb)->write_i + (entries_written) % ZB_RING_BUFFER_CAPACITY(rb)); \
+  (rb)->write_i = (((rb)->write_i + (entries_written)) % ZB_RING_BUFFER_CAPACITY(rb)); \
 } while(ZB_FALSE)
 
 /**
@@ -415,6 +415,227 @@ do
   )
 
 
+/**
+   \par Single-producer, single-consumer ring buffer macros
+
+   Variant of the ring buffer without the shared @p written counter.
+   The producer modifies only write_i and the consumer modifies only read_i,
+   so one producer and one consumer (for example an ISR and a task) can
+   access the ring buffer concurrently without a critical section.
+   One slot is always kept free to tell a full ring buffer from an empty one,
+   so the ring buffer holds up to capacity - 1 entries.
+
+   Macros marked as producer side may be called by the producer only,
+   macros marked as consumer side may be called by the consumer only.
+ */
+
+#ifndef ZB_RING_BUFFER_LOAD_ACQUIRE
+#if defined __GNUC__
+/**
+   Load ring buffer index with acquire semantics.
+   Entries published before the index was stored are visible after the load.
+ */
+#define ZB_RING_BUFFER_LOAD_ACQUIRE(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+/**
+   Store ring buffer index with release semantics.
+   Entries written before the store are visible to the other side after it
+   loads the index.
+ */
+#define ZB_RING_BUFFER_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#error Define ZB_RING_BUFFER_LOAD_ACQUIRE and ZB_RING_BUFFER_STORE_RELEASE for this compiler
+#endif
+#endif /* ZB_RING_BUFFER_LOAD_ACQUIRE */
+
+/**
+   Declare SPSC ring buffer for entries of given type and capacity.
+   This is typedef, not variable declaration.
+
+   The layout of read_i, write_i and ring_buf is the same as in the ring
+   buffer declared with ZB_RING_BUFFER_DECLARE(), so ZB_RING_BUFFER_CAPACITY()
+   and ZB_RING_BUFFER_LINEAR_PORTION() can be used with it.
+
+   @param type_name_prefix - prefix for names (like xxx_s, xxx_t)
+   @param ent_type - type of the ring buffer entry
+   @param capacity - ring buffer capacity
+ */
+#define ZB_RING_BUFFER_SPSC_DECLARE(type_name_prefix, ent_type, capacity) \
+typedef struct type_name_prefix ## _s                                     \
+{                                                                         \
+  zb_ushort_t    read_i;                                                  \
+  zb_ushort_t    write_i;                                                 \
+  ent_type       ring_buf[capacity];                                      \
+} type_name_prefix ## _t
+
+/**
+ * Initialize SPSC ring buffer internals.
+ * Must not be called while the producer or the consumer uses the ring buffer.
+ */
+#define ZB_RING_BUFFER_SPSC_INIT(rb) ( (rb)->read_i = (rb)->write_i = 0U)
+
+/**
+ * Return number of entries available for reading. Consumer side.
+ *
+ * @param rb - ring buffer pointer.
+ */
+#define ZB_RING_BUFFER_SPSC_USED_SPACE(rb)                                    \
+(                                                                             \
+  ((zb_uint_t)ZB_RING_BUFFER_LOAD_ACQUIRE(&(rb)->write_i)                     \
+   + ZB_RING_BUFFER_CAPACITY(rb) - (rb)->read_i) % ZB_RING_BUFFER_CAPACITY(rb) \
+  )
+
+/**
+ * Return free space available in the ring buffer. Producer side.
+ *
+ * @param rb - ring buffer pointer.
+ */
+#define ZB_RING_BUFFER_SPSC_FREE_SPACE(rb)                                    \
+(                                                                             \
+  ZB_RING_BUFFER_CAPACITY(rb) - 1U                                            \
+  - ((zb_uint_t)(rb)->write_i + ZB_RING_BUFFER_CAPACITY(rb)                   \
+     - ZB_RING_BUFFER_LOAD_ACQUIRE(&(rb)->read_i)) % ZB_RING_BUFFER_CAPACITY(rb) \
+  )
+
+/**
+ * Return 1 if ring buffer is empty. Consumer side.
+ *
+ * @param rb - ring buffer pointer.
+ */
+#define ZB_RING_BUFFER_SPSC_IS_EMPTY(rb) \
+  (ZB_RING_BUFFER_LOAD_ACQUIRE(&(rb)->write_i) == (rb)->read_i)
+
+/**
+ * Return 1 if ring buffer is full. Producer side.
+ *
+ * @param rb - ring buffer pointer.
+ */
+#define ZB_RING_BUFFER_SPSC_IS_FULL(rb)                                       \
+  ((((rb)->write_i + 1U) % ZB_RING_BUFFER_CAPACITY(rb))                       \
+   == ZB_RING_BUFFER_LOAD_ACQUIRE(&(rb)->read_i))
+
+/**
+ * Reserve slot in the ring buffer but do not update pointers. Producer side.
+ *
+ * @param rb -  ring buffer pointer.
+ * @return Pointer to the ring buffer entry or NULL if ring buffer is full
+ */
+#define ZB_RING_BUFFER_SPSC_PUT_RESERVE(rb)     \
+(                                               \
+  ZB_RING_BUFFER_SPSC_IS_FULL(rb) ? NULL        \
+  : (rb)->ring_buf + (rb)->write_i              \
+  )
+
+/**
+ * Publish the entry filled in after ZB_RING_BUFFER_SPSC_PUT_RESERVE().
+ * Producer side.
+ *
+ * @param rb -  ring buffer pointer.
+ * @return nothing
+ */
+#define ZB_RING_BUFFER_SPSC_FLUSH_PUT(rb)                                    \
+  ZB_RING_BUFFER_STORE_RELEASE(&(rb)->write_i,                               \
+    (zb_ushort_t)(((rb)->write_i + 1U) % ZB_RING_BUFFER_CAPACITY(rb)))
+
+/**
+ * Get entry from the ring buffer read pointer position. Consumer side.
+ *
+ * @param rb -  ring buffer pointer.
+ *
+ * @return pointer to the ring buffer entry or NULL if it is empty
+ */
+#define ZB_RING_BUFFER_SPSC_PEEK(rb)            \
+(                                               \
+  ZB_RING_BUFFER_SPSC_IS_EMPTY(rb) ? NULL       \
+  : (rb)->ring_buf + (rb)->read_i               \
+  )
+
+/**
+ * Release the entry got by ZB_RING_BUFFER_SPSC_PEEK() back to the producer.
+ * Consumer side.
+ *
+ * @param rb -  ring buffer pointer.
+ * @return nothing
+ */
+#define ZB_RING_BUFFER_SPSC_FLUSH_GET(rb)                                    \
+  ZB_RING_BUFFER_STORE_RELEASE(&(rb)->read_i,                                \
+    (zb_ushort_t)(((rb)->read_i + 1U) % ZB_RING_BUFFER_CAPACITY(rb)))
+
+/**
+   Return amount of data which can be got from ring buffer starting from read_i
+   without wrapping around.
+
+   @param rb - ring buffer pointer
+   @param size - requested data size
+ */
+#define ZB_RING_BUFFER_SPSC_GET_LINEAR_PORTION(rb, size) \
+(                                                        \
+  ZB_RING_BUFFER_CAPACITY(rb) - (rb)->read_i < (size) ?  \
+  ZB_RING_BUFFER_CAPACITY(rb) - (rb)->read_i : (size)    \
+  )
+
+/**
+   Put up to @p size entries into the ring buffer. Producer side.
+
+   Entries are copied with at most two memcpy calls, one for each linear
+   portion of the ring buffer, and published with a single index update.
+
+   @param rb - ring buffer pointer
+   @param data - pointer to the array of entries to put
+   @param size - number of entries to put
+   @param entries_written - (out) number of entries put, less than @p size
+                            if the ring buffer is full
+ */
+#define ZB_RING_BUFFER_SPSC_PUT_N(rb, data, size, entries_written)               \
+do                                                                               \
+{                                                                                \
+  zb_uint_t rb_n_ = ZB_RING_BUFFER_SPSC_FREE_SPACE(rb);                          \
+  zb_uint_t rb_lin_;                                                             \
+  if (rb_n_ > (zb_uint_t)(size))                                                 \
+  {                                                                              \
+    rb_n_ = (size);                                                              \
+  }                                                                              \
+  rb_lin_ = ZB_RING_BUFFER_LINEAR_PORTION((rb), rb_n_);                          \
+  ZB_MEMCPY((rb)->ring_buf + (rb)->write_i, (data),                              \
+            rb_lin_ * sizeof((rb)->ring_buf[0]));                                \
+  ZB_MEMCPY((rb)->ring_buf, (data) + rb_lin_,                                    \
+            (rb_n_ - rb_lin_) * sizeof((rb)->ring_buf[0]));                      \
+  ZB_RING_BUFFER_STORE_RELEASE(&(rb)->write_i,                                   \
+    (zb_ushort_t)(((rb)->write_i + rb_n_) % ZB_RING_BUFFER_CAPACITY(rb)));       \
+  (entries_written) = rb_n_;                                                     \
+} while(ZB_FALSE)
+
+/**
+   Get up to @p size entries from the ring buffer. Consumer side.
+
+   Entries are copied with at most two memcpy calls, one for each linear
+   portion of the ring buffer, and released with a single index update.
+
+   @param rb - ring buffer pointer
+   @param data - pointer to the array to copy entries to
+   @param size - maximum number of entries to get
+   @param entries_read - (out) number of entries got, less than @p size
+                         if the ring buffer runs empty
+ */
+#define ZB_RING_BUFFER_SPSC_GET_N(rb, data, size, entries_read)                  \
+do                                                                               \
+{                                                                                \
+  zb_uint_t rb_n_ = ZB_RING_BUFFER_SPSC_USED_SPACE(rb);                          \
+  zb_uint_t rb_lin_;                                                             \
+  if (rb_n_ > (zb_uint_t)(size))                                                 \
+  {                                                                              \
+    rb_n_ = (size);                                                              \
+  }                                                                              \
+  rb_lin_ = ZB_RING_BUFFER_SPSC_GET_LINEAR_PORTION((rb), rb_n_);                 \
+  ZB_MEMCPY((data), (rb)->ring_buf + (rb)->read_i,                               \
+            rb_lin_ * sizeof((rb)->ring_buf[0]));                                \
+  ZB_MEMCPY((data) + rb_lin_, (rb)->ring_buf,                                    \
+            (rb_n_ - rb_lin_) * sizeof((rb)->ring_buf[0]));                      \
+  ZB_RING_BUFFER_STORE_RELEASE(&(rb)->read_i,                                    \
+    (zb_ushort_t)(((rb)->read_i + rb_n_) % ZB_RING_BUFFER_CAPACITY(rb)));        \
+  (entries_read) = rb_n_;                                                        \
+} while(ZB_FALSE)
+
+
 /**
  * This is a fake type used for type casting.
  * Represents array of bytes, used for serial trace e.t.c.
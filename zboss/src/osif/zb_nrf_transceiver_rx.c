@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ * @brief Reference RX path of the ZBOSS transceiver adapter.
+ *
+ * Frames reported by the nRF 802.15.4 radio driver are queued in
+ * a single-producer, single-consumer ring. The radio driver notification
+ * context is the only producer and the ZBOSS MAC task is the only consumer,
+ * so no critical section is needed on either side.
+ *
+ * The MAC task drains the ring either one frame at a time
+ * (@ref zb_trans_get_next_packet) or in batches
+ * (@ref zb_trans_get_next_packets). A batch copies all frames first
+ * and only then returns the whole set of driver buffers, so the radio
+ * driver is re-armed once per batch instead of once per frame.
+ *
+ * This module implements @ref nrf_802154_received_raw and
+ * @ref nrf_802154_tx_ack_started, so the platform OSIF must not
+ * implement the RX path when it is enabled.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include <sys/atomic.h>
+#include <nrf_802154.h>
+#include <zboss_api.h>
+#include <zb_macll.h>
+
+#define RX_QUEUE_SIZE CONFIG_ZIGBEE_TRANSCEIVER_RX_QUEUE_SIZE
+
+BUILD_ASSERT((RX_QUEUE_SIZE & (RX_QUEUE_SIZE - 1)) == 0,
+	     "RX queue size must be a power of two");
+
+#define PHR_SIZE 1
+
+/* Frame Pending bit in the first octet of the Frame Control field. */
+#define FRAME_PENDING_OFFSET 1
+#define FRAME_PENDING_BIT    (1 << 4)
+
+struct rx_frame {
+	uint8_t *data;
+	int8_t power;
+	uint8_t lqi;
+	bool pending_bit;
+};
+
+static struct rx_frame rx_queue[RX_QUEUE_SIZE];
+
+/* Free-running indices. The producer writes only rx_head,
+ * the consumer writes only rx_tail.
+ */
+static atomic_t rx_head;
+static atomic_t rx_tail;
+
+/* Frame Pending bit of the last transmitted ACK. The driver notifies about
+ * the received frame after the ACK to that frame was sent.
+ */
+static volatile bool ack_pending_bit;
+
+static inline uint32_t rx_queue_used(void)
+{
+	return (uint32_t)atomic_get(&rx_head) - (uint32_t)atomic_get(&rx_tail);
+}
+
+/* Copies a queued frame into a ZBOSS buffer, in the layout expected by
+ * the MAC: PHR, PSDU and the MAC LL metadata at the end of the buffer.
+ */
+static void rx_frame_copy(zb_bufid_t buf, const struct rx_frame *frame)
+{
+	uint8_t length = frame->data[0] + PHR_SIZE;
+	uint8_t *data_ptr = zb_buf_initial_alloc(buf, length);
+
+	memcpy(data_ptr, frame->data, length);
+	zb_macll_metadata_set_lqi(buf, frame->lqi);
+	zb_macll_metadata_set_power(buf, frame->power);
+	zb_macll_set_received_data_status(buf, frame->pending_bit);
+}
+
+/* Notifies the platform that received frames are waiting in the queue.
+ * The platform is expected to wake up the ZBOSS thread.
+ */
+__weak void zb_trans_rx_notify(void)
+{
+}
+
+void nrf_802154_tx_ack_started(const uint8_t *data)
+{
+	ack_pending_bit = (data[FRAME_PENDING_OFFSET] & FRAME_PENDING_BIT) != 0;
+}
+
+void nrf_802154_received_raw(uint8_t *data, int8_t power, uint8_t lqi)
+{
+	uint32_t head = (uint32_t)atomic_get(&rx_head);
+	struct rx_frame *frame;
+	bool pending_bit = ack_pending_bit;
+
+	ack_pending_bit = false;
+
+	if (rx_queue_used() >= RX_QUEUE_SIZE) {
+		/* No room for the frame, return the buffer to the driver. */
+		(void)nrf_802154_buffer_free_immediately_raw(data);
+		return;
+	}
+
+	frame = &rx_queue[head & (RX_QUEUE_SIZE - 1)];
+	frame->data = data;
+	frame->power = power;
+	frame->lqi = lqi;
+	frame->pending_bit = pending_bit;
+
+	/* Publish the slot only after it is filled in. */
+	atomic_set(&rx_head, (atomic_val_t)(head + 1));
+
+	zb_trans_rx_notify();
+}
+
+zb_bool_t zb_trans_rx_pending(void)
+{
+	return (rx_queue_used() != 0) ? ZB_TRUE : ZB_FALSE;
+}
+
+zb_uint8_t zb_trans_get_next_packet(zb_bufid_t buf)
+{
+	return zb_trans_get_next_packets(&buf, 1);
+}
+
+zb_uint8_t zb_trans_get_next_packets(zb_bufid_t *bufs, zb_uint8_t count)
+{
+	uint32_t tail = (uint32_t)atomic_get(&rx_tail);
+	uint32_t available = (uint32_t)atomic_get(&rx_head) - tail;
+	uint8_t *done[RX_QUEUE_SIZE];
+	zb_uint8_t n = 0;
+
+	if (!bufs) {
+		return 0;
+	}
+
+	if (available > count) {
+		available = count;
+	}
+
+	for (uint32_t i = 0; i < available; i++) {
+		struct rx_frame *frame = &rx_queue[(tail + i) & (RX_QUEUE_SIZE - 1)];
+
+		if (!bufs[n]) {
+			break;
+		}
+
+		rx_frame_copy(bufs[n], frame);
+		done[n] = frame->data;
+		n++;
+	}
+
+	if (n == 0) {
+		return 0;
+	}
+
+	/* All frames are copied out, release the slots and the driver
+	 * buffers in one go.
+	 */
+	atomic_set(&rx_tail, (atomic_val_t)(tail + n));
+
+	for (zb_uint8_t i = 0; i < n; i++) {
+		nrf_802154_buffer_free_raw(done[i]);
+	}
+
+	return n;
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @addtogroup zb_zcl_attr_index_addons
+ *
+ * @brief Module for resolving ZCL attribute descriptors without walking
+ *        the device context lists.
+ *
+ * The index has two levels. The cluster table is sorted by
+ * (endpoint, cluster role, cluster ID) and each cluster entry refers to
+ * a range of the attribute table, sorted by attribute ID. Both levels are
+ * searched with a binary search. The last resolved cluster is cached, as
+ * consecutive accesses usually hit the same cluster.
+ * @{
+ */
+#include "zboss_api.h"
+#include "zcl/zb_zcl_attr_index_addons.h"
+
+/**@brief Cluster entry of the attribute descriptor index. */
+typedef struct {
+	zb_uint32_t key;        /**< Endpoint, cluster role and cluster ID. */
+	zb_uint16_t attr_first; /**< First entry in the attribute table. */
+	zb_uint16_t attr_count; /**< Number of entries in the attribute table. */
+} zb_zcl_attr_index_cluster_t;
+
+static zb_zcl_attr_index_cluster_t cluster_index[CONFIG_ZIGBEE_ZCL_ATTR_INDEX_CLUSTERS];
+static zb_uint_t cluster_index_count;
+
+static zb_uint16_t attr_index_ids[CONFIG_ZIGBEE_ZCL_ATTR_INDEX_SIZE];
+static zb_zcl_attr_t *attr_index_descs[CONFIG_ZIGBEE_ZCL_ATTR_INDEX_SIZE];
+static zb_uint_t attr_index_count;
+
+static zb_zcl_attr_index_cluster_t *cluster_last;
+
+static inline zb_uint32_t cluster_key(zb_uint8_t ep, zb_uint8_t cluster_role,
+				      zb_uint16_t cluster_id)
+{
+	return ((zb_uint32_t)ep << 24) | ((zb_uint32_t)cluster_role << 16) | cluster_id;
+}
+
+/**@brief Find the position of the first cluster entry with a key not less than @p key.
+ */
+static zb_uint_t cluster_lower_bound(zb_uint32_t key)
+{
+	zb_uint_t low = 0;
+	zb_uint_t high = cluster_index_count;
+
+	while (low < high) {
+		zb_uint_t mid = low + (high - low) / 2;
+
+		if (cluster_index[mid].key < key) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/**@brief Find the position of the first attribute with an ID not less than @p attr_id
+ *        within the attribute range of a cluster.
+ */
+static zb_uint_t attr_lower_bound(const zb_zcl_attr_index_cluster_t *cluster,
+				  zb_uint16_t attr_id)
+{
+	zb_uint_t low = cluster->attr_first;
+	zb_uint_t high = cluster->attr_first + cluster->attr_count;
+
+	while (low < high) {
+		zb_uint_t mid = low + (high - low) / 2;
+
+		if (attr_index_ids[mid] < attr_id) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/**@brief Append the attributes of a cluster to the index.
+ *
+ * The first occurrence of a cluster or an attribute is kept, as this is
+ * the one that the list walk in zb_zcl_get_attr_desc_a() returns.
+ */
+static zb_ret_t cluster_index_add(zb_uint8_t ep, zb_zcl_cluster_desc_t *cluster_desc)
+{
+	zb_uint32_t key = cluster_key(ep, cluster_desc->role_mask, cluster_desc->cluster_id);
+	zb_uint_t pos = cluster_lower_bound(key);
+	zb_zcl_attr_index_cluster_t *cluster;
+
+	if ((pos < cluster_index_count) && (cluster_index[pos].key == key)) {
+		return RET_OK;
+	}
+
+	if (cluster_index_count >= ZB_ARRAY_SIZE(cluster_index)) {
+		return RET_NO_MEMORY;
+	}
+
+	ZB_MEMMOVE(&cluster_index[pos + 1], &cluster_index[pos],
+		   (cluster_index_count - pos) * sizeof(cluster_index[0]));
+	cluster_index_count++;
+
+	cluster = &cluster_index[pos];
+	cluster->key = key;
+	cluster->attr_first = (zb_uint16_t)attr_index_count;
+	cluster->attr_count = 0;
+
+	for (zb_uint_t i = 0; i < cluster_desc->attr_count; i++) {
+		zb_zcl_attr_t *attr_desc = &cluster_desc->attr_desc_list[i];
+		zb_uint_t attr_pos;
+		zb_uint_t attr_end;
+
+		if (attr_desc->id == ZB_ZCL_NULL_ID) {
+			break;
+		}
+
+		attr_pos = attr_lower_bound(cluster, attr_desc->id);
+		attr_end = cluster->attr_first + cluster->attr_count;
+
+		if ((attr_pos < attr_end) && (attr_index_ids[attr_pos] == attr_desc->id)) {
+			continue;
+		}
+
+		if (attr_index_count >= ZB_ARRAY_SIZE(attr_index_ids)) {
+			return RET_NO_MEMORY;
+		}
+
+		/* The cluster being added owns the end of the attribute table. */
+		ZB_MEMMOVE(&attr_index_ids[attr_pos + 1], &attr_index_ids[attr_pos],
+			   (attr_end - attr_pos) * sizeof(attr_index_ids[0]));
+		ZB_MEMMOVE(&attr_index_descs[attr_pos + 1], &attr_index_descs[attr_pos],
+			   (attr_end - attr_pos) * sizeof(attr_index_descs[0]));
+
+		attr_index_ids[attr_pos] = attr_desc->id;
+		attr_index_descs[attr_pos] = attr_desc;
+		cluster->attr_count++;
+		attr_index_count++;
+	}
+
+	return RET_OK;
+}
+
+zb_ret_t zb_zcl_attr_index_build(zb_af_device_ctx_t *device_ctx)
+{
+	cluster_index_count = 0;
+	attr_index_count = 0;
+	cluster_last = NULL;
+
+	if (!device_ctx) {
+		return RET_OK;
+	}
+
+	for (zb_uint_t i = 0; i < device_ctx->ep_count; i++) {
+		zb_af_endpoint_desc_t *ep_desc = device_ctx->ep_desc_list[i];
+
+		for (zb_uint_t j = 0; j < ep_desc->cluster_count; j++) {
+			if (cluster_index_add(ep_desc->ep_id,
+					      &ep_desc->cluster_desc_list[j]) != RET_OK) {
+				cluster_index_count = 0;
+				attr_index_count = 0;
+				return RET_NO_MEMORY;
+			}
+		}
+	}
+
+	return RET_OK;
+}
+
+zb_zcl_attr_t *zb_zcl_attr_index_get_desc(zb_uint8_t ep, zb_uint16_t cluster_id,
+					  zb_uint8_t cluster_role, zb_uint16_t attr_id)
+{
+	zb_uint32_t key = cluster_key(ep, cluster_role, cluster_id);
+	zb_zcl_attr_index_cluster_t *cluster = cluster_last;
+	zb_uint_t attr_pos;
+
+	if (!cluster || (cluster->key != key)) {
+		zb_uint_t pos = cluster_lower_bound(key);
+
+		if ((pos >= cluster_index_count) || (cluster_index[pos].key != key)) {
+			/* Not indexed: unknown cluster, role wildcard or no index at all. */
+			return zb_zcl_get_attr_desc_a(ep, cluster_id, cluster_role, attr_id);
+		}
+
+		cluster = &cluster_index[pos];
+		cluster_last = cluster;
+	}
+
+	attr_pos = attr_lower_bound(cluster, attr_id);
+
+	if ((attr_pos < (zb_uint_t)(cluster->attr_first + cluster->attr_count)) &&
+	    (attr_index_ids[attr_pos] == attr_id)) {
+		return attr_index_descs[attr_pos];
+	}
+
+	return NULL;
+}
+
+/** @} */
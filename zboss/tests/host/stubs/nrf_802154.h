@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_802154_H_
+#define NRF_802154_H_
+
+/* Host replacement of the radio driver API used by the ZBOSS transceiver
+ * adapter. The tests implement the functions.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+void nrf_802154_tx_ack_started(const uint8_t *p_data);
+
+void nrf_802154_received_raw(uint8_t *p_data, int8_t power, uint8_t lqi);
+
+void nrf_802154_buffer_free_raw(uint8_t *p_data);
+
+bool nrf_802154_buffer_free_immediately_raw(uint8_t *p_data);
+
+#endif /* NRF_802154_H_ */
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SYS_ATOMIC_H_
+#define SYS_ATOMIC_H_
+
+/* Host replacement of the Zephyr atomic API, with the same sequentially
+ * consistent semantics. Like in Zephyr, it pulls in the toolchain macros.
+ */
+
+#include <toolchain.h>
+
+typedef long atomic_t;
+typedef atomic_t atomic_val_t;
+
+static inline atomic_val_t atomic_get(const atomic_t *target)
+{
+	return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_set(atomic_t *target, atomic_val_t value)
+{
+	return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+
+#endif /* SYS_ATOMIC_H_ */
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TOOLCHAIN_H_
+#define TOOLCHAIN_H_
+
+/* Host replacement of the Zephyr toolchain macros used by the tested
+ * sources.
+ */
+
+#define BUILD_ASSERT(expr, msg) _Static_assert(expr, msg)
+
+#define __weak __attribute__((__weak__))
+
+#endif /* TOOLCHAIN_H_ */
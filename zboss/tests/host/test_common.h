@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TEST_COMMON_H_
+#define TEST_COMMON_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Helpers of the host tests. A failed check terminates the test program,
+ * so the last test name printed by TEST_RUN() identifies the failing test.
+ */
+
+#define CHECK(expr)							       \
+	do {								       \
+		if (!(expr)) {						       \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, \
+				__LINE__, #expr);			       \
+			exit(1);					       \
+		}							       \
+	} while (0)
+
+#define TEST_RUN(test)				\
+	do {					\
+		printf("%s\n", #test);		\
+		fflush(stdout);			\
+		test();				\
+	} while (0)
+
+static inline uint64_t test_time_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+#endif /* TEST_COMMON_H_ */
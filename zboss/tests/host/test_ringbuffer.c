@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Tests of the ring buffer macros. The SPSC variant is also run with
+ * a producer and a consumer thread, which prints the throughput.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include "zboss_api.h"
+#include "zb_ringbuffer.h"
+
+#include "test_common.h"
+
+/* A capacity that is not a power of two checks the modulo arithmetic. */
+#define SPSC_CAPACITY 7
+#define THREAD_CAPACITY 64
+#define THREAD_ENTRIES 4000000UL
+#define BULK_MAX 13
+
+ZB_RING_BUFFER_SPSC_DECLARE(test_spsc, zb_uint32_t, SPSC_CAPACITY);
+ZB_RING_BUFFER_SPSC_DECLARE(test_spsc_thread, zb_uint32_t, THREAD_CAPACITY);
+ZB_RING_BUFFER_DECLARE(test_bytes, zb_uint8_t, 16);
+
+static test_spsc_t spsc;
+static test_spsc_thread_t spsc_thread;
+static zb_bool_t use_bulk;
+
+static void spsc_put(zb_uint32_t value)
+{
+	zb_uint32_t *entry = ZB_RING_BUFFER_SPSC_PUT_RESERVE(&spsc);
+
+	CHECK(entry != NULL);
+	*entry = value;
+	ZB_RING_BUFFER_SPSC_FLUSH_PUT(&spsc);
+}
+
+static zb_uint32_t spsc_get(void)
+{
+	zb_uint32_t *entry = ZB_RING_BUFFER_SPSC_PEEK(&spsc);
+	zb_uint32_t value;
+
+	CHECK(entry != NULL);
+	value = *entry;
+	ZB_RING_BUFFER_SPSC_FLUSH_GET(&spsc);
+
+	return value;
+}
+
+/* One slot is kept free, so the ring buffer holds capacity - 1 entries. */
+static void test_spsc_empty_full(void)
+{
+	zb_uint32_t i;
+
+	ZB_RING_BUFFER_SPSC_INIT(&spsc);
+
+	CHECK(ZB_RING_BUFFER_SPSC_IS_EMPTY(&spsc));
+	CHECK(ZB_RING_BUFFER_SPSC_PEEK(&spsc) == NULL);
+	CHECK(ZB_RING_BUFFER_SPSC_FREE_SPACE(&spsc) == SPSC_CAPACITY - 1);
+
+	for (i = 0; i < SPSC_CAPACITY - 1; i++) {
+		CHECK(!ZB_RING_BUFFER_SPSC_IS_FULL(&spsc));
+		spsc_put(i);
+		CHECK(ZB_RING_BUFFER_SPSC_USED_SPACE(&spsc) == i + 1);
+	}
+
+	CHECK(ZB_RING_BUFFER_SPSC_IS_FULL(&spsc));
+	CHECK(ZB_RING_BUFFER_SPSC_PUT_RESERVE(&spsc) == NULL);
+	CHECK(ZB_RING_BUFFER_SPSC_FREE_SPACE(&spsc) == 0);
+
+	for (i = 0; i < SPSC_CAPACITY - 1; i++) {
+		CHECK(spsc_get() == i);
+	}
+
+	CHECK(ZB_RING_BUFFER_SPSC_IS_EMPTY(&spsc));
+}
+
+/* Used and free space add up at every position of the indices. */
+static void test_spsc_wrap(void)
+{
+	zb_uint32_t next_put = 0;
+	zb_uint32_t next_get = 0;
+	zb_uint32_t fill;
+	zb_uint32_t round;
+
+	ZB_RING_BUFFER_SPSC_INIT(&spsc);
+
+	for (round = 0; round < 10 * SPSC_CAPACITY; round++) {
+		fill = round % SPSC_CAPACITY;
+
+		while (ZB_RING_BUFFER_SPSC_USED_SPACE(&spsc) < fill) {
+			spsc_put(next_put++);
+		}
+
+		CHECK(ZB_RING_BUFFER_SPSC_USED_SPACE(&spsc) +
+		      ZB_RING_BUFFER_SPSC_FREE_SPACE(&spsc) == SPSC_CAPACITY - 1);
+
+		while (!ZB_RING_BUFFER_SPSC_IS_EMPTY(&spsc)) {
+			CHECK(spsc_get() == next_get++);
+		}
+	}
+
+	CHECK(next_put == next_get);
+}
+
+/* Bulk copies split at the end of the ring buffer and stop when it runs
+ * full or empty.
+ */
+static void test_spsc_bulk(void)
+{
+	zb_uint32_t in[SPSC_CAPACITY + 2];
+	zb_uint32_t out[SPSC_CAPACITY + 2];
+	zb_uint32_t next_put = 0;
+	zb_uint32_t next_get = 0;
+	zb_uint_t written;
+	zb_uint_t read;
+	zb_uint_t size;
+	zb_uint_t i;
+
+	ZB_RING_BUFFER_SPSC_INIT(&spsc);
+
+	for (size = 0; size < 10 * SPSC_CAPACITY; size++) {
+		zb_uint_t put = size % ZB_ARRAY_SIZE(in);
+		zb_uint_t space = ZB_RING_BUFFER_SPSC_FREE_SPACE(&spsc);
+
+		for (i = 0; i < put; i++) {
+			in[i] = next_put + i;
+		}
+
+		ZB_RING_BUFFER_SPSC_PUT_N(&spsc, in, put, written);
+		CHECK(written == ((put < space) ? put : space));
+		next_put += written;
+
+		ZB_RING_BUFFER_SPSC_GET_N(&spsc, out, (size * 3) % ZB_ARRAY_SIZE(out), read);
+
+		for (i = 0; i < read; i++) {
+			CHECK(out[i] == next_get++);
+		}
+	}
+
+	ZB_RING_BUFFER_SPSC_GET_N(&spsc, out, ZB_ARRAY_SIZE(out), read);
+
+	for (i = 0; i < read; i++) {
+		CHECK(out[i] == next_get++);
+	}
+
+	CHECK(ZB_RING_BUFFER_SPSC_IS_EMPTY(&spsc));
+	CHECK(next_put == next_get);
+}
+
+/* A batch ending at the last slot wraps write_i to the start. */
+static void test_batch_put_wrap(void)
+{
+	test_bytes_t rb;
+	zb_uint8_t data[16] = { 0 };
+	zb_uint_t written;
+
+	ZB_RING_BUFFER_INIT(&rb);
+
+	ZB_RING_BUFFER_BATCH_PUT(&rb, data, 10, written);
+	CHECK(written == 10);
+	CHECK(rb.write_i == 10);
+
+	rb.read_i = 10;
+	rb.written = 0;
+
+	ZB_RING_BUFFER_BATCH_PUT(&rb, data, 8, written);
+	CHECK(written == 6);
+	CHECK(rb.write_i == 0);
+}
+
+static void *producer_thread(void *arg)
+{
+	zb_uint32_t in[BULK_MAX];
+	zb_uint32_t next = 0;
+	zb_uint_t written;
+	zb_uint_t i;
+
+	(void)arg;
+
+	while (next < THREAD_ENTRIES) {
+		if (use_bulk) {
+			zb_uint_t size = 1 + next % BULK_MAX;
+
+			if (size > THREAD_ENTRIES - next) {
+				size = THREAD_ENTRIES - next;
+			}
+
+			for (i = 0; i < size; i++) {
+				in[i] = next + i;
+			}
+
+			ZB_RING_BUFFER_SPSC_PUT_N(&spsc_thread, in, size, written);
+			next += written;
+		} else {
+			zb_uint32_t *entry = ZB_RING_BUFFER_SPSC_PUT_RESERVE(&spsc_thread);
+
+			written = 0;
+
+			if (entry) {
+				*entry = next++;
+				ZB_RING_BUFFER_SPSC_FLUSH_PUT(&spsc_thread);
+				written = 1;
+			}
+		}
+
+		if (written == 0) {
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+static void spsc_threads_run(zb_bool_t bulk)
+{
+	zb_uint32_t out[BULK_MAX];
+	zb_uint32_t next = 0;
+	pthread_t producer;
+	uint64_t start;
+	uint64_t elapsed;
+	zb_uint_t read;
+	zb_uint_t i;
+
+	ZB_RING_BUFFER_SPSC_INIT(&spsc_thread);
+	use_bulk = bulk;
+
+	start = test_time_ns();
+	CHECK(pthread_create(&producer, NULL, producer_thread, NULL) == 0);
+
+	while (next < THREAD_ENTRIES) {
+		if (bulk) {
+			ZB_RING_BUFFER_SPSC_GET_N(&spsc_thread, out, BULK_MAX, read);
+
+			for (i = 0; i < read; i++) {
+				CHECK(out[i] == next++);
+			}
+		} else {
+			zb_uint32_t *entry = ZB_RING_BUFFER_SPSC_PEEK(&spsc_thread);
+
+			read = 0;
+
+			if (entry) {
+				CHECK(*entry == next++);
+				ZB_RING_BUFFER_SPSC_FLUSH_GET(&spsc_thread);
+				read = 1;
+			}
+		}
+
+		if (read == 0) {
+			sched_yield();
+		}
+	}
+
+	CHECK(pthread_join(producer, NULL) == 0);
+	elapsed = test_time_ns() - start;
+
+	CHECK(ZB_RING_BUFFER_SPSC_IS_EMPTY(&spsc_thread));
+
+	printf("\t%s: %lu entries, %.1f Mentries/s\n",
+	       bulk ? "PUT_N/GET_N" : "single entry", THREAD_ENTRIES,
+	       (double)THREAD_ENTRIES * 1000.0 / (double)elapsed);
+}
+
+static void test_spsc_threads(void)
+{
+	spsc_threads_run(ZB_FALSE);
+	spsc_threads_run(ZB_TRUE);
+}
+
+int main(void)
+{
+	TEST_RUN(test_spsc_empty_full);
+	TEST_RUN(test_spsc_wrap);
+	TEST_RUN(test_spsc_bulk);
+	TEST_RUN(test_batch_put_wrap);
+	TEST_RUN(test_spsc_threads);
+
+	return 0;
+}
@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Tests of the batched RX path of the ZBOSS transceiver adapter. The test
+ * plays the radio driver, which reports received frames, and the ZBOSS
+ * MAC task, which drains them into ZBOSS buffers.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <nrf_802154.h>
+#include <zboss_api.h>
+#include <zb_macll.h>
+#include <zb_transceiver.h>
+
+#include "test_common.h"
+
+#define RX_QUEUE_SIZE CONFIG_ZIGBEE_TRANSCEIVER_RX_QUEUE_SIZE
+
+/* Driver RX buffers. One more than the queue holds, to overflow it. */
+#define DRV_BUFS (RX_QUEUE_SIZE + 1)
+#define DRV_BUF_SIZE 128
+
+#define ZB_BUFS 8
+#define ZB_BUF_SIZE 128
+
+#define FRAME_PSDU_LEN 10
+#define FRAME_PENDING_BIT (1 << 4)
+
+#define THREAD_FRAMES 1000000UL
+#define THREAD_BATCH 8
+
+/* Event recorded by the stubs, to check the order of copies and frees. */
+enum event_type {
+	EVENT_COPY,
+	EVENT_FREE,
+	EVENT_FREE_IMMEDIATELY,
+};
+
+struct event {
+	enum event_type type;
+	uint32_t seq;
+};
+
+struct zb_buf {
+	uint8_t data[ZB_BUF_SIZE];
+	zb_uint_t len;
+	uint8_t lqi;
+	int8_t power;
+	zb_bool_t pending_bit;
+};
+
+static uint8_t drv_bufs[DRV_BUFS][DRV_BUF_SIZE];
+static bool drv_buf_busy[DRV_BUFS];
+static struct zb_buf zb_bufs[ZB_BUFS + 1];
+
+static struct event events[4 * DRV_BUFS];
+static uint32_t events_count;
+static uint32_t notify_count;
+static bool threaded;
+
+static uint32_t frame_seq(const uint8_t *data)
+{
+	uint32_t seq;
+
+	memcpy(&seq, &data[1], sizeof(seq));
+
+	return seq;
+}
+
+static void event_record(enum event_type type, uint32_t seq)
+{
+	if (threaded) {
+		return;
+	}
+
+	CHECK(events_count < ZB_ARRAY_SIZE(events));
+	events[events_count].type = type;
+	events[events_count].seq = seq;
+	events_count++;
+}
+
+static zb_uint_t drv_buf_index(const uint8_t *data)
+{
+	zb_uint_t i = (zb_uint_t)((data - drv_bufs[0]) / DRV_BUF_SIZE);
+
+	CHECK(i < DRV_BUFS);
+	CHECK(data == drv_bufs[i]);
+
+	return i;
+}
+
+static void drv_buf_release(uint8_t *data)
+{
+	zb_uint_t i = drv_buf_index(data);
+
+	CHECK(__atomic_load_n(&drv_buf_busy[i], __ATOMIC_ACQUIRE));
+	__atomic_store_n(&drv_buf_busy[i], false, __ATOMIC_RELEASE);
+}
+
+void nrf_802154_buffer_free_raw(uint8_t *data)
+{
+	event_record(EVENT_FREE, frame_seq(data));
+	drv_buf_release(data);
+}
+
+bool nrf_802154_buffer_free_immediately_raw(uint8_t *data)
+{
+	event_record(EVENT_FREE_IMMEDIATELY, frame_seq(data));
+	drv_buf_release(data);
+
+	return true;
+}
+
+void zb_trans_rx_notify(void)
+{
+	notify_count++;
+}
+
+void *zb_buf_initial_alloc_func(TRACE_PROTO zb_bufid_t buf, zb_uint_t size)
+{
+	CHECK(buf > 0 && buf <= ZB_BUFS);
+	CHECK(size <= ZB_BUF_SIZE);
+
+	zb_bufs[buf].len = size;
+
+	return zb_bufs[buf].data;
+}
+
+void zb_macll_metadata_set_lqi(zb_bufid_t bufid, uint8_t lqi)
+{
+	zb_bufs[bufid].lqi = lqi;
+}
+
+void zb_macll_metadata_set_power(zb_bufid_t bufid, int8_t power)
+{
+	zb_bufs[bufid].power = power;
+}
+
+void zb_macll_set_received_data_status(zb_bufid_t bufid, zb_bool_t pending_bit)
+{
+	zb_bufs[bufid].pending_bit = pending_bit;
+
+	/* The status is set last, after the frame is copied. */
+	event_record(EVENT_COPY, frame_seq(zb_bufs[bufid].data));
+}
+
+/* Report a received frame as the radio driver does. Returns false if no
+ * driver buffer is free.
+ */
+static bool frame_receive(uint32_t seq)
+{
+	zb_uint_t i;
+
+	for (i = 0; i < DRV_BUFS; i++) {
+		if (!__atomic_load_n(&drv_buf_busy[i], __ATOMIC_ACQUIRE)) {
+			break;
+		}
+	}
+
+	if (i == DRV_BUFS) {
+		return false;
+	}
+
+	drv_buf_busy[i] = true;
+	drv_bufs[i][0] = FRAME_PSDU_LEN;
+	memcpy(&drv_bufs[i][1], &seq, sizeof(seq));
+	memset(&drv_bufs[i][1 + sizeof(seq)], (int)seq, FRAME_PSDU_LEN - sizeof(seq));
+
+	nrf_802154_received_raw(drv_bufs[i], (int8_t)(-(int32_t)(seq % 100)),
+				(uint8_t)seq);
+
+	return true;
+}
+
+static void zb_buf_check(zb_bufid_t buf, uint32_t seq, zb_bool_t pending_bit)
+{
+	struct zb_buf *zb_buf = &zb_bufs[buf];
+	zb_uint_t i;
+
+	CHECK(zb_buf->len == FRAME_PSDU_LEN + 1);
+	CHECK(zb_buf->data[0] == FRAME_PSDU_LEN);
+	CHECK(frame_seq(zb_buf->data) == seq);
+
+	for (i = 1 + sizeof(seq); i <= FRAME_PSDU_LEN; i++) {
+		CHECK(zb_buf->data[i] == (uint8_t)seq);
+	}
+
+	CHECK(zb_buf->lqi == (uint8_t)seq);
+	CHECK(zb_buf->power == (int8_t)(-(int32_t)(seq % 100)));
+	CHECK(zb_buf->pending_bit == pending_bit);
+}
+
+static void reset(void)
+{
+	zb_bufid_t bufs[ZB_BUFS];
+	zb_uint_t i;
+
+	for (i = 0; i < ZB_BUFS; i++) {
+		bufs[i] = (zb_bufid_t)(i + 1);
+	}
+
+	/* Drain frames left by the previous test. */
+	while (zb_trans_get_next_packets(bufs, ZB_BUFS) > 0) {
+	}
+
+	memset(drv_buf_busy, 0, sizeof(drv_buf_busy));
+	memset(zb_bufs, 0, sizeof(zb_bufs));
+	events_count = 0;
+	notify_count = 0;
+}
+
+static void test_single_frame(void)
+{
+	reset();
+
+	CHECK(!zb_trans_rx_pending());
+	CHECK(zb_trans_get_next_packet(1) == 0);
+
+	CHECK(frame_receive(7));
+	CHECK(notify_count == 1);
+	CHECK(zb_trans_rx_pending());
+
+	CHECK(zb_trans_get_next_packet(1) == 1);
+	zb_buf_check(1, 7, ZB_FALSE);
+	CHECK(!zb_trans_rx_pending());
+
+	CHECK(events_count == 2);
+	CHECK(events[0].type == EVENT_COPY);
+	CHECK(events[1].type == EVENT_FREE && events[1].seq == 7);
+}
+
+/* A batch copies all its frames before it frees the driver buffers. */
+static void test_batch(void)
+{
+	zb_bufid_t bufs[] = { 1, 2, 3 };
+	zb_bufid_t more[] = { 4, 5, 6, 7 };
+	uint32_t seq;
+	zb_uint_t i;
+
+	reset();
+
+	for (seq = 0; seq < 5; seq++) {
+		CHECK(frame_receive(seq));
+	}
+
+	CHECK(zb_trans_get_next_packets(bufs, ZB_ARRAY_SIZE(bufs)) == 3);
+
+	for (i = 0; i < 3; i++) {
+		zb_buf_check(bufs[i], i, ZB_FALSE);
+		CHECK(events[i].type == EVENT_COPY && events[i].seq == i);
+		CHECK(events[3 + i].type == EVENT_FREE && events[3 + i].seq == i);
+	}
+
+	CHECK(zb_trans_get_next_packets(more, ZB_ARRAY_SIZE(more)) == 2);
+	zb_buf_check(4, 3, ZB_FALSE);
+	zb_buf_check(5, 4, ZB_FALSE);
+	CHECK(events_count == 10);
+
+	CHECK(zb_trans_get_next_packets(more, ZB_ARRAY_SIZE(more)) == 0);
+	CHECK(zb_trans_get_next_packets(NULL, 4) == 0);
+	CHECK(events_count == 10);
+}
+
+/* The batch stops at the first missing ZBOSS buffer. */
+static void test_batch_missing_buffer(void)
+{
+	zb_bufid_t bufs[] = { 1, 2, ZB_BUF_INVALID, 3 };
+
+	reset();
+
+	CHECK(frame_receive(0));
+	CHECK(frame_receive(1));
+	CHECK(frame_receive(2));
+
+	CHECK(zb_trans_get_next_packets(bufs, ZB_ARRAY_SIZE(bufs)) == 2);
+	zb_buf_check(1, 0, ZB_FALSE);
+	zb_buf_check(2, 1, ZB_FALSE);
+	CHECK(zb_bufs[3].len == 0);
+
+	CHECK(zb_trans_get_next_packet(3) == 1);
+	zb_buf_check(3, 2, ZB_FALSE);
+
+	bufs[0] = ZB_BUF_INVALID;
+	CHECK(frame_receive(3));
+	CHECK(zb_trans_get_next_packets(bufs, ZB_ARRAY_SIZE(bufs)) == 0);
+	CHECK(zb_trans_rx_pending());
+}
+
+/* A frame received while the queue is full goes back to the driver. */
+static void test_queue_full(void)
+{
+	zb_bufid_t bufs[ZB_BUFS];
+	uint32_t next = 0;
+	uint32_t seq;
+	zb_uint_t n;
+	zb_uint_t i;
+
+	reset();
+
+	for (seq = 0; seq < RX_QUEUE_SIZE; seq++) {
+		CHECK(frame_receive(seq));
+	}
+
+	CHECK(frame_receive(RX_QUEUE_SIZE));
+	CHECK(events_count == 1);
+	CHECK(events[0].type == EVENT_FREE_IMMEDIATELY);
+	CHECK(events[0].seq == RX_QUEUE_SIZE);
+
+	for (i = 0; i < ZB_BUFS; i++) {
+		bufs[i] = (zb_bufid_t)(i + 1);
+	}
+
+	while ((n = zb_trans_get_next_packets(bufs, ZB_BUFS)) > 0) {
+		for (i = 0; i < n; i++) {
+			zb_buf_check(bufs[i], next++, ZB_FALSE);
+		}
+	}
+
+	CHECK(next == RX_QUEUE_SIZE);
+}
+
+/* The Frame Pending bit of the ACK applies to the next received frame. */
+static void test_ack_pending_bit(void)
+{
+	uint8_t ack[3] = { 0x02, FRAME_PENDING_BIT, 0x00 };
+
+	reset();
+
+	nrf_802154_tx_ack_started(ack);
+	CHECK(frame_receive(0));
+	CHECK(frame_receive(1));
+
+	ack[1] = 0;
+	nrf_802154_tx_ack_started(ack);
+	CHECK(frame_receive(2));
+
+	CHECK(zb_trans_get_next_packet(1) == 1);
+	zb_buf_check(1, 0, ZB_TRUE);
+	CHECK(zb_trans_get_next_packet(1) == 1);
+	zb_buf_check(1, 1, ZB_FALSE);
+	CHECK(zb_trans_get_next_packet(1) == 1);
+	zb_buf_check(1, 2, ZB_FALSE);
+}
+
+static void *driver_thread(void *arg)
+{
+	uint32_t seq = 0;
+
+	(void)arg;
+
+	while (seq < THREAD_FRAMES) {
+		if (frame_receive(seq)) {
+			seq++;
+		} else {
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+/* Frames reported concurrently are handed over in order and none is lost.
+ * The driver holds at most as many buffers as the queue, so no frame is
+ * dropped.
+ */
+static void test_threads(void)
+{
+	zb_bufid_t bufs[THREAD_BATCH];
+	uint32_t next = 0;
+	uint32_t batches = 0;
+	pthread_t driver;
+	uint64_t start;
+	uint64_t elapsed;
+	zb_uint_t n;
+	zb_uint_t i;
+
+	reset();
+	threaded = true;
+
+	/* Keep one driver buffer busy, so that the queue never overflows. */
+	drv_buf_busy[DRV_BUFS - 1] = true;
+
+	for (i = 0; i < THREAD_BATCH; i++) {
+		bufs[i] = (zb_bufid_t)(i + 1);
+	}
+
+	start = test_time_ns();
+	CHECK(pthread_create(&driver, NULL, driver_thread, NULL) == 0);
+
+	while (next < THREAD_FRAMES) {
+		n = zb_trans_get_next_packets(bufs, THREAD_BATCH);
+
+		if (n == 0) {
+			sched_yield();
+			continue;
+		}
+
+		for (i = 0; i < n; i++) {
+			CHECK(frame_seq(zb_bufs[bufs[i]].data) == next);
+			next++;
+		}
+
+		batches++;
+	}
+
+	CHECK(pthread_join(driver, NULL) == 0);
+	elapsed = test_time_ns() - start;
+	threaded = false;
+
+	CHECK(!zb_trans_rx_pending());
+
+	printf("\t%lu frames in %u batches, %.0f ns per frame\n", THREAD_FRAMES, batches,
+	       (double)elapsed / THREAD_FRAMES);
+}
+
+int main(void)
+{
+	TEST_RUN(test_single_frame);
+	TEST_RUN(test_batch);
+	TEST_RUN(test_batch_missing_buffer);
+	TEST_RUN(test_queue_full);
+	TEST_RUN(test_ack_pending_bit);
+	TEST_RUN(test_threads);
+
+	return 0;
+}
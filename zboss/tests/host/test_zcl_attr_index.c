@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Tests of the ZCL attribute descriptor index. Random device contexts are
+ * indexed and every lookup is compared with zb_zcl_get_attr_desc_a(), which
+ * the test implements as the list walk of the ZBOSS library.
+ */
+
+#include <string.h>
+
+#include "zboss_api.h"
+#include "zcl/zb_zcl_attr_index_addons.h"
+
+#include "test_common.h"
+
+#define ROUNDS 1000
+#define EP_MAX 4
+#define CLUSTERS_MAX 8
+#define ATTRS_MAX 12
+#define ATTR_ID_MAX 20
+#define BENCH_LOOKUPS 2000000UL
+
+static const zb_uint16_t cluster_ids[] = {
+	ZB_ZCL_CLUSTER_ID_BASIC,
+	ZB_ZCL_CLUSTER_ID_IDENTIFY,
+	ZB_ZCL_CLUSTER_ID_GROUPS,
+	ZB_ZCL_CLUSTER_ID_ON_OFF,
+	ZB_ZCL_CLUSTER_ID_LEVEL_CONTROL,
+	ZB_ZCL_CLUSTER_ID_COLOR_CONTROL,
+};
+
+static const zb_uint8_t roles[] = {
+	ZB_ZCL_CLUSTER_SERVER_ROLE,
+	ZB_ZCL_CLUSTER_CLIENT_ROLE,
+	ZB_ZCL_CLUSTER_ANY_ROLE,
+};
+
+/* Device context under test and its storage. */
+static zb_zcl_attr_t attrs[EP_MAX][CLUSTERS_MAX][ATTRS_MAX + 1];
+static zb_zcl_cluster_desc_t clusters[EP_MAX][CLUSTERS_MAX];
+static zb_af_endpoint_desc_t eps[EP_MAX];
+static zb_af_endpoint_desc_t *ep_list[EP_MAX];
+static zb_af_device_ctx_t device_ctx;
+
+static uint32_t rand_state = 1;
+
+static uint32_t rand_get(uint32_t bound)
+{
+	/* xorshift32, so that the runs are the same on every host. */
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state % bound;
+}
+
+/* List walk of the ZBOSS library: the first endpoint with the ID, then the
+ * first cluster with the ID and role, then the first attribute with the ID.
+ */
+zb_zcl_attr_t *zb_zcl_get_attr_desc_a(zb_uint8_t ep, zb_uint16_t cluster_id,
+				      zb_uint8_t cluster_role, zb_uint16_t attr_id)
+{
+	zb_af_endpoint_desc_t *ep_desc = NULL;
+	zb_zcl_cluster_desc_t *cluster_desc = NULL;
+	zb_zcl_attr_t *attr_desc;
+	zb_uint_t i;
+
+	for (i = 0; i < device_ctx.ep_count; i++) {
+		if (device_ctx.ep_desc_list[i]->ep_id == ep) {
+			ep_desc = device_ctx.ep_desc_list[i];
+			break;
+		}
+	}
+
+	if (!ep_desc) {
+		return NULL;
+	}
+
+	for (i = 0; i < ep_desc->cluster_count; i++) {
+		zb_zcl_cluster_desc_t *desc = &ep_desc->cluster_desc_list[i];
+
+		if ((desc->cluster_id == cluster_id) &&
+		    ((cluster_role == ZB_ZCL_CLUSTER_ANY_ROLE) ||
+		     (desc->role_mask == cluster_role))) {
+			cluster_desc = desc;
+			break;
+		}
+	}
+
+	if (!cluster_desc) {
+		return NULL;
+	}
+
+	for (attr_desc = cluster_desc->attr_desc_list; attr_desc->id != ZB_ZCL_NULL_ID;
+	     attr_desc++) {
+		if (attr_desc->id == attr_id) {
+			return attr_desc;
+		}
+	}
+
+	return NULL;
+}
+
+/* Fill in a device context with random endpoints, clusters and attributes,
+ * including duplicated clusters and attributes. Returns ZB_TRUE if the
+ * device fits into the index.
+ */
+static zb_bool_t device_generate(void)
+{
+	zb_uint_t cluster_keys = 0;
+	zb_uint_t attr_keys = 0;
+	zb_uint_t e;
+	zb_uint_t c;
+	zb_uint_t a;
+
+	memset(eps, 0, sizeof(eps));
+	memset(clusters, 0, sizeof(clusters));
+
+	device_ctx.ep_count = (zb_uint8_t)(1 + rand_get(EP_MAX));
+	device_ctx.ep_desc_list = ep_list;
+
+	for (e = 0; e < device_ctx.ep_count; e++) {
+		eps[e].ep_id = (zb_uint8_t)(1 + e * 10 + rand_get(10));
+		eps[e].cluster_count = (zb_uint8_t)(1 + rand_get(CLUSTERS_MAX));
+		eps[e].cluster_desc_list = clusters[e];
+		ep_list[e] = &eps[e];
+
+		for (c = 0; c < eps[e].cluster_count; c++) {
+			zb_zcl_cluster_desc_t *cluster = &clusters[e][c];
+			zb_uint_t count = rand_get(ATTRS_MAX + 1);
+			zb_bool_t duplicate = ZB_FALSE;
+			zb_uint_t i;
+
+			cluster->cluster_id = cluster_ids[rand_get(ZB_ARRAY_SIZE(cluster_ids))];
+			cluster->role_mask = roles[rand_get(2)];
+			cluster->attr_desc_list = attrs[e][c];
+			cluster->attr_count = (zb_uint16_t)(count + 1);
+
+			for (i = 0; i < c; i++) {
+				if ((clusters[e][i].cluster_id == cluster->cluster_id) &&
+				    (clusters[e][i].role_mask == cluster->role_mask)) {
+					duplicate = ZB_TRUE;
+				}
+			}
+
+			cluster_keys += duplicate ? 0 : 1;
+
+			for (a = 0; a < count; a++) {
+				zb_uint16_t id = (zb_uint16_t)rand_get(ATTR_ID_MAX);
+
+				attrs[e][c][a].id = (rand_get(8) == 0) ?
+					ZB_ZCL_ATTR_GLOBAL_CLUSTER_REVISION_ID : id;
+
+				for (i = 0; i < a; i++) {
+					if (attrs[e][c][i].id == attrs[e][c][a].id) {
+						break;
+					}
+				}
+
+				attr_keys += (duplicate || (i < a)) ? 0 : 1;
+			}
+
+			attrs[e][c][count].id = ZB_ZCL_NULL_ID;
+		}
+	}
+
+	return ((cluster_keys <= CONFIG_ZIGBEE_ZCL_ATTR_INDEX_CLUSTERS) &&
+		(attr_keys <= CONFIG_ZIGBEE_ZCL_ATTR_INDEX_SIZE)) ? ZB_TRUE : ZB_FALSE;
+}
+
+static zb_uint_t lookups_check(void)
+{
+	zb_uint_t checked = 0;
+	zb_uint_t e;
+
+	/* Endpoints of the device and one that does not exist. */
+	for (e = 0; e <= device_ctx.ep_count; e++) {
+		zb_uint8_t ep = (e < device_ctx.ep_count) ? eps[e].ep_id : 0xF0;
+		zb_uint_t c;
+
+		for (c = 0; c <= ZB_ARRAY_SIZE(cluster_ids); c++) {
+			zb_uint16_t cluster_id = (c < ZB_ARRAY_SIZE(cluster_ids)) ?
+				cluster_ids[c] : 0x1234;
+			zb_uint_t r;
+
+			for (r = 0; r < ZB_ARRAY_SIZE(roles); r++) {
+				zb_uint16_t attr_id;
+
+				for (attr_id = 0; attr_id <= ATTR_ID_MAX; attr_id++) {
+					CHECK(zb_zcl_attr_index_get_desc(ep, cluster_id, roles[r],
+									 attr_id) ==
+					      zb_zcl_get_attr_desc_a(ep, cluster_id, roles[r],
+								     attr_id));
+					checked++;
+				}
+
+				attr_id = ZB_ZCL_ATTR_GLOBAL_CLUSTER_REVISION_ID;
+				CHECK(zb_zcl_attr_index_get_desc(ep, cluster_id, roles[r], attr_id) ==
+				      zb_zcl_get_attr_desc_a(ep, cluster_id, roles[r], attr_id));
+				checked++;
+			}
+		}
+	}
+
+	return checked;
+}
+
+/* Lookups in a random order, so that the cached cluster is hit and missed. */
+static void lookups_random_check(zb_uint_t count)
+{
+	while (count-- > 0) {
+		zb_uint_t e = rand_get(device_ctx.ep_count);
+		zb_uint_t c = rand_get(eps[e].cluster_count);
+		zb_zcl_cluster_desc_t *cluster = &clusters[e][c];
+		zb_uint16_t attr_id = (zb_uint16_t)rand_get(ATTR_ID_MAX);
+
+		CHECK(zb_zcl_attr_index_get_desc(eps[e].ep_id, cluster->cluster_id,
+						 cluster->role_mask, attr_id) ==
+		      zb_zcl_get_attr_desc_a(eps[e].ep_id, cluster->cluster_id,
+					     cluster->role_mask, attr_id));
+	}
+}
+
+static void test_matches_list_walk(void)
+{
+	zb_uint_t indexed = 0;
+	zb_uint_t overflowed = 0;
+	zb_uint_t checked = 0;
+	zb_uint_t round;
+
+	for (round = 0; round < ROUNDS; round++) {
+		zb_bool_t fits = device_generate();
+		zb_ret_t ret = zb_zcl_attr_index_build(&device_ctx);
+
+		CHECK(ret == (fits ? RET_OK : RET_NO_MEMORY));
+
+		indexed += fits ? 1 : 0;
+		overflowed += fits ? 0 : 1;
+
+		checked += lookups_check();
+		lookups_random_check(1000);
+	}
+
+	printf("\t%u devices indexed, %u over the index size, %u lookups\n",
+	       indexed, overflowed, checked);
+
+	CHECK(indexed > 0);
+}
+
+static void test_no_device(void)
+{
+	CHECK(zb_zcl_attr_index_build(NULL) == RET_OK);
+
+	device_ctx.ep_count = 0;
+	CHECK(zb_zcl_attr_index_get_desc(1, ZB_ZCL_CLUSTER_ID_BASIC,
+					 ZB_ZCL_CLUSTER_SERVER_ROLE, 0) == NULL);
+}
+
+/* Light with four endpoints, each with the color control cluster last.
+ * Color control has ATTRS_MAX attributes and the other clusters have
+ * @p other_attrs attributes, listed in the reverse order if @p reversed.
+ */
+static void light_generate(zb_uint_t other_attrs, zb_bool_t reversed)
+{
+	zb_uint_t e;
+	zb_uint_t c;
+	zb_uint_t a;
+
+	device_ctx.ep_count = EP_MAX;
+	device_ctx.ep_desc_list = ep_list;
+
+	for (e = 0; e < EP_MAX; e++) {
+		eps[e].ep_id = (zb_uint8_t)(10 + e);
+		eps[e].cluster_count = ZB_ARRAY_SIZE(cluster_ids);
+		eps[e].cluster_desc_list = clusters[e];
+		ep_list[e] = &eps[e];
+
+		for (c = 0; c < ZB_ARRAY_SIZE(cluster_ids); c++) {
+			zb_uint_t count = (cluster_ids[c] == ZB_ZCL_CLUSTER_ID_COLOR_CONTROL) ?
+				ATTRS_MAX : other_attrs;
+
+			clusters[e][c].cluster_id = cluster_ids[c];
+			clusters[e][c].role_mask = ZB_ZCL_CLUSTER_SERVER_ROLE;
+			clusters[e][c].attr_desc_list = attrs[e][c];
+			clusters[e][c].attr_count = (zb_uint16_t)(count + 1);
+
+			for (a = 0; a < count; a++) {
+				attrs[e][c][a].id = (zb_uint16_t)(reversed ? count - 1 - a : a);
+			}
+
+			attrs[e][c][count].id = ZB_ZCL_NULL_ID;
+		}
+	}
+}
+
+/* A device that does not fit leaves the index empty, and all lookups fall
+ * back to the list walk, also for the cluster cached before the rebuild.
+ */
+static void test_index_overflow(void)
+{
+	light_generate(2, ZB_FALSE);
+
+	CHECK(zb_zcl_attr_index_build(&device_ctx) == RET_OK);
+	(void)lookups_check();
+
+	light_generate(ATTRS_MAX, ZB_TRUE);
+
+	CHECK(zb_zcl_attr_index_build(&device_ctx) == RET_NO_MEMORY);
+	(void)lookups_check();
+}
+
+static void bench_lookup(void)
+{
+	zb_zcl_attr_t *volatile sink;
+	uint64_t walk_ns;
+	uint64_t index_ns;
+	uint64_t start;
+	zb_uint_t i;
+
+	light_generate(2, ZB_FALSE);
+
+	CHECK(zb_zcl_attr_index_build(&device_ctx) == RET_OK);
+
+	start = test_time_ns();
+
+	for (i = 0; i < BENCH_LOOKUPS; i++) {
+		sink = zb_zcl_get_attr_desc_a(10 + EP_MAX - 1, ZB_ZCL_CLUSTER_ID_COLOR_CONTROL,
+					      ZB_ZCL_CLUSTER_SERVER_ROLE,
+					      (zb_uint16_t)(i % ATTRS_MAX));
+	}
+
+	walk_ns = test_time_ns() - start;
+	start = test_time_ns();
+
+	for (i = 0; i < BENCH_LOOKUPS; i++) {
+		sink = zb_zcl_attr_index_get_desc(10 + EP_MAX - 1, ZB_ZCL_CLUSTER_ID_COLOR_CONTROL,
+						  ZB_ZCL_CLUSTER_SERVER_ROLE,
+						  (zb_uint16_t)(i % ATTRS_MAX));
+	}
+
+	index_ns = test_time_ns() - start;
+	(void)sink;
+
+	printf("\tcolor control on the last endpoint: list walk %.1f ns, index %.1f ns\n",
+	       (double)walk_ns / BENCH_LOOKUPS, (double)index_ns / BENCH_LOOKUPS);
+}
+
+int main(void)
+{
+	TEST_RUN(test_matches_list_walk);
+	TEST_RUN(test_no_device);
+	TEST_RUN(test_index_overflow);
+	TEST_RUN(bench_lookup);
+
+	return 0;
+}